@@ -2,11 +2,13 @@
  * Copyright (c) 2016-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
+#include "testing_bdsdc.hpp"
 #include "testing_bdsqr.hpp"
 #include "testing_gebd2_gebrd.hpp"
 #include "testing_gelq2_gelqf.hpp"
 #include "testing_geql2_geqlf.hpp"
 #include "testing_geqr2_geqrf.hpp"
+#include "testing_gesv.hpp"
 #include "testing_gesvd.hpp"
 #include "testing_getf2_getrf.hpp"
 #include "testing_getf2_getrf_npvt.hpp"
@@ -30,257 +32,22 @@
 #include "testing_ormxl_unmxl.hpp"
 #include "testing_ormxr_unmxr.hpp"
 #include "testing_potf2_potrf.hpp"
+#include <algorithm>
 #include <boost/program_options.hpp>
+#include <cctype>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace po = boost::program_options;
 
-int main(int argc, char* argv[])
-try
+// runs the test/benchmark of the function in the given precision
+void run_function(const std::string& function, char precision, const Arguments& argus)
 {
-    rocblas_initialize();
-
-    Arguments argus;
-
-    // disable unit_check in client benchmark, it is only
-    // used in gtest unit test
-    argus.unit_check = 0;
-
-    // enable timing check,otherwise no performance data collected
-    argus.timing = 1;
-
-    std::string function;
-    char precision;
-    rocblas_int device_id;
-
-    // take arguments and set default values
-    // (TODO) IMPROVE WORDING/INFORMATION. CHANGE ARGUMENT NAMES FOR
-    // MORE RELATED NAMES (THESE ARE BLAS-BASED NAMES)
-
-    // clang-format off
-  po::options_description desc("rocsolver client command line options");
-  desc.add_options()("help,h", "produces this help message")
-
-        ("sizem,m",
-         po::value<rocblas_int>(&argus.M)->default_value(1024),
-         "Specific matrix size testing: the number of rows of a matrix.")
-
-        ("sizen,n",
-         po::value<rocblas_int>(&argus.N)->default_value(1024),
-         "Specific matrix/vector/order size testing: the number of columns of a matrix,"
-         "or the order of a system or transformation.")
-
-        ("sizek,k",
-         po::value<rocblas_int>(&argus.K)->default_value(1024),
-         "Specific...  the number of columns in "
-         "A & C  and rows in B.")
-
-        ("size4,S4",
-         po::value<rocblas_int>(&argus.S4)->default_value(1024),
-         "Extra size value.")
-
-        ("k1",
-         po::value<rocblas_int>(&argus.k1)->default_value(1),
-         "First index for row interchange, used with laswp. ")
-
-        ("k2",
-         po::value<rocblas_int>(&argus.k2)->default_value(2),
-         "Last index for row interchange, used with laswp. ")
-
-        ("lda",
-         po::value<rocblas_int>(&argus.lda)->default_value(1024),
-         "Specific leading dimension of matrix A, is only applicable to "
-         "BLAS-2 & BLAS-3: the number of rows.")
-
-        ("ldb",
-         po::value<rocblas_int>(&argus.ldb)->default_value(1024),
-         "Specific leading dimension of matrix B, is only applicable to BLAS-2 & BLAS-3: the number "
-         "of rows.")
-
-        ("ldc",
-         po::value<rocblas_int>(&argus.ldc)->default_value(1024),
-         "Specific leading dimension of matrix C, is only applicable to BLAS-2 & "
-         "BLAS-3: the number of rows.")
-
-        ("ldv",
-         po::value<rocblas_int>(&argus.ldv)->default_value(1024),
-         "Specific leading dimension.")
-
-        ("ldt",
-         po::value<rocblas_int>(&argus.ldt)->default_value(1024),
-         "Specific leading dimension.")
-
-        ("bsa",
-         po::value<rocblas_int>(&argus.bsa)->default_value(1024*1024),
-         "Specific stride of strided_batched matrix A, is only applicable to strided batched"
-         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
-
-        ("bsb",
-         po::value<rocblas_int>(&argus.bsb)->default_value(1024*1024),
-         "Specific stride of strided_batched matrix B, is only applicable to strided batched"
-         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
-
-        ("bsc",
-         po::value<rocblas_int>(&argus.bsc)->default_value(1024*1024),
-         "Specific stride of strided_batched matrix B, is only applicable to strided batched"
-         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
-
-        ("bsp",
-         po::value<rocblas_int>(&argus.bsp)->default_value(1024),
-         "Specific stride of batched pivots vector Ipiv, is only applicable to batched and strided_batched"
-         "factorizations: min(first dimension, second dimension).")
-
-        ("incx",
-         po::value<rocblas_int>(&argus.incx)->default_value(1),
-         "increment between values in x vector")
-
-        ("incy",
-         po::value<rocblas_int>(&argus.incy)->default_value(1),
-         "increment between values in y vector")
-
-        ("alpha",
-          po::value<double>(&argus.alpha)->default_value(1.0), "specifies the scalar alpha")
-
-        ("beta",
-         po::value<double>(&argus.beta)->default_value(0.0), "specifies the scalar beta")
-
-        ("function,f",
-         po::value<std::string>(&function)->default_value("potf2"),
-         "LAPACK function to test. Options: potf2, getf2, getrf, getrs")
-
-        ("precision,r",
-         po::value<char>(&precision)->default_value('s'), "Options: h,s,d,c,z")
-
-        ("transposeA",
-         po::value<char>(&argus.transA_option)->default_value('N'),
-         "N = no transpose, T = transpose, C = conjugate transpose")
-
-        ("transposeB",
-         po::value<char>(&argus.transB_option)->default_value('N'),
-         "N = no transpose, T = transpose, C = conjugate transpose")
-
-        ("transposeH",
-         po::value<char>(&argus.transH_option)->default_value('N'),
-         "N = no transpose, T = transpose, C = conjugate transpose")
-
-        ("side",
-         po::value<char>(&argus.side_option)->default_value('L'),
-         "L = left, R = right. Only applicable to certain routines")
-
-        ("uplo",
-         po::value<char>(&argus.uplo_option)->default_value('U'),
-         "U = upper, L = lower. Only applicable to certain routines")
-
-        ("direct",
-         po::value<char>(&argus.direct_option)->default_value('F'),
-         "F = forward, B = backward. Only applicable to certain routines")
-
-        ("storev",
-         po::value<char>(&argus.storev)->default_value('C'),
-         "C = column_wise, R = row_wise. Only applicable to certain routines")
-
-        ("batch",
-         po::value<rocblas_int>(&argus.batch_count)->default_value(1),
-         "Number of matrices. Only applicable to batched routines")
-
-        ("verify,v",
-         po::value<rocblas_int>(&argus.norm_check)->default_value(0),
-         "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
-
-        ("iters,i",
-         po::value<rocblas_int>(&argus.iters)->default_value(10),
-         "Iterations to run inside timing loop")
-
-        ("perf",
-         po::value<rocblas_int>(&argus.perf)->default_value(0),
-         "If equal 1, only GPU timing results are collected and printed (default is 0)")
-
-        ("device",
-         po::value<rocblas_int>(&device_id)->default_value(0),
-         "Set default device to be used for subsequent program runs")
-
-        ("workmode",
-         po::value<char>(&argus.workmode)->default_value('O'),
-         "Enables out-of-place computations in some routines")
-
-        ("leftsv",
-         po::value<char>(&argus.left_svect)->default_value('N'),
-         "Only applicable to certain routines")
-
-        ("rightsv",
-         po::value<char>(&argus.right_svect)->default_value('N'),
-         "Only applicable to certain routines");
-    // clang-format on
-
-    po::variables_map vm;
-    po::store(po::parse_command_line(argc, argv, desc), vm);
-    po::notify(vm);
-
-    // print help message
-    if(vm.count("help"))
-    {
-        rocblas_cout << desc << std::endl;
-        return 0;
-    }
-
-    // catch invalid arguments for:
-
-    // precision
-    if(precision != 's' && precision != 'd' && precision != 'c' && precision != 'z')
-        throw std::invalid_argument("Invalid value for --precision ");
-
-    // deviceID
-    if(!argus.perf)
-    {
-        rocblas_int device_count = query_device_property();
-        if(device_count <= device_id)
-            throw std::invalid_argument("Invalid Device ID");
-    }
-    set_device(device_id);
-
-    // operation transA
-    if(argus.transA_option != 'N' && argus.transA_option != 'T' && argus.transA_option != 'C')
-        throw std::invalid_argument("Invalid value for --transposeA");
-
-    // operation transB
-    if(argus.transB_option != 'N' && argus.transB_option != 'T' && argus.transB_option != 'C')
-        throw std::invalid_argument("Invalid value for --transposeB");
-
-    // operation transH
-    if(argus.transH_option != 'N' && argus.transH_option != 'T' && argus.transH_option != 'C')
-        throw std::invalid_argument("Invalid value for --transposeH");
-
-    // side
-    if(argus.side_option != 'L' && argus.side_option != 'R' && argus.side_option != 'B')
-        throw std::invalid_argument("Invalid value for --side");
-
-    // uplo
-    if(argus.uplo_option != 'U' && argus.uplo_option != 'L' && argus.uplo_option != 'F')
-        throw std::invalid_argument("Invalid value for --uplo");
-
-    // direct
-    if(argus.direct_option != 'F' && argus.direct_option != 'B')
-        throw std::invalid_argument("Invalid value for --direct");
-
-    // storev
-    if(argus.storev != 'R' && argus.storev != 'C')
-        throw std::invalid_argument("Invalid value for --storev");
-
-    // leftsv
-    if(argus.left_svect != 'A' && argus.left_svect != 'S' && argus.left_svect != 'O'
-       && argus.left_svect != 'N')
-        throw std::invalid_argument("Invalid value for --leftsv");
-
-    // rightsv
-    if(argus.right_svect != 'A' && argus.right_svect != 'S' && argus.right_svect != 'O'
-       && argus.right_svect != 'N')
-        throw std::invalid_argument("Invalid value for --rightsv");
-
-    // rightsv
-    if(argus.workmode != 'O' && argus.workmode != 'I')
-        throw std::invalid_argument("Invalid value for --workmode");
-
-    // select and dispatch function test/benchmark
-    // (TODO) MOVE THIS TO A SEPARATE IMPROVED DISPATCH FUNCTION
     if(function == "potf2")
     {
         if(precision == 's')
@@ -721,6 +488,39 @@ try
         else if(precision == 'z')
             testing_getrs<false, true, rocblas_double_complex>(argus);
     }
+    else if(function == "gesv")
+    {
+        if(precision == 's')
+            testing_gesv<false, false, float>(argus);
+        else if(precision == 'd')
+            testing_gesv<false, false, double>(argus);
+        else if(precision == 'c')
+            testing_gesv<false, false, rocblas_float_complex>(argus);
+        else if(precision == 'z')
+            testing_gesv<false, false, rocblas_double_complex>(argus);
+    }
+    else if(function == "gesv_batched")
+    {
+        if(precision == 's')
+            testing_gesv<true, true, float>(argus);
+        else if(precision == 'd')
+            testing_gesv<true, true, double>(argus);
+        else if(precision == 'c')
+            testing_gesv<true, true, rocblas_float_complex>(argus);
+        else if(precision == 'z')
+            testing_gesv<true, true, rocblas_double_complex>(argus);
+    }
+    else if(function == "gesv_strided_batched")
+    {
+        if(precision == 's')
+            testing_gesv<false, true, float>(argus);
+        else if(precision == 'd')
+            testing_gesv<false, true, double>(argus);
+        else if(precision == 'c')
+            testing_gesv<false, true, rocblas_float_complex>(argus);
+        else if(precision == 'z')
+            testing_gesv<false, true, rocblas_double_complex>(argus);
+    }
     else if(function == "gesvd")
     {
         if(precision == 's')
@@ -1220,9 +1020,791 @@ try
         else if(precision == 'z')
             testing_bdsqr<rocblas_double_complex>(argus);
     }
+    else if(function == "bdsdc")
+    {
+        if(precision == 's')
+            testing_bdsdc<float>(argus);
+        else if(precision == 'd')
+            testing_bdsdc<double>(argus);
+        else if(precision == 'c')
+            testing_bdsdc<rocblas_float_complex>(argus);
+        else if(precision == 'z')
+            testing_bdsdc<rocblas_double_complex>(argus);
+    }
     else
         throw std::invalid_argument("Invalid value for --function");
+}
+
+/*******************************************************************************
+ * Options
+ ******************************************************************************/
+
+// options of a benchmark, from the command line or from a line of a suite file
+struct bench_options
+{
+    Arguments argus;
+    std::string function;
+    char precision;
+    rocblas_int device_id;
+    std::string mrange, nrange, brange;
+    std::string format, output, suite;
+    std::string baseline;
+    double threshold;
+
+    // (set from the parsed options)
+    bool help = false;
+    bool sweep = false;
+    bool given_k = false;
+
+    bench_options()
+    {
+        // disable unit_check in client benchmark, it is only
+        // used in gtest unit test
+        argus.unit_check = 0;
+
+        // enable timing check,otherwise no performance data collected
+        argus.timing = 1;
+    }
+};
+
+po::options_description bench_options_description(bench_options& opt)
+{
+    // take arguments and set default values
+    // (TODO) IMPROVE WORDING/INFORMATION. CHANGE ARGUMENT NAMES FOR
+    // MORE RELATED NAMES (THESE ARE BLAS-BASED NAMES)
+
+    // clang-format off
+    po::options_description desc("rocsolver client command line options");
+    desc.add_options()("help,h", "produces this help message")
+
+        ("sizem,m",
+         po::value<rocblas_int>(&opt.argus.M)->default_value(1024),
+         "Specific matrix size testing: the number of rows of a matrix.")
+
+        ("sizen,n",
+         po::value<rocblas_int>(&opt.argus.N)->default_value(1024),
+         "Specific matrix/vector/order size testing: the number of columns of a matrix,"
+         "or the order of a system or transformation.")
+
+        ("sizek,k",
+         po::value<rocblas_int>(&opt.argus.K)->default_value(1024),
+         "Specific...  the number of columns in "
+         "A & C  and rows in B.")
+
+        ("size4,S4",
+         po::value<rocblas_int>(&opt.argus.S4)->default_value(1024),
+         "Extra size value.")
+
+        ("k1",
+         po::value<rocblas_int>(&opt.argus.k1)->default_value(1),
+         "First index for row interchange, used with laswp. ")
+
+        ("k2",
+         po::value<rocblas_int>(&opt.argus.k2)->default_value(2),
+         "Last index for row interchange, used with laswp. ")
+
+        ("lda",
+         po::value<rocblas_int>(&opt.argus.lda)->default_value(1024),
+         "Specific leading dimension of matrix A, is only applicable to "
+         "BLAS-2 & BLAS-3: the number of rows.")
+
+        ("ldb",
+         po::value<rocblas_int>(&opt.argus.ldb)->default_value(1024),
+         "Specific leading dimension of matrix B, is only applicable to BLAS-2 & BLAS-3: the number "
+         "of rows.")
+
+        ("ldc",
+         po::value<rocblas_int>(&opt.argus.ldc)->default_value(1024),
+         "Specific leading dimension of matrix C, is only applicable to BLAS-2 & "
+         "BLAS-3: the number of rows.")
+
+        ("ldv",
+         po::value<rocblas_int>(&opt.argus.ldv)->default_value(1024),
+         "Specific leading dimension.")
+
+        ("ldt",
+         po::value<rocblas_int>(&opt.argus.ldt)->default_value(1024),
+         "Specific leading dimension.")
+
+        ("bsa",
+         po::value<rocblas_int>(&opt.argus.bsa)->default_value(1024*1024),
+         "Specific stride of strided_batched matrix A, is only applicable to strided batched"
+         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
+
+        ("bsb",
+         po::value<rocblas_int>(&opt.argus.bsb)->default_value(1024*1024),
+         "Specific stride of strided_batched matrix B, is only applicable to strided batched"
+         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
+
+        ("bsc",
+         po::value<rocblas_int>(&opt.argus.bsc)->default_value(1024*1024),
+         "Specific stride of strided_batched matrix B, is only applicable to strided batched"
+         "BLAS-2 and BLAS-3: second dimension * leading dimension.")
+
+        ("bsp",
+         po::value<rocblas_int>(&opt.argus.bsp)->default_value(1024),
+         "Specific stride of batched pivots vector Ipiv, is only applicable to batched and strided_batched"
+         "factorizations: min(first dimension, second dimension).")
+
+        ("incx",
+         po::value<rocblas_int>(&opt.argus.incx)->default_value(1),
+         "increment between values in x vector")
+
+        ("incy",
+         po::value<rocblas_int>(&opt.argus.incy)->default_value(1),
+         "increment between values in y vector")
+
+        ("alpha",
+          po::value<double>(&opt.argus.alpha)->default_value(1.0), "specifies the scalar alpha")
+
+        ("beta",
+         po::value<double>(&opt.argus.beta)->default_value(0.0), "specifies the scalar beta")
+
+        ("function,f",
+         po::value<std::string>(&opt.function)->default_value("potf2"),
+         "LAPACK function to test. Options: potf2, getf2, getrf, getrs")
+
+        ("precision,r",
+         po::value<char>(&opt.precision)->default_value('s'), "Options: h,s,d,c,z")
+
+        ("transposeA",
+         po::value<char>(&opt.argus.transA_option)->default_value('N'),
+         "N = no transpose, T = transpose, C = conjugate transpose")
+
+        ("transposeB",
+         po::value<char>(&opt.argus.transB_option)->default_value('N'),
+         "N = no transpose, T = transpose, C = conjugate transpose")
+
+        ("transposeH",
+         po::value<char>(&opt.argus.transH_option)->default_value('N'),
+         "N = no transpose, T = transpose, C = conjugate transpose")
+
+        ("side",
+         po::value<char>(&opt.argus.side_option)->default_value('L'),
+         "L = left, R = right. Only applicable to certain routines")
+
+        ("uplo",
+         po::value<char>(&opt.argus.uplo_option)->default_value('U'),
+         "U = upper, L = lower. Only applicable to certain routines")
+
+        ("direct",
+         po::value<char>(&opt.argus.direct_option)->default_value('F'),
+         "F = forward, B = backward. Only applicable to certain routines")
+
+        ("storev",
+         po::value<char>(&opt.argus.storev)->default_value('C'),
+         "C = column_wise, R = row_wise. Only applicable to certain routines")
+
+        ("batch",
+         po::value<rocblas_int>(&opt.argus.batch_count)->default_value(1),
+         "Number of matrices. Only applicable to batched routines")
+
+        ("sizem_range",
+         po::value<std::string>(&opt.mrange),
+         "Sweep mode: list of values and ranges start:end:step of m, where step is an increment "
+         "(+s or s) or a factor (*s). E.g. 64:4096:*2 or 100,200:1000:200. "
+         "The leading dimensions and strides are derived from the sizes of each problem.")
+
+        ("sizen_range",
+         po::value<std::string>(&opt.nrange),
+         "Sweep mode: list of values and ranges of n (as in --sizem_range), "
+         "or m to sweep over square matrices with n = m.")
+
+        ("batch_range",
+         po::value<std::string>(&opt.brange),
+         "Sweep mode: list of values and ranges of the batch count (as in --sizem_range).")
+
+        ("output_format",
+         po::value<std::string>(&opt.format),
+         "table = tables of arguments and results, csv = one CSV row per problem, "
+         "json = one JSON object per problem and line (default: table, or csv in sweep mode)")
+
+        ("output_file",
+         po::value<std::string>(&opt.output)->default_value(""),
+         "File where the rows of the csv and json formats are written (default: stdout)")
+
+        ("suite",
+         po::value<std::string>(&opt.suite),
+         "Suite mode: file with a benchmark per line, given as the options of rocsolver-bench. "
+         "All the benchmarks run in this process, with the same handle, and their results are "
+         "written as one report (by default in csv format).")
+
+        ("baseline",
+         po::value<std::string>(&opt.baseline),
+         "File with the results of a previous run (in csv or json format). The problems that are "
+         "run again are compared with it, the regressions are reported on stderr, and the exit "
+         "code is 1 if there are any.")
+
+        ("threshold",
+         po::value<double>(&opt.threshold)->default_value(0.05),
+         "Relative increase of the median time over the baseline that is a regression, if the "
+         "time is also above the 95th percentile of the baseline.")
+
+        ("verify,v",
+         po::value<rocblas_int>(&opt.argus.norm_check)->default_value(0),
+         "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
+
+        ("iters,i",
+         po::value<rocblas_int>(&opt.argus.iters)->default_value(10),
+         "Iterations to run inside timing loop")
+
+        ("perf",
+         po::value<rocblas_int>(&opt.argus.perf)->default_value(0),
+         "If equal 1, only GPU timing results are collected and printed (default is 0)")
+
+        ("counters",
+         po::value<rocblas_int>(&opt.argus.counters)->default_value(0),
+         "If equal 1, the kernel launches, rocBLAS calls, synchronous copies and device memory "
+         "allocations of the last timed call are also printed (ignored with --perf 1)")
+
+        ("device",
+         po::value<rocblas_int>(&opt.device_id)->default_value(0),
+         "Set default device to be used for subsequent program runs")
+
+        ("workmode",
+         po::value<char>(&opt.argus.workmode)->default_value('O'),
+         "Enables out-of-place computations in some routines")
+
+        ("leftsv",
+         po::value<char>(&opt.argus.left_svect)->default_value('N'),
+         "Only applicable to certain routines")
+
+        ("rightsv",
+         po::value<char>(&opt.argus.right_svect)->default_value('N'),
+         "Only applicable to certain routines");
+    // clang-format on
+
+    return desc;
+}
+
+// parses the options (without the program name)
+bench_options parse_options(const std::vector<std::string>& args)
+{
+    bench_options opt;
+    po::options_description desc = bench_options_description(opt);
+    po::variables_map vm;
+    po::store(po::command_line_parser(args).options(desc).run(), vm);
+    po::notify(vm);
+
+    opt.help = vm.count("help");
+    opt.sweep = vm.count("sizem_range") || vm.count("sizen_range") || vm.count("batch_range");
+    opt.given_k = !vm["sizek"].defaulted();
+    return opt;
+}
+
+// catches invalid arguments
+void check_options(const bench_options& opt)
+{
+    const Arguments& argus = opt.argus;
+
+    // precision
+    if(opt.precision != 's' && opt.precision != 'd' && opt.precision != 'c' && opt.precision != 'z')
+        throw std::invalid_argument("Invalid value for --precision ");
+
+    // operation transA
+    if(argus.transA_option != 'N' && argus.transA_option != 'T' && argus.transA_option != 'C')
+        throw std::invalid_argument("Invalid value for --transposeA");
+
+    // operation transB
+    if(argus.transB_option != 'N' && argus.transB_option != 'T' && argus.transB_option != 'C')
+        throw std::invalid_argument("Invalid value for --transposeB");
+
+    // operation transH
+    if(argus.transH_option != 'N' && argus.transH_option != 'T' && argus.transH_option != 'C')
+        throw std::invalid_argument("Invalid value for --transposeH");
+
+    // side
+    if(argus.side_option != 'L' && argus.side_option != 'R' && argus.side_option != 'B')
+        throw std::invalid_argument("Invalid value for --side");
+
+    // uplo
+    if(argus.uplo_option != 'U' && argus.uplo_option != 'L' && argus.uplo_option != 'F')
+        throw std::invalid_argument("Invalid value for --uplo");
+
+    // direct
+    if(argus.direct_option != 'F' && argus.direct_option != 'B')
+        throw std::invalid_argument("Invalid value for --direct");
+
+    // storev
+    if(argus.storev != 'R' && argus.storev != 'C')
+        throw std::invalid_argument("Invalid value for --storev");
+
+    // leftsv
+    if(argus.left_svect != 'A' && argus.left_svect != 'S' && argus.left_svect != 'O'
+       && argus.left_svect != 'N')
+        throw std::invalid_argument("Invalid value for --leftsv");
+
+    // rightsv
+    if(argus.right_svect != 'A' && argus.right_svect != 'S' && argus.right_svect != 'O'
+       && argus.right_svect != 'N')
+        throw std::invalid_argument("Invalid value for --rightsv");
+
+    // rightsv
+    if(argus.workmode != 'O' && argus.workmode != 'I')
+        throw std::invalid_argument("Invalid value for --workmode");
+}
+
+/*******************************************************************************
+ * Sweep mode
+ *
+ * The sizes m and n and the batch count can be given as lists of values and
+ * ranges, e.g. "32,48,64:1024:*2,1536". A range start:end:step goes from start
+ * up to end (included) with an increment (+step or step) or a factor (*step),
+ * and every combination of the values is run. In this mode the leading
+ * dimensions and strides are derived from the sizes of each problem, and k is
+ * set to min(m,n) unless it is given.
+ *
+ * With --output_format csv or json, the results are written as one row per
+ * problem (in CSV, or as JSON objects, one per line) instead of the tables of
+ * the testing functions.
+ ******************************************************************************/
+
+std::vector<rocblas_int> parse_range(const std::string& str, const char* option)
+{
+    auto invalid = [option] {
+        return std::invalid_argument(std::string("Invalid value for ") + option);
+    };
+
+    std::vector<rocblas_int> values;
+    std::istringstream in(str);
+    std::string item;
+    while(std::getline(in, item, ','))
+    {
+        std::istringstream is(item);
+        rocblas_int first, last;
+        char sep1, sep2, op = '+';
+        double step = 1;
+        if(!(is >> first) || first < 0)
+            throw invalid();
+        if(is.eof())
+        {
+            values.push_back(first);
+            continue;
+        }
+
+        if(!(is >> sep1 >> last) || sep1 != ':' || last < first)
+            throw invalid();
+        if(!is.eof())
+        {
+            if(!(is >> sep2) || sep2 != ':')
+                throw invalid();
+            if(is.peek() == '+' || is.peek() == '*')
+                is >> op;
+            if(!(is >> step) || !is.eof())
+                throw invalid();
+        }
+
+        if(op == '*')
+        {
+            // (the values are rounded, and repeated ones are skipped)
+            if(step <= 1 || first == 0)
+                throw invalid();
+            for(double v = first; v < last + 0.5; v *= step)
+            {
+                rocblas_int r = rocblas_int(v + 0.5);
+                if(values.empty() || values.back() != r)
+                    values.push_back(r);
+            }
+        }
+        else
+        {
+            if(step < 1 || step != rocblas_int(step))
+                throw invalid();
+            for(rocblas_int v = first; v <= last; v += rocblas_int(step))
+                values.push_back(v);
+        }
+    }
+
+    if(values.empty())
+        throw invalid();
+    return values;
+}
+
+// the fields of a row that identify its problem: the function, the precision,
+// the sizes and the options that select different problems with the same sizes
+// (they are written in this order, before the results)
+typedef std::vector<std::pair<std::string, std::string>> problem_fields;
+
+problem_fields
+    get_problem_fields(const std::string& function, char precision, const Arguments& argus)
+{
+    return {{"function", function},
+            {"precision", std::string(1, precision)},
+            {"m", std::to_string(argus.M)},
+            {"n", std::to_string(argus.N)},
+            {"k", std::to_string(argus.K)},
+            {"batch_count", std::to_string(argus.batch_count)},
+            {"transposeA", std::string(1, argus.transA_option)},
+            {"transposeH", std::string(1, argus.transH_option)},
+            {"side", std::string(1, argus.side_option)},
+            {"uplo", std::string(1, argus.uplo_option)},
+            {"direct", std::string(1, argus.direct_option)},
+            {"storev", std::string(1, argus.storev)},
+            {"leftsv", std::string(1, argus.left_svect)},
+            {"rightsv", std::string(1, argus.right_svect)},
+            {"workmode", std::string(1, argus.workmode)},
+            {"lda", std::to_string(argus.lda)},
+            {"ldb", std::to_string(argus.ldb)},
+            {"ldc", std::to_string(argus.ldc)},
+            {"ldv", std::to_string(argus.ldv)},
+            {"ldt", std::to_string(argus.ldt)},
+            {"bsa", std::to_string(argus.bsa)},
+            {"bsb", std::to_string(argus.bsb)},
+            {"bsc", std::to_string(argus.bsc)},
+            {"bsp", std::to_string(argus.bsp)},
+            {"incx", std::to_string(argus.incx)},
+            {"k1", std::to_string(argus.k1)},
+            {"k2", std::to_string(argus.k2)}};
+}
+
+void write_row(rocsolver_ostream& os,
+               const std::string& format,
+               const std::string& function,
+               char precision,
+               const Arguments& argus)
+{
+    const rocsolver_bench_results& res = rocsolver_bench_last();
+    problem_fields fields = get_problem_fields(function, precision, argus);
+    if(format == "csv")
+    {
+        for(auto& f : fields)
+            os << f.second << ",";
+        os << res.gpu_time << "," << res.min_time << "," << res.p95_time << "," << res.cold_time
+           << "," << res.cpu_time << "," << res.error << "," << res.gflops << "," << res.gbps
+           << std::endl;
+    }
+    else
+    {
+        // (the numbers are not quoted)
+        os << "{";
+        for(auto& f : fields)
+        {
+            bool number = std::isdigit(f.second[0]) || f.second[0] == '-';
+            os << "\"" << f.first << "\": " << (number ? "" : "\"") << f.second
+               << (number ? "" : "\"") << ", ";
+        }
+        os << "\"gpu_time_us\": " << res.gpu_time << ", \"min_time_us\": " << res.min_time
+           << ", \"p95_time_us\": " << res.p95_time << ", \"cold_time_us\": " << res.cold_time
+           << ", \"cpu_time_us\": " << res.cpu_time << ", \"error\": " << res.error
+           << ", \"gflops\": " << res.gflops << ", \"gbps\": " << res.gbps << "}" << std::endl;
+    }
+}
+
+/*******************************************************************************
+ * Comparison with a baseline
+ *
+ * With --baseline, the rows of a previous run (in csv or json format) are
+ * loaded, and every problem that is run again is compared with the row of the
+ * baseline with the same problem fields (function, precision, sizes and
+ * options such as the transposition, the side, the fill mode, the singular
+ * vectors, the leading dimensions and the strides). A problem regresses when
+ * its median time is larger than the baseline median by more than the
+ * threshold (a fraction of the baseline median) and is also above the 95th
+ * percentile of the baseline, so that the changes within the spread of the
+ * times of the baseline are not flagged.
+ ******************************************************************************/
+
+std::string row_key(const problem_fields& fields)
+{
+    std::string key;
+    for(auto& f : fields)
+        key += (key.empty() ? "" : " ") + f.first + "=" + f.second;
+    return key;
+}
+
+class bench_baseline
+{
+    struct times
+    {
+        double median;
+        double p95;
+    };
+
+    std::map<std::string, times> rows;
+    double threshold;
+    int compared = 0;
+    int regressions = 0;
+
+    // the fields of a row, by name
+    // (the rows without some of the problem fields, as those of older versions
+    // of the client, do not match any problem)
+    void add_row(std::map<std::string, std::string>& f)
+    {
+        problem_fields fields = get_problem_fields("", 0, Arguments());
+        for(auto& field : fields)
+            field.second = f[field.first];
+        rows[row_key(fields)]
+            = {std::atof(f["gpu_time_us"].c_str()), std::atof(f["p95_time_us"].c_str())};
+    }
+
+public:
+    bench_baseline(const std::string& path, double threshold)
+        : threshold(threshold)
+    {
+        std::ifstream file(path);
+        if(!file)
+            throw std::invalid_argument("Cannot open the baseline file " + path);
+
+        std::string line;
+        std::vector<std::string> header;
+        std::regex json_field("\"(\\w+)\":\\s*\"?([^\",}]*)");
+        while(std::getline(file, line))
+        {
+            std::map<std::string, std::string> fields;
+            if(line.empty())
+                continue;
+            else if(line[0] == '{')
+            {
+                for(std::sregex_iterator it(line.begin(), line.end(), json_field), end; it != end;
+                    ++it)
+                    fields[(*it)[1]] = (*it)[2];
+            }
+            else
+            {
+                std::vector<std::string> values;
+                std::istringstream in(line);
+                std::string value;
+                while(std::getline(in, value, ','))
+                    values.push_back(value);
+
+                // (the first line of a csv file is the header)
+                if(header.empty())
+                {
+                    header = values;
+                    continue;
+                }
+                for(size_t i = 0; i < values.size() && i < header.size(); ++i)
+                    fields[header[i]] = values[i];
+            }
+            add_row(fields);
+        }
+
+        if(rows.empty())
+            throw std::invalid_argument("No results in the baseline file " + path);
+    }
+
+    void compare(const std::string& function, char precision, const Arguments& argus)
+    {
+        auto it = rows.find(row_key(get_problem_fields(function, precision, argus)));
+        if(it == rows.end())
+            return;
+
+        const times& base = it->second;
+        double time = rocsolver_bench_last().gpu_time;
+        double change = (time - base.median) / base.median;
+        compared++;
+        if(change > threshold && time > base.p95)
+        {
+            regressions++;
+            rocblas_cerr << "Regression: " << it->first << ": " << base.median << " us -> " << time
+                         << " us (" << (change > 0 ? "+" : "") << 100 * change << "%)" << std::endl;
+        }
+    }
+
+    // prints a summary, and returns the number of regressions
+    int report()
+    {
+        rocblas_cerr << "Baseline: " << compared << " problems compared, " << regressions
+                     << " regressions (threshold " << 100 * threshold << "%)" << std::endl;
+        return regressions;
+    }
+};
+
+// opens the stream where the rows of the format are written, and writes the
+// header of the csv format
+rocsolver_ostream open_output(const std::string& format, const std::string& path)
+{
+    rocsolver_ostream os = path.empty() ? rocblas_cout.dup() : rocsolver_ostream(path);
+    if(format == "csv")
+    {
+        for(auto& f : get_problem_fields("", 0, Arguments()))
+            os << f.first << ",";
+        os << "gpu_time_us,min_time_us,p95_time_us,cold_time_us,cpu_time_us,error,gflops,gbps"
+           << std::endl;
+    }
+    return os;
+}
+
+// runs every combination of the sizes of the options; when it is not a sweep
+// there is a single problem, and its leading dimensions and strides are the
+// given ones. The results are compared with the baseline, if there is one.
+// Returns the number of problems that were not run.
+int run_sweep(const bench_options& opt,
+              const std::string& format,
+              rocsolver_ostream& os,
+              bench_baseline* baseline)
+{
+    const Arguments& argus = opt.argus;
+    bool square = (opt.nrange == "m");
+    std::vector<rocblas_int> ms = !opt.mrange.empty() ? parse_range(opt.mrange, "--sizem_range")
+                                                      : std::vector<rocblas_int>{argus.M};
+    std::vector<rocblas_int> ns = !opt.nrange.empty() && !square
+                                      ? parse_range(opt.nrange, "--sizen_range")
+                                      : std::vector<rocblas_int>{argus.N};
+    std::vector<rocblas_int> bcs = !opt.brange.empty()
+                                       ? parse_range(opt.brange, "--batch_range")
+                                       : std::vector<rocblas_int>{argus.batch_count};
+
+    const char* inform[] = {"quick return", "invalid size arguments", "invalid value in arguments"};
+    bool rows = (format != "table");
+    int skipped = 0;
+
+    rocsolver_bench_results& res = rocsolver_bench_last();
+    res.recording = rows;
+    for(rocblas_int bc : bcs)
+        for(rocblas_int m : ms)
+            for(rocblas_int n : (square ? std::vector<rocblas_int>{m} : ns))
+            {
+                Arguments point = argus;
+                if(opt.sweep)
+                {
+                    point.M = m;
+                    point.N = n;
+                    point.batch_count = bc;
+                    if(!opt.given_k)
+                        point.K = std::min(m, n);
+
+                    rocblas_int mn = std::max(m, n);
+                    rocblas_int ld = std::max(std::max(mn, point.K), 1);
+                    point.lda = point.ldb = point.ldc = point.ldv = point.ldt = ld;
+                    point.bsa = point.bsb = point.bsc = point.bsp = point.bs5 = ld * mn;
+                }
+
+                res.recorded = false;
+                res.inform = -1;
+                run_function(opt.function, opt.precision, point);
+
+                if(res.inform >= 0)
+                    skipped++;
+                if(rows && res.recorded)
+                    write_row(os, format, opt.function, opt.precision, point);
+                if(baseline && res.recorded)
+                    baseline->compare(opt.function, opt.precision, point);
+                else if(rows && res.inform >= 0)
+                    rocblas_cerr << "Skipped " << opt.function << " with m = " << point.M
+                                 << ", n = " << point.N << ", batch_count = " << point.batch_count
+                                 << ": " << inform[res.inform] << std::endl;
+            }
+
+    return skipped;
+}
+
+/*******************************************************************************
+ * Suite mode
+ *
+ * A suite file lists a benchmark per line, given as the options of
+ * rocsolver-bench (a leading program name is skipped, so the output of the
+ * bench logging mode, ROCSOLVER_LAYER=2, is a valid suite). Empty lines and
+ * the text after a '#' are ignored, and the lines can use the sweep options.
+ * All the benchmarks run in this process with the same handle, so rocBLAS is
+ * initialized once and the device memory of the handle is reused, and their
+ * results are written as a single report.
+ ******************************************************************************/
+
+void run_suite(const std::string& suite,
+               const std::string& format,
+               const std::string& path,
+               bench_baseline* baseline)
+{
+    std::ifstream file(suite);
+    if(!file)
+        throw std::invalid_argument("Cannot open the suite file " + suite);
+
+    rocsolver_ostream os = open_output(format, path);
+    rocblas_local_handle handle;
+    rocsolver_bench_handle::share(handle);
+
+    std::string line;
+    int lineno = 0, entries = 0, failed = 0, skipped = 0;
+    while(std::getline(file, line))
+    {
+        lineno++;
+        std::vector<std::string> args = po::split_unix(line.substr(0, line.find('#')));
+        if(!args.empty() && args[0].find("rocsolver-bench") != std::string::npos)
+            args.erase(args.begin());
+        if(args.empty())
+            continue;
+
+        entries++;
+        try
+        {
+            bench_options entry = parse_options(args);
+            check_options(entry);
+            skipped += run_sweep(entry, format, os, baseline);
+        }
+        catch(const std::exception& e)
+        {
+            rocblas_cerr << suite << ":" << lineno << ": " << e.what() << std::endl;
+            failed++;
+        }
+    }
+
+    rocsolver_bench_handle::share(nullptr);
+    rocblas_cerr << "Suite " << suite << ": " << entries << " benchmarks, " << failed
+                 << " with invalid options, " << skipped << " problems skipped" << std::endl;
+}
+
+int main(int argc, char* argv[])
+try
+{
+    rocblas_initialize();
+
+    bench_options opt = parse_options(std::vector<std::string>(argv + 1, argv + argc));
+
+    // print help message
+    if(opt.help)
+    {
+        bench_options defaults;
+        rocblas_cout << bench_options_description(defaults) << std::endl;
+        return 0;
+    }
+
+    // deviceID
+    if(!opt.argus.perf)
+    {
+        rocblas_int device_count = query_device_property();
+        if(device_count <= opt.device_id)
+            throw std::invalid_argument("Invalid Device ID");
+    }
+    set_device(opt.device_id);
+
+    // output format
+    std::string format = opt.format;
+    if(format.empty())
+        format = (opt.sweep || !opt.suite.empty() || !opt.baseline.empty()) ? "csv" : "table";
+    if(format != "table" && format != "csv" && format != "json")
+        throw std::invalid_argument("Invalid value for --output_format");
+
+    // baseline to compare with
+    std::unique_ptr<bench_baseline> baseline;
+    if(!opt.baseline.empty())
+    {
+        if(format == "table")
+            throw std::invalid_argument("--baseline needs the csv or json output format");
+        if(opt.threshold < 0)
+            throw std::invalid_argument("Invalid value for --threshold");
+        baseline = std::make_unique<bench_baseline>(opt.baseline, opt.threshold);
+    }
+
+    if(!opt.suite.empty())
+        run_suite(opt.suite, format, opt.output, baseline.get());
+    else
+    {
+        check_options(opt);
+
+        // run a single problem, or sweep over the given sizes
+        if(!opt.sweep && format == "table")
+            run_function(opt.function, opt.precision, opt.argus);
+        else
+        {
+            rocsolver_ostream os = open_output(format, opt.output);
+            run_sweep(opt, format, os, baseline.get());
+        }
+    }
 
+    // (the exit code tells whether there are regressions)
+    if(baseline && baseline->report() > 0)
+        return 1;
     return 0;
 }
 
@@ -0,0 +1,567 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_test.hpp"
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+/*******************************************************************************
+ * rocsolver-tune
+ *
+ * Sweeps the tuning parameters (crossover points and block sizes) of the blocked
+ * routines over a grid of problem sizes, and writes the fastest value of each
+ * parameter, for every size class, as the entries of a tuning table that can be
+ * loaded with ROCSOLVER_TUNING_FILE or rocsolver_load_tuning_file.
+ *
+ * The parameters of a routine are tuned one at a time, in the order listed below,
+ * with the others fixed at the best values found so far. Every problem of the
+ * grid (all the combinations of m, n and batch_count) is timed with each
+ * candidate value; the problems are grouped into size classes by the size the
+ * parameter is keyed on, and for every class the candidate with the smallest sum
+ * of times relative to the fastest candidate of each problem is kept.
+ ******************************************************************************/
+
+struct tune_size
+{
+    rocblas_int m;
+    rocblas_int n;
+    rocblas_int bc;
+};
+
+struct tune_routine
+{
+    const char* name;
+    std::vector<rocsolver_tuning_param> params;
+    bool batched; // otherwise only batch_count = 1 is timed
+    bool square; // works on n-by-n matrices (m is ignored)
+};
+
+const std::vector<tune_routine> tune_routines = {
+    {"getrf",
+     {rocsolver_tuning_getrf_switchsize, rocsolver_tuning_getrf_lookahead_switchsize},
+     true,
+     false},
+    {"potrf", {rocsolver_tuning_potrf_switchsize}, true, true},
+    {"geqrf", {rocsolver_tuning_geqxf_switchsize, rocsolver_tuning_geqxf_blocksize}, true, false},
+    {"gelqf", {rocsolver_tuning_gexqf_switchsize, rocsolver_tuning_gexqf_blocksize}, true, false},
+    {"orgqr", {rocsolver_tuning_orgxx_switchsize, rocsolver_tuning_orgxx_blocksize}, false, false},
+    {"ormqr", {rocsolver_tuning_ormxx_blocksize}, false, false},
+    {"getri",
+     {rocsolver_tuning_getri_switchsize_mid, rocsolver_tuning_getri_switchsize_large,
+      rocsolver_tuning_getri_blocksize},
+     true,
+     true},
+    {"gebrd", {rocsolver_tuning_gebrd_switchsize}, true, false},
+};
+
+const std::map<rocsolver_tuning_param, const char*> tune_names = {
+    {rocsolver_tuning_getrf_switchsize, "getrf_switchsize"},
+    {rocsolver_tuning_potrf_switchsize, "potrf_switchsize"},
+    {rocsolver_tuning_geqxf_switchsize, "geqxf_switchsize"},
+    {rocsolver_tuning_geqxf_blocksize, "geqxf_blocksize"},
+    {rocsolver_tuning_gexqf_switchsize, "gexqf_switchsize"},
+    {rocsolver_tuning_gexqf_blocksize, "gexqf_blocksize"},
+    {rocsolver_tuning_orgxx_switchsize, "orgxx_switchsize"},
+    {rocsolver_tuning_orgxx_blocksize, "orgxx_blocksize"},
+    {rocsolver_tuning_ormxx_blocksize, "ormxx_blocksize"},
+    {rocsolver_tuning_getri_switchsize_mid, "getri_switchsize_mid"},
+    {rocsolver_tuning_getri_switchsize_large, "getri_switchsize_large"},
+    {rocsolver_tuning_getri_blocksize, "getri_blocksize"},
+    {rocsolver_tuning_gebrd_switchsize, "gebrd_switchsize"},
+    {rocsolver_tuning_getrf_lookahead_switchsize, "getrf_lookahead_switchsize"},
+};
+
+// size the tuning parameters of the routine are keyed on
+// (orgqr forms the m-by-k matrix Q, and ormqr applies k reflectors, with k = min(m,n))
+rocblas_int tune_key(const tune_routine& routine, const tune_size& s)
+{
+    return routine.square ? s.n : std::min(s.m, s.n);
+}
+
+template <typename T>
+std::vector<T> parse_list(const std::string& str, const char* option)
+{
+    std::vector<T> list;
+    std::istringstream in(str);
+    std::string item;
+    while(std::getline(in, item, ','))
+    {
+        std::istringstream val(item);
+        T v;
+        if(!(val >> v) || !val.eof() || v <= 0)
+            throw std::invalid_argument(std::string("Invalid value for ") + option);
+        list.push_back(v);
+    }
+    return list;
+}
+
+/*******************************************************************************
+ * tune_problem holds the data of a problem of the grid for one routine, and
+ * times the routine on it. The inputs are restored from a pristine copy before
+ * every call, outside of the timed region.
+ ******************************************************************************/
+template <typename T>
+class tune_problem
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_handle handle;
+    std::string name;
+    rocblas_int m, n, k, bc;
+    rocblas_int lda, ldc;
+    rocblas_stride stA, stC, stP;
+    bool strided;
+
+    device_vector<T> A, A0, C, C0, tau, tauq;
+    device_vector<S> D, E;
+    device_vector<rocblas_int> ipiv, info;
+
+    rocblas_status run()
+    {
+        if(name == "getrf")
+            return rocsolver_getf2_getrf(strided, true, handle, m, n, A.data(), lda, stA,
+                                         ipiv.data(), stP, info.data(), bc);
+        if(name == "potrf")
+            return rocsolver_potf2_potrf(strided, true, handle, rocblas_fill_lower, n, A.data(),
+                                         lda, stA, info.data(), bc);
+        if(name == "geqrf")
+            return rocsolver_geqr2_geqrf(strided, true, handle, m, n, A.data(), lda, stA,
+                                         tau.data(), stP, bc);
+        if(name == "gelqf")
+            return rocsolver_gelq2_gelqf(strided, true, handle, m, n, A.data(), lda, stA,
+                                         tau.data(), stP, bc);
+        if(name == "orgqr")
+            return rocsolver_orgxr_ungxr(true, handle, m, k, k, A.data(), lda, tau.data());
+        if(name == "ormqr")
+            return rocsolver_ormxr_unmxr(true, handle, rocblas_side_left, rocblas_operation_none,
+                                         m, n, k, A.data(), lda, tau.data(), C.data(), ldc);
+        if(name == "getri")
+            return rocsolver_getri(strided, handle, n, A.data(), A.data(), lda, stA, ipiv.data(),
+                                   stP, info.data(), bc);
+        return rocsolver_gebd2_gebrd(strided, true, handle, m, n, A.data(), lda, stA, D.data(), k,
+                                     E.data(), k, tau.data(), k, tauq.data(), k, bc);
+    }
+
+    void restore(hipStream_t stream)
+    {
+        CHECK_HIP_ERROR(hipMemcpyAsync(A.data(), A0.data(), sizeof(T) * stA * bc,
+                                       hipMemcpyDeviceToDevice, stream));
+        if(name == "ormqr")
+            CHECK_HIP_ERROR(hipMemcpyAsync(C.data(), C0.data(), sizeof(T) * stC,
+                                           hipMemcpyDeviceToDevice, stream));
+    }
+
+public:
+    tune_problem(rocblas_handle handle, const tune_routine& routine, const tune_size& s)
+        : handle(handle)
+        , name(routine.name)
+        , m(routine.square ? s.n : s.m)
+        , n(s.n)
+        , k(std::min(m, n))
+        , bc(s.bc)
+        , lda(m)
+        , ldc(m)
+        , stA(rocblas_stride(m) * n)
+        , stC(rocblas_stride(m) * n)
+        , stP(k)
+        , strided(s.bc > 1)
+        , A(stA * bc)
+        , A0(stA * bc)
+        , C(name == "ormqr" ? stC : 1)
+        , C0(name == "ormqr" ? stC : 1)
+        , tau(stP * bc)
+        , tauq(stP * bc)
+        , D(stP * bc)
+        , E(stP * bc)
+        , ipiv(stP * bc)
+        , info(bc)
+    {
+        CHECK_HIP_ERROR(A.memcheck());
+        CHECK_HIP_ERROR(A0.memcheck());
+
+        // random matrices made diagonally dominant (hermitian for potrf) so that
+        // the factorizations do not break down
+        std::vector<T> hA(stA * bc);
+        rocblas_seedrand();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            T* a = hA.data() + b * stA;
+            for(rocblas_int j = 0; j < n; ++j)
+            {
+                for(rocblas_int i = 0; i < m; ++i)
+                {
+                    if(name == "potrf" && i < j)
+                        a[i + j * lda] = sconj(a[j + i * lda]);
+                    else
+                        a[i + j * lda] = random_generator<T>();
+                }
+                if(j < m)
+                    a[j + j * lda] = std::real(a[j + j * lda]) + 10 * std::max(m, n);
+            }
+        }
+        CHECK_HIP_ERROR(hipMemcpy(A0.data(), hA.data(), sizeof(T) * stA * bc,
+                                  hipMemcpyHostToDevice));
+
+        if(name == "ormqr")
+        {
+            std::vector<T> hC(stC);
+            for(auto& c : hC)
+                c = random_generator<T>();
+            CHECK_HIP_ERROR(
+                hipMemcpy(C0.data(), hC.data(), sizeof(T) * stC, hipMemcpyHostToDevice));
+        }
+
+        // getri works on the LU factorization of A, and orgqr and ormqr
+        // on the Householder reflectors of the QR factorization of A
+        if(name == "getri" || name == "orgqr" || name == "ormqr")
+        {
+            CHECK_HIP_ERROR(hipMemcpy(A.data(), A0.data(), sizeof(T) * stA * bc,
+                                      hipMemcpyDeviceToDevice));
+            if(name == "getri")
+                CHECK_ROCBLAS_ERROR(rocsolver_getf2_getrf(strided, true, handle, n, n, A.data(),
+                                                          lda, stA, ipiv.data(), stP, info.data(),
+                                                          bc));
+            else
+                CHECK_ROCBLAS_ERROR(rocsolver_geqr2_geqrf(false, true, handle, m, n, A.data(), lda,
+                                                          stA, tau.data(), stP, 1));
+            CHECK_HIP_ERROR(hipMemcpy(A0.data(), A.data(), sizeof(T) * stA * bc,
+                                      hipMemcpyDeviceToDevice));
+        }
+    }
+
+    // returns the median time (in microseconds) of iters calls, after a warm-up call
+    double time(const rocblas_int iters)
+    {
+        hipStream_t stream;
+        hipEvent_t start, stop;
+        float ms;
+        std::vector<double> times;
+
+        rocblas_get_stream(handle, &stream);
+        CHECK_HIP_ERROR(hipEventCreate(&start));
+        CHECK_HIP_ERROR(hipEventCreate(&stop));
+
+        for(rocblas_int iter = -1; iter < iters; ++iter)
+        {
+            restore(stream);
+            CHECK_HIP_ERROR(hipEventRecord(start, stream));
+            CHECK_ROCBLAS_ERROR(run());
+            CHECK_HIP_ERROR(hipEventRecord(stop, stream));
+            CHECK_HIP_ERROR(hipEventSynchronize(stop));
+            CHECK_HIP_ERROR(hipEventElapsedTime(&ms, start, stop));
+            if(iter >= 0)
+                times.push_back(1000.0 * ms);
+        }
+
+        CHECK_HIP_ERROR(hipEventDestroy(start));
+        CHECK_HIP_ERROR(hipEventDestroy(stop));
+
+        std::sort(times.begin(), times.end());
+        return times[times.size() / 2];
+    }
+};
+
+/*******************************************************************************
+ * Tuning of a routine in one precision
+ ******************************************************************************/
+
+struct tune_entry
+{
+    rocsolver_tuning_param param;
+    rocblas_int min_size;
+    rocblas_int max_size; // negative means no upper bound
+    rocblas_int value;
+};
+
+// sets the values of all the parameters of the routine for all sizes
+void tune_set(rocblas_handle handle,
+              rocblas_datatype precision,
+              const std::vector<rocsolver_tuning_param>& params,
+              const std::vector<rocblas_int>& values)
+{
+    CHECK_ROCBLAS_ERROR(rocsolver_reset_tuning(handle));
+    for(size_t p = 0; p < params.size(); ++p)
+        CHECK_ROCBLAS_ERROR(
+            rocsolver_set_tuning_parameter(handle, params[p], precision, 0, -1, values[p]));
+}
+
+template <typename T>
+std::vector<tune_entry> tune(rocblas_handle handle,
+                             const rocblas_datatype precision,
+                             const tune_routine& routine,
+                             const std::vector<tune_size>& grid,
+                             const std::vector<double>& factors,
+                             const rocblas_int iters,
+                             const bool verbose)
+{
+    size_t nparams = routine.params.size();
+
+    // problems of the grid (without repetitions) and their size classes
+    std::vector<tune_size> problems;
+    for(auto s : grid)
+    {
+        if(routine.square)
+            s.m = s.n;
+        if(!routine.batched)
+            s.bc = 1;
+
+        bool repeated = false;
+        for(const auto& p : problems)
+            repeated = repeated || (p.m == s.m && p.n == s.n && p.bc == s.bc);
+        if(!repeated)
+            problems.push_back(s);
+    }
+
+    std::vector<rocblas_int> keys;
+    for(const auto& s : problems)
+        keys.push_back(tune_key(routine, s));
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    // best values found so far for every size class, starting from the defaults
+    CHECK_ROCBLAS_ERROR(rocsolver_reset_tuning(handle));
+    std::vector<std::vector<rocblas_int>> best(keys.size(), std::vector<rocblas_int>(nparams));
+    for(size_t c = 0; c < keys.size(); ++c)
+        for(size_t p = 0; p < nparams; ++p)
+            CHECK_ROCBLAS_ERROR(rocsolver_get_tuning_parameter(handle, routine.params[p], precision,
+                                                               keys[c], &best[c][p]));
+
+    for(size_t p = 0; p < nparams; ++p)
+    {
+        for(size_t c = 0; c < keys.size(); ++c)
+        {
+            // candidate values are multiples of the default
+            std::vector<rocblas_int> candidates;
+            for(double f : factors)
+                candidates.push_back(std::max(rocblas_int(f * best[c][p] + 0.5), 1));
+            std::sort(candidates.begin(), candidates.end());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+            std::vector<double> score(candidates.size(), 0);
+            for(const auto& s : problems)
+            {
+                if(tune_key(routine, s) != keys[c])
+                    continue;
+
+                tune_problem<T> problem(handle, routine, s);
+                std::vector<double> times;
+                std::vector<rocblas_int> values = best[c];
+                for(rocblas_int v : candidates)
+                {
+                    values[p] = v;
+                    tune_set(handle, precision, routine.params, values);
+                    times.push_back(problem.time(iters));
+                }
+
+                double tmin = *std::min_element(times.begin(), times.end());
+                for(size_t v = 0; v < candidates.size(); ++v)
+                {
+                    score[v] += times[v] / tmin;
+                    if(verbose)
+                        rocblas_cout << routine.name << " " << tune_names.at(routine.params[p])
+                                     << " = " << candidates[v] << "  m = " << s.m
+                                     << "  n = " << s.n << "  batch_count = " << s.bc << ": "
+                                     << times[v] << " us" << std::endl;
+                }
+            }
+
+            best[c][p] = candidates[std::min_element(score.begin(), score.end()) - score.begin()];
+        }
+    }
+    CHECK_ROCBLAS_ERROR(rocsolver_reset_tuning(handle));
+
+    // each class extends halfway to its neighbours; consecutive classes with
+    // the same value are merged
+    std::vector<tune_entry> entries;
+    for(size_t p = 0; p < nparams; ++p)
+    {
+        for(size_t c = 0; c < keys.size(); ++c)
+        {
+            rocblas_int lo = (c == 0) ? 0 : (keys[c - 1] + keys[c]) / 2 + 1;
+            rocblas_int hi = (c == keys.size() - 1) ? -1 : (keys[c] + keys[c + 1]) / 2;
+            if(!entries.empty() && entries.back().param == routine.params[p]
+               && entries.back().value == best[c][p])
+                entries.back().max_size = hi;
+            else
+                entries.push_back({routine.params[p], lo, hi, best[c][p]});
+        }
+    }
+
+    return entries;
+}
+
+int main(int argc, char* argv[])
+try
+{
+    std::string functions, precisions, sizem, sizen, batch, factors, output;
+    rocblas_int iters, device_id;
+    bool verbose;
+
+    // clang-format off
+    po::options_description desc("rocsolver tuning command line options");
+    desc.add_options()("help,h", "produces this help message")
+
+        ("function,f",
+         po::value<std::string>(&functions)->default_value(
+            "getrf,potrf,geqrf,gelqf,orgqr,ormqr,getri,gebrd"),
+         "Comma-separated list of the routines to tune")
+
+        ("precision,r",
+         po::value<std::string>(&precisions)->default_value("sdcz"),
+         "Precisions to tune: s, d, c and/or z")
+
+        ("sizem,m",
+         po::value<std::string>(&sizem)->default_value("64,128,256,512,1024,2048"),
+         "Comma-separated list of the row sizes of the grid")
+
+        ("sizen,n",
+         po::value<std::string>(&sizen)->default_value(""),
+         "Comma-separated list of the column sizes of the grid "
+         "(if empty, only square matrices with the sizes given in m are used)")
+
+        ("batch",
+         po::value<std::string>(&batch)->default_value("1"),
+         "Comma-separated list of the batch counts of the grid "
+         "(only used by the routines with batched versions)")
+
+        ("factors",
+         po::value<std::string>(&factors)->default_value("0.25,0.5,1,2,4"),
+         "Candidate values of each parameter, as multiples of its compiled default")
+
+        ("iters,i",
+         po::value<rocblas_int>(&iters)->default_value(5),
+         "Iterations to run for each candidate value (the median time is used)")
+
+        ("device",
+         po::value<rocblas_int>(&device_id)->default_value(0),
+         "Device to be tuned")
+
+        ("output,o",
+         po::value<std::string>(&output)->default_value("rocsolver-tuning.txt"),
+         "Name of the tuning file to write")
+
+        ("verbose,v",
+         po::bool_switch(&verbose)->default_value(false),
+         "Prints the time of every candidate value");
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    // print help message
+    if(vm.count("help"))
+    {
+        rocblas_cout << desc << std::endl;
+        return 0;
+    }
+
+    // catch invalid arguments for:
+
+    // routines
+    std::vector<const tune_routine*> routines;
+    std::istringstream fin(functions);
+    std::string function;
+    while(std::getline(fin, function, ','))
+    {
+        auto it = std::find_if(tune_routines.begin(), tune_routines.end(),
+                               [&](const tune_routine& r) { return function == r.name; });
+        if(it == tune_routines.end())
+            throw std::invalid_argument("Invalid value for --function");
+        routines.push_back(&*it);
+    }
+
+    // precisions
+    if(precisions.empty() || precisions.find_first_not_of("sdcz") != std::string::npos)
+        throw std::invalid_argument("Invalid value for --precision");
+
+    // grid
+    std::vector<rocblas_int> ms = parse_list<rocblas_int>(sizem, "--sizem");
+    std::vector<rocblas_int> ns = parse_list<rocblas_int>(sizen, "--sizen");
+    std::vector<rocblas_int> bcs = parse_list<rocblas_int>(batch, "--batch");
+    std::vector<double> fs = parse_list<double>(factors, "--factors");
+    if(ms.empty() || bcs.empty() || fs.empty())
+        throw std::invalid_argument("Empty grid or candidate list");
+
+    std::vector<tune_size> grid;
+    for(rocblas_int bc : bcs)
+        for(rocblas_int m : ms)
+            for(rocblas_int n : (ns.empty() ? std::vector<rocblas_int>{m} : ns))
+                grid.push_back({m, n, bc});
+
+    // iterations
+    if(iters < 1)
+        throw std::invalid_argument("Invalid value for --iters");
+
+    // deviceID
+    rocblas_int device_count = query_device_property();
+    if(device_count <= device_id)
+        throw std::invalid_argument("Invalid Device ID");
+    set_device(device_id);
+
+    hipDeviceProp_t prop;
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&prop, device_id));
+    std::string arch = prop.gcnArchName;
+    arch = arch.substr(0, arch.find(':'));
+
+    std::ofstream out(output);
+    if(!out)
+        throw std::invalid_argument("Cannot write to the file given by --output");
+
+    out << "# rocsolver tuning table for " << arch << " (generated by rocsolver-tune)\n";
+    out << "# arch  precision  parameter  min_size  max_size  value\n";
+
+    // tune and write the entries
+    rocblas_local_handle handle;
+    for(char precision : precisions)
+    {
+        for(const tune_routine* routine : routines)
+        {
+            rocblas_cout << "tuning " << precision << routine->name << "..." << std::endl;
+
+            rocblas_datatype dt = string2rocblas_datatype(std::string(1, precision));
+            std::vector<tune_entry> entries;
+            if(precision == 's')
+                entries = tune<float>(handle, dt, *routine, grid, fs, iters, verbose);
+            else if(precision == 'd')
+                entries = tune<double>(handle, dt, *routine, grid, fs, iters, verbose);
+            else if(precision == 'c')
+                entries = tune<rocblas_float_complex>(handle, dt, *routine, grid, fs, iters,
+                                                      verbose);
+            else
+                entries = tune<rocblas_double_complex>(handle, dt, *routine, grid, fs, iters,
+                                                       verbose);
+
+            for(const auto& e : entries)
+            {
+                out << arch << " " << precision << " " << tune_names.at(e.param) << " "
+                    << e.min_size << " ";
+                if(e.max_size < 0)
+                    out << "*";
+                else
+                    out << e.max_size;
+                out << " " << e.value << "\n";
+            }
+        }
+    }
+
+    rocblas_cout << "tuning table written to " << output << std::endl;
+    return 0;
+}
+
+catch(const std::invalid_argument& exp)
+{
+    rocblas_cerr << exp.what() << std::endl;
+    return -1;
+}
@@ -39,6 +39,7 @@ const vector<vector<int>> size_range = {
     {20, 0, 0, 15},
     {30, 30, 50, 0},
     {50, 60, 20, 0},
+    {2, 0, 0, 0},
     {70, 0, 0, 0}};
 
 const vector<vector<int>> opt_range = {
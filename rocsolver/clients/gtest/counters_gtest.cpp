@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_getf2_getrf.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// the counters are checked on getrf with the unblocked and the blocked algorithm
+const vector<int> size_range = {20, 300};
+
+class COUNTERS : public ::TestWithParam<int>
+{
+protected:
+    COUNTERS() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(COUNTERS, bad_arg)
+{
+    rocblas_local_handle handle;
+    rocsolver_call_counters counters;
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_call_counters(nullptr, &counters),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_call_counters(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // the counters are kept by the calling thread for its last call, so a call
+    // made with another handle leaves those of this handle at zero
+    rocblas_local_handle other;
+    rocblas_int n = GetParam();
+    rocblas_int lda = n;
+    rocblas_stride stA = lda * n;
+    rocblas_stride stP = n;
+    rocblas_int bc = 1;
+
+    host_strided_batch_vector<double> hA(stA, 1, stA, bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(stP, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hinfo(1, 1, 1, bc);
+    device_strided_batch_vector<double> dA(stA, 1, stA, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(stP, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    getf2_getrf_initData<true, true, double>(other, n, n, dA, lda, stA, dIpiv, stP, dinfo, bc, hA,
+                                             hIpiv, hinfo);
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(other, n, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_call_counters(other, &counters));
+    EXPECT_GT(counters.kernel_launches, 0);
+
+    // no call has been made with the handle
+    CHECK_ROCBLAS_ERROR(rocsolver_get_call_counters(handle, &counters));
+    EXPECT_EQ(counters.kernel_launches, 0);
+    EXPECT_EQ(counters.rocblas_calls, 0);
+    EXPECT_EQ(counters.memcpys, 0);
+    EXPECT_EQ(counters.allocations, 0);
+}
+
+TEST_P(COUNTERS, getrf)
+{
+    rocblas_local_handle handle;
+    rocblas_int n = GetParam();
+    rocblas_int lda = n;
+    rocblas_stride stA = lda * n;
+    rocblas_stride stP = n;
+    rocblas_int bc = 1;
+
+    host_strided_batch_vector<double> hA(stA, 1, stA, bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(stP, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hinfo(1, 1, 1, bc);
+    device_strided_batch_vector<double> dA(stA, 1, stA, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(stP, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    rocsolver_call_counters first, second, query;
+    getf2_getrf_initData<true, true, double>(handle, n, n, dA, lda, stA, dIpiv, stP, dinfo, bc, hA,
+                                             hIpiv, hinfo);
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(handle, n, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_call_counters(handle, &first));
+
+    EXPECT_GT(first.kernel_launches, 0);
+    EXPECT_EQ(first.memcpys, 0);
+    if(n > 64)
+        EXPECT_GT(first.rocblas_calls, 0);
+
+    // the same call makes the same launches, and reuses the device memory
+    getf2_getrf_initData<false, true, double>(handle, n, n, dA, lda, stA, dIpiv, stP, dinfo, bc,
+                                              hA, hIpiv, hinfo);
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(handle, n, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_call_counters(handle, &second));
+
+    EXPECT_EQ(second.kernel_launches, first.kernel_launches);
+    EXPECT_EQ(second.rocblas_calls, first.rocblas_calls);
+    EXPECT_EQ(second.memcpys, first.memcpys);
+    EXPECT_EQ(second.allocations, 0);
+
+    // workspace size queries and invalid calls are not counted
+    size_t size;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_dgetrf(handle, n, n, dA.data(), lda, dIpiv.data(), dinfo.data()));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    EXPECT_ROCBLAS_STATUS(rocsolver_dgetrf(handle, n, n, (double*)nullptr, lda, dIpiv.data(),
+                                           dinfo.data()),
+                          rocblas_status_invalid_pointer);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_call_counters(handle, &query));
+
+    EXPECT_EQ(query.kernel_launches, second.kernel_launches);
+    EXPECT_EQ(query.rocblas_calls, second.rocblas_calls);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, COUNTERS, ValuesIn(size_range));
@@ -0,0 +1,361 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> gesv_tuple;
+
+// each A_range vector is a {N, lda, ldb};
+
+// each B_range value is a nrhs;
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_sizeA_range = {
+    // quick return
+    {0, 1, 1},
+    // invalid
+    {-1, 1, 1},
+    {10, 2, 10},
+    {10, 10, 2},
+    /// normal (valid) samples
+    // (with the fused kernel of small sizes)
+    {8, 8, 8},
+    {20, 20, 20},
+    {30, 50, 30},
+    {64, 64, 70},
+    // (with GETRF and GETRS)
+    {70, 80, 70}};
+const vector<int> matrix_sizeB_range = {
+    // quick return
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    1,
+    10,
+    17,
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_sizeA_range
+    = {{192, 192, 192}, {600, 700, 645}, {1000, 1000, 1000}};
+const vector<int> large_matrix_sizeB_range = {
+    1, 100, 524,
+};
+
+// for singular matrices (checkin_lapack tests)
+const vector<vector<int>> singular_matrix_sizeA_range = {
+    // (with the fused kernel of small sizes)
+    {20, 20, 20},
+    // (with GETRF and GETRS)
+    {70, 80, 70}};
+const vector<int> singular_matrix_sizeB_range = {
+    1,
+    17,
+};
+
+Arguments gesv_setup_arguments(gesv_tuple tup)
+{
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    int nrhs = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_sizeA[0];
+    arg.N = nrhs;
+    arg.lda = matrix_sizeA[1];
+    arg.ldb = matrix_sizeA[2];
+
+    arg.timing = 0;
+
+    // only testing standard use case for strides
+    // strides are ignored in normal and batched tests
+    arg.bsp = arg.M;
+    arg.bsa = arg.lda * arg.M;
+    arg.bsb = arg.ldb * arg.N;
+
+    return arg;
+}
+
+class GESV : public ::TestWithParam<gesv_tuple>
+{
+protected:
+    GESV() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// with singular matrices (all of them in the non-batch tests, and the one in
+// the middle of the batch otherwise), the solution is not computed, and B must
+// be left unchanged
+class GESV_SINGULAR : public ::TestWithParam<gesv_tuple>
+{
+protected:
+    GESV_SINGULAR() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// non-batch tests
+
+TEST_P(GESV, __float)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false, false, float>();
+
+    arg.batch_count = 1;
+    testing_gesv<false, false, float>(arg);
+}
+
+TEST_P(GESV, __double)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false, false, double>();
+
+    arg.batch_count = 1;
+    testing_gesv<false, false, double>(arg);
+}
+
+TEST_P(GESV, __float_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false, false, rocblas_float_complex>();
+
+    arg.batch_count = 1;
+    testing_gesv<false, false, rocblas_float_complex>(arg);
+}
+
+TEST_P(GESV, __double_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false, false, rocblas_double_complex>();
+
+    arg.batch_count = 1;
+    testing_gesv<false, false, rocblas_double_complex>(arg);
+}
+
+// batched tests
+
+TEST_P(GESV, batched__float)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<true, true, float>();
+
+    arg.batch_count = 3;
+    testing_gesv<true, true, float>(arg);
+}
+
+TEST_P(GESV, batched__double)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<true, true, double>();
+
+    arg.batch_count = 3;
+    testing_gesv<true, true, double>(arg);
+}
+
+TEST_P(GESV, batched__float_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<true, true, rocblas_float_complex>();
+
+    arg.batch_count = 3;
+    testing_gesv<true, true, rocblas_float_complex>(arg);
+}
+
+TEST_P(GESV, batched__double_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<true, true, rocblas_double_complex>();
+
+    arg.batch_count = 3;
+    testing_gesv<true, true, rocblas_double_complex>(arg);
+}
+
+// strided_batched tests
+
+TEST_P(GESV, strided_batched__float)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false, true, float>();
+
+    arg.batch_count = 3;
+    testing_gesv<false, true, float>(arg);
+}
+
+TEST_P(GESV, strided_batched__double)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false, true, double>();
+
+    arg.batch_count = 3;
+    testing_gesv<false, true, double>(arg);
+}
+
+TEST_P(GESV, strided_batched__float_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false, true, rocblas_float_complex>();
+
+    arg.batch_count = 3;
+    testing_gesv<false, true, rocblas_float_complex>(arg);
+}
+
+TEST_P(GESV, strided_batched__double_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    if(arg.M == 0 && arg.N == 0)
+        testing_gesv_bad_arg<false, true, rocblas_double_complex>();
+
+    arg.batch_count = 3;
+    testing_gesv<false, true, rocblas_double_complex>(arg);
+}
+
+// singular matrix tests
+
+TEST_P(GESV_SINGULAR, __float)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_gesv<false, false, float>(arg, true);
+}
+
+TEST_P(GESV_SINGULAR, __double)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_gesv<false, false, double>(arg, true);
+}
+
+TEST_P(GESV_SINGULAR, __float_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_gesv<false, false, rocblas_float_complex>(arg, true);
+}
+
+TEST_P(GESV_SINGULAR, __double_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_gesv<false, false, rocblas_double_complex>(arg, true);
+}
+
+TEST_P(GESV_SINGULAR, batched__float)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesv<true, true, float>(arg, true);
+}
+
+TEST_P(GESV_SINGULAR, batched__double)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesv<true, true, double>(arg, true);
+}
+
+TEST_P(GESV_SINGULAR, batched__float_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesv<true, true, rocblas_float_complex>(arg, true);
+}
+
+TEST_P(GESV_SINGULAR, batched__double_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesv<true, true, rocblas_double_complex>(arg, true);
+}
+
+TEST_P(GESV_SINGULAR, strided_batched__float)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesv<false, true, float>(arg, true);
+}
+
+TEST_P(GESV_SINGULAR, strided_batched__double)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesv<false, true, double>(arg, true);
+}
+
+TEST_P(GESV_SINGULAR, strided_batched__float_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesv<false, true, rocblas_float_complex>(arg, true);
+}
+
+TEST_P(GESV_SINGULAR, strided_batched__double_complex)
+{
+    Arguments arg = gesv_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesv<false, true, rocblas_double_complex>(arg, true);
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GESV,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESV,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESV_SINGULAR,
+                         Combine(ValuesIn(singular_matrix_sizeA_range),
+                                 ValuesIn(singular_matrix_sizeB_range)));
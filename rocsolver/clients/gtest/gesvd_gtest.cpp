@@ -69,7 +69,9 @@ const vector<vector<int>> opt_range = {
 
 // for daily_lapack tests
 const vector<vector<int>> large_size_range
-    = {{120, 100, 0}, {300, 120, 0}, {300, 120, 1}, {100, 120, 0}, {120, 300, 0}, {120, 300, 1}};
+    = {{120, 100, 0}, {300, 120, 0}, {300, 120, 1}, {100, 120, 0}, {120, 300, 0},
+       {120, 300, 1}, {1000, 20, 0}, {1000, 20, 1}, {20, 1000, 0}, {20, 1000, 1},
+       {200, 150, 1}, {150, 200, 1}};
 
 const vector<vector<int>> large_opt_range
     = {{0, 0, 0, 3, 3}, {1, 0, 0, 0, 1}, {0, 1, 0, 1, 0}, {0, 0, 1, 1, 1},
@@ -140,6 +142,27 @@ protected:
     virtual void TearDown() {}
 };
 
+// the divide and conquer computation of the singular vectors (bdsdc) is
+// tested on all the sizes by setting its crossover point to 1
+class GESVD_BDSDC : public ::TestWithParam<gesvd_tuple>
+{
+protected:
+    GESVD_BDSDC() {}
+    virtual void SetUp()
+    {
+        rocblas_local_handle handle;
+        for(rocblas_datatype prec : {rocblas_datatype_f32_r, rocblas_datatype_f64_r,
+                                     rocblas_datatype_f32_c, rocblas_datatype_f64_c})
+            CHECK_ROCBLAS_ERROR(rocsolver_set_tuning_parameter(
+                handle, rocsolver_tuning_gesvd_bdsdc_switchsize, prec, 0, -1, 1));
+    }
+    virtual void TearDown()
+    {
+        rocblas_local_handle handle;
+        CHECK_ROCBLAS_ERROR(rocsolver_reset_tuning(handle));
+    }
+};
+
 // non-batch tests
 
 TEST_P(GESVD, __float)
@@ -278,6 +301,72 @@ TEST_P(GESVD, strided_batched__double_complex)
     testing_gesvd<false, true, rocblas_double_complex>(arg);
 }
 
+// divide and conquer tests
+
+TEST_P(GESVD_BDSDC, _float)
+{
+    Arguments arg = gesvd_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_gesvd<false, false, float>(arg);
+}
+
+TEST_P(GESVD_BDSDC, _double)
+{
+    Arguments arg = gesvd_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_gesvd<false, false, double>(arg);
+}
+
+TEST_P(GESVD_BDSDC, _float_complex)
+{
+    Arguments arg = gesvd_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_gesvd<false, false, rocblas_float_complex>(arg);
+}
+
+TEST_P(GESVD_BDSDC, _double_complex)
+{
+    Arguments arg = gesvd_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_gesvd<false, false, rocblas_double_complex>(arg);
+}
+
+TEST_P(GESVD_BDSDC, strided_batched__float)
+{
+    Arguments arg = gesvd_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesvd<false, true, float>(arg);
+}
+
+TEST_P(GESVD_BDSDC, strided_batched__double)
+{
+    Arguments arg = gesvd_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesvd<false, true, double>(arg);
+}
+
+TEST_P(GESVD_BDSDC, strided_batched__float_complex)
+{
+    Arguments arg = gesvd_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesvd<false, true, rocblas_float_complex>(arg);
+}
+
+TEST_P(GESVD_BDSDC, strided_batched__double_complex)
+{
+    Arguments arg = gesvd_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_gesvd<false, true, rocblas_double_complex>(arg);
+}
+
 // daily_lapack tests normal execution with medium to large sizes
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GESVD,
@@ -286,3 +375,7 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 // checkin_lapack tests normal execution with small sizes, invalid sizes,
 // quick returns, and corner cases
 INSTANTIATE_TEST_SUITE_P(checkin_lapack, GESVD, Combine(ValuesIn(size_range), ValuesIn(opt_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESVD_BDSDC,
+                         Combine(ValuesIn(size_range), ValuesIn(opt_range)));
@@ -56,6 +56,29 @@ const vector<int> large_n_size_range = {
     45, 64, 520, 1024, 2000,
 };
 
+// for tournament pivoting tests (tall matrices)
+// (with panels of 64 columns, the candidates of more than 4 blocks of 256 rows
+// are reduced in more than one level of the tree)
+const vector<vector<int>> tslu_matrix_size_range = {
+    {300, 300},
+    {1100, 1100},
+};
+
+const vector<int> tslu_n_size_range = {
+    20,
+    64,
+    100,
+};
+
+const vector<vector<int>> large_tslu_matrix_size_range = {
+    {1500, 1500},
+    {4500, 4500},
+};
+
+const vector<int> large_tslu_n_size_range = {
+    16, 64, 100,
+};
+
 Arguments getrf_setup_arguments(getrf_tuple tup)
 {
     vector<int> matrix_size = std::get<0>(tup);
@@ -93,6 +116,50 @@ protected:
     virtual void TearDown() {}
 };
 
+// the look-ahead variant of the blocked algorithm is tested on all the sizes
+// by setting its crossover point to 1
+class GETRF_LOOKAHEAD : public ::TestWithParam<getrf_tuple>
+{
+protected:
+    GETRF_LOOKAHEAD() {}
+    virtual void SetUp()
+    {
+        rocblas_local_handle handle;
+        for(rocblas_datatype prec : {rocblas_datatype_f32_r, rocblas_datatype_f64_r,
+                                     rocblas_datatype_f32_c, rocblas_datatype_f64_c})
+            CHECK_ROCBLAS_ERROR(rocsolver_set_tuning_parameter(
+                handle, rocsolver_tuning_getrf_lookahead_switchsize, prec, 0, -1, 1));
+    }
+    virtual void TearDown()
+    {
+        rocblas_local_handle handle;
+        CHECK_ROCBLAS_ERROR(rocsolver_reset_tuning(handle));
+    }
+};
+
+// tournament pivoting is tested by enabling it on all the sizes
+// (the test matrices are not diagonally dominant, so the selected pivots can
+// differ from those of partial pivoting; the factorization is checked by its
+// residual instead)
+class GETRF_TSLU : public ::TestWithParam<getrf_tuple>
+{
+protected:
+    GETRF_TSLU() {}
+    virtual void SetUp()
+    {
+        rocblas_local_handle handle;
+        for(rocblas_datatype prec : {rocblas_datatype_f32_r, rocblas_datatype_f64_r,
+                                     rocblas_datatype_f32_c, rocblas_datatype_f64_c})
+            CHECK_ROCBLAS_ERROR(rocsolver_set_tuning_parameter(
+                handle, rocsolver_tuning_getrf_tslu_switchsize, prec, 0, -1, 1));
+    }
+    virtual void TearDown()
+    {
+        rocblas_local_handle handle;
+        CHECK_ROCBLAS_ERROR(rocsolver_reset_tuning(handle));
+    }
+};
+
 class GETF2_NPVT : public ::TestWithParam<getrf_tuple>
 {
 protected:
@@ -640,6 +707,136 @@ TEST_P(GETRF, strided_batched__double_complex)
     testing_getf2_getrf<false, true, 1, rocblas_double_complex>(arg);
 }
 
+// look-ahead tests
+TEST_P(GETRF_LOOKAHEAD, __float)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_getf2_getrf<false, false, 1, float>(arg);
+}
+
+TEST_P(GETRF_LOOKAHEAD, __double)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_getf2_getrf<false, false, 1, double>(arg);
+}
+
+TEST_P(GETRF_LOOKAHEAD, __float_complex)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_getf2_getrf<false, false, 1, rocblas_float_complex>(arg);
+}
+
+TEST_P(GETRF_LOOKAHEAD, __double_complex)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_getf2_getrf<false, false, 1, rocblas_double_complex>(arg);
+}
+
+TEST_P(GETRF_LOOKAHEAD, strided_batched__float)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_getf2_getrf<false, true, 1, float>(arg);
+}
+
+TEST_P(GETRF_LOOKAHEAD, strided_batched__double)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_getf2_getrf<false, true, 1, double>(arg);
+}
+
+TEST_P(GETRF_LOOKAHEAD, strided_batched__float_complex)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_getf2_getrf<false, true, 1, rocblas_float_complex>(arg);
+}
+
+TEST_P(GETRF_LOOKAHEAD, strided_batched__double_complex)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_getf2_getrf<false, true, 1, rocblas_double_complex>(arg);
+}
+
+// tournament pivoting tests
+TEST_P(GETRF_TSLU, __float)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_getf2_getrf<false, false, 1, float>(arg, false);
+}
+
+TEST_P(GETRF_TSLU, __double)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_getf2_getrf<false, false, 1, double>(arg, false);
+}
+
+TEST_P(GETRF_TSLU, __float_complex)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_getf2_getrf<false, false, 1, rocblas_float_complex>(arg, false);
+}
+
+TEST_P(GETRF_TSLU, __double_complex)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 1;
+    testing_getf2_getrf<false, false, 1, rocblas_double_complex>(arg, false);
+}
+
+TEST_P(GETRF_TSLU, strided_batched__float)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_getf2_getrf<false, true, 1, float>(arg, false);
+}
+
+TEST_P(GETRF_TSLU, strided_batched__double)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_getf2_getrf<false, true, 1, double>(arg, false);
+}
+
+TEST_P(GETRF_TSLU, strided_batched__float_complex)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_getf2_getrf<false, true, 1, rocblas_float_complex>(arg, false);
+}
+
+TEST_P(GETRF_TSLU, strided_batched__double_complex)
+{
+    Arguments arg = getrf_setup_arguments(GetParam());
+
+    arg.batch_count = 3;
+    testing_getf2_getrf<false, true, 1, rocblas_double_complex>(arg, false);
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GETF2_NPVT,
                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
@@ -671,3 +868,20 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GETRF,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_LOOKAHEAD,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_LOOKAHEAD,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_TSLU,
+                         Combine(ValuesIn(large_tslu_matrix_size_range),
+                                 ValuesIn(large_tslu_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_TSLU,
+                         Combine(ValuesIn(tslu_matrix_size_range), ValuesIn(tslu_n_size_range)));
@@ -32,10 +32,12 @@ const vector<vector<int>> matrix_sizeA_range = {
     {10, 2, 10},
     {10, 10, 2},
     /// normal (valid) samples
+    {1, 1, 1},
     {20, 20, 20},
     {30, 50, 30},
     {30, 30, 50},
-    {50, 60, 60}};
+    {50, 60, 60},
+    {64, 64, 64}};
 const vector<vector<int>> matrix_sizeB_range = {
     // quick return
     {0, 0},
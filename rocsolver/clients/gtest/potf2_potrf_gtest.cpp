@@ -33,6 +33,7 @@ const vector<vector<int>> matrix_size_range = {
     {10, 10},
     {20, 30},
     {50, 50},
+    {64, 70},
     {70, 80}};
 
 // for daily_lapack tests
@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_test.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each precision is tested on its own
+const vector<rocblas_datatype> precision_range = {rocblas_datatype_f32_r, rocblas_datatype_f64_r,
+                                                  rocblas_datatype_f32_c, rocblas_datatype_f64_c};
+
+class TUNING : public ::TestWithParam<rocblas_datatype>
+{
+protected:
+    TUNING() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(TUNING, bad_arg)
+{
+    rocblas_local_handle handle;
+    rocblas_datatype prec = GetParam();
+    rocblas_int value;
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_get_tuning_parameter(nullptr, rocsolver_tuning_getrf_switchsize, prec, 0, &value),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_tuning_parameter(nullptr, rocsolver_tuning_getrf_switchsize, prec, 0, -1, 1),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_load_tuning_file(nullptr, "tuning.txt"),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_reset_tuning(nullptr), rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_tuning_parameter(handle, rocsolver_tuning_param(0), prec,
+                                                         0, &value),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_tuning_parameter(handle, rocsolver_tuning_getrf_switchsize,
+                                                         rocblas_datatype_i32_r, 0, &value),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_tuning_parameter(handle, rocsolver_tuning_getrf_switchsize, prec, 0, -1, 0),
+        rocblas_status_invalid_value);
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_get_tuning_parameter(handle, rocsolver_tuning_getrf_switchsize, prec, -1, &value),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_tuning_parameter(handle, rocsolver_tuning_getrf_switchsize, prec, 10, 5, 1),
+        rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_get_tuning_parameter(handle, rocsolver_tuning_getrf_switchsize, prec, 0, nullptr),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_load_tuning_file(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+}
+
+TEST_P(TUNING, set_get_reset)
+{
+    rocblas_local_handle handle;
+    rocblas_datatype prec = GetParam();
+    rocblas_datatype other
+        = (prec == rocblas_datatype_f64_r) ? rocblas_datatype_f32_r : rocblas_datatype_f64_r;
+    rocblas_int value, dflt, dflt_other;
+
+    CHECK_ROCBLAS_ERROR(rocsolver_reset_tuning(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_tuning_parameter(handle, rocsolver_tuning_potrf_switchsize,
+                                                       prec, 100, &dflt));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_tuning_parameter(handle, rocsolver_tuning_potrf_switchsize,
+                                                       other, 100, &dflt_other));
+    EXPECT_GE(dflt, 1);
+
+    // new value only applies to the given sizes and precision
+    CHECK_ROCBLAS_ERROR(rocsolver_set_tuning_parameter(handle, rocsolver_tuning_potrf_switchsize,
+                                                       prec, 50, 150, dflt + 7));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_tuning_parameter(handle, rocsolver_tuning_potrf_switchsize,
+                                                       prec, 100, &value));
+    EXPECT_EQ(value, dflt + 7);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_tuning_parameter(handle, rocsolver_tuning_potrf_switchsize,
+                                                       prec, 151, &value));
+    EXPECT_EQ(value, dflt);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_tuning_parameter(handle, rocsolver_tuning_potrf_switchsize,
+                                                       other, 100, &value));
+    EXPECT_EQ(value, dflt_other);
+
+    // the last entry wins
+    CHECK_ROCBLAS_ERROR(rocsolver_set_tuning_parameter(handle, rocsolver_tuning_potrf_switchsize,
+                                                       prec, 0, -1, dflt + 3));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_tuning_parameter(handle, rocsolver_tuning_potrf_switchsize,
+                                                       prec, 100, &value));
+    EXPECT_EQ(value, dflt + 3);
+
+    // back to the compiled defaults
+    CHECK_ROCBLAS_ERROR(rocsolver_reset_tuning(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_tuning_parameter(handle, rocsolver_tuning_potrf_switchsize,
+                                                       prec, 100, &value));
+    EXPECT_EQ(value, dflt);
+
+    // a missing file adds no entries
+    EXPECT_ROCBLAS_STATUS(rocsolver_load_tuning_file(handle, "/nonexistent/rocsolver-tuning.txt"),
+                          rocblas_status_invalid_value);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, TUNING, ValuesIn(precision_range));
@@ -465,6 +465,84 @@ inline rocblas_status rocsolver_bdsqr(rocblas_handle handle,
 }
 /***************************************************************/
 
+/******************** BDSDC ********************/
+inline rocblas_status rocsolver_bdsdc(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nv,
+                                      rocblas_int nu,
+                                      rocblas_int nc,
+                                      float* D,
+                                      float* E,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      float* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_sbdsdc(handle, uplo, n, nv, nu, nc, D, E, V, ldv, U, ldu, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_bdsdc(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nv,
+                                      rocblas_int nu,
+                                      rocblas_int nc,
+                                      double* D,
+                                      double* E,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      double* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_dbdsdc(handle, uplo, n, nv, nu, nc, D, E, V, ldv, U, ldu, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_bdsdc(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nv,
+                                      rocblas_int nu,
+                                      rocblas_int nc,
+                                      float* D,
+                                      float* E,
+                                      rocblas_float_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_float_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_float_complex* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_cbdsdc(handle, uplo, n, nv, nu, nc, D, E, V, ldv, U, ldu, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_bdsdc(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nv,
+                                      rocblas_int nu,
+                                      rocblas_int nc,
+                                      double* D,
+                                      double* E,
+                                      rocblas_double_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_double_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_double_complex* C,
+                                      rocblas_int ldc,
+                                      rocblas_int* info)
+{
+    return rocsolver_zbdsdc(handle, uplo, n, nv, nu, nc, D, E, V, ldv, U, ldu, C, ldc, info);
+}
+/***************************************************************/
+
 /******************** LABRD ********************/
 inline rocblas_status rocsolver_labrd(rocblas_handle handle,
                                       rocblas_int m,
@@ -1959,6 +2037,162 @@ inline rocblas_status rocsolver_getrs(bool STRIDED,
 }
 /********************************************************/
 
+/******************** GESV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_sgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_dgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_cgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_zgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_sgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_dgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_cgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+/********************************************************/
+
 /******************** GETRI ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_getri(bool STRIDED,
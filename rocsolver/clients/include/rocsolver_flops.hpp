@@ -0,0 +1,236 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCSOLVER_FLOPS_HPP
+#define ROCSOLVER_FLOPS_HPP
+
+#include "clientcommon.hpp"
+#include <algorithm>
+
+/*******************************************************************************
+ * Floating point operation counts of the LAPACK routines, from the counts of
+ * multiplications and additions given in LAPACK Working Note 41. A complex
+ * multiplication counts as 6 real operations and a complex addition as 2.
+ *
+ * The byte counts are the memory traffic that cannot be avoided: every input is
+ * read once and every output is written once. Together with the flop counts
+ * they tell whether a problem is compute bound, bandwidth bound or bound by the
+ * latency of the launches.
+ *
+ * The counts are for a single problem of the batch.
+ ******************************************************************************/
+
+template <typename T>
+inline double flops_from_ops(double fmuls, double fadds)
+{
+    return is_complex<T> ? 6 * fmuls + 2 * fadds : fmuls + fadds;
+}
+
+template <typename T>
+inline double getrf_flop_count(double m, double n)
+{
+    double k = std::min(m, n);
+    double l = std::max(m, n);
+    double fmuls = 0.5 * k * (k * (l - k / 3 - 1) + l) + 2 * k / 3;
+    double fadds = 0.5 * k * (k * (l - k / 3) - l) + k / 6;
+    return flops_from_ops<T>(fmuls, fadds);
+}
+
+template <typename T>
+inline double getrs_flop_count(double n, double nrhs)
+{
+    double fmuls = nrhs * n * n;
+    double fadds = nrhs * n * (n - 1);
+    return flops_from_ops<T>(fmuls, fadds);
+}
+
+// (factorization and solution)
+template <typename T>
+inline double gesv_flop_count(double n, double nrhs)
+{
+    return getrf_flop_count<T>(n, n) + getrs_flop_count<T>(n, nrhs);
+}
+
+template <typename T>
+inline double getri_flop_count(double n)
+{
+    double fmuls = n * (5.0 / 6 + n * (2 * n / 3 + 0.5));
+    double fadds = n * (5.0 / 6 + n * (2 * n / 3 - 1.5));
+    return flops_from_ops<T>(fmuls, fadds);
+}
+
+template <typename T>
+inline double potrf_flop_count(double n)
+{
+    double fmuls = n * ((n / 6 + 0.5) * n + 1.0 / 3);
+    double fadds = n * (n / 6 * n - 1.0 / 6);
+    return flops_from_ops<T>(fmuls, fadds);
+}
+
+template <typename T>
+inline double geqrf_flop_count(double m, double n)
+{
+    double fmuls, fadds;
+    if(m > n)
+    {
+        fmuls = n * (n * (0.5 - n / 3 + m) + m + 23.0 / 6);
+        fadds = n * (n * (0.5 - n / 3 + m) + 5.0 / 6);
+    }
+    else
+    {
+        fmuls = m * (m * (-0.5 - m / 3 + n) + 2 * n + 23.0 / 6);
+        fadds = m * (m * (-0.5 - m / 3 + n) + n + 5.0 / 6);
+    }
+    return flops_from_ops<T>(fmuls, fadds);
+}
+
+template <typename T>
+inline double geqlf_flop_count(double m, double n)
+{
+    return geqrf_flop_count<T>(m, n);
+}
+
+template <typename T>
+inline double gelqf_flop_count(double m, double n)
+{
+    return geqrf_flop_count<T>(n, m);
+}
+
+// generation of the m-by-n matrix Q from k reflectors
+// (orglq generates the transpose)
+template <typename T>
+inline double orgqr_flop_count(double m, double n, double k)
+{
+    double fmuls = k * (2 * m * n + 2 * n - 5.0 / 3 + k * (2 * k / 3 - (m + n) - 1));
+    double fadds = k * (2 * m * n + n - m + 1.0 / 3 + k * (2 * k / 3 - (m + n)));
+    return flops_from_ops<T>(fmuls, fadds);
+}
+
+// application of k reflectors to an m-by-n matrix from the given side
+template <typename T>
+inline double ormqr_flop_count(bool left, double m, double n, double k)
+{
+    double fmuls, fadds;
+    if(left)
+    {
+        fmuls = 2 * n * m * k - n * k * k + 2 * n * k;
+        fadds = 2 * n * m * k - n * k * k + n * k;
+    }
+    else
+    {
+        fmuls = 2 * n * m * k - m * k * k + m * k + n * k - 0.5 * k * k + 0.5 * k;
+        fadds = 2 * n * m * k - m * k * k + m * k;
+    }
+    return flops_from_ops<T>(fmuls, fadds);
+}
+
+template <typename T>
+inline double gebrd_flop_count(double m, double n)
+{
+    double k = std::min(m, n);
+    double l = std::max(m, n);
+    double fmuls = k * (k * (2 - 2 * k / 3 + 2 * l) + 20.0 / 3);
+    double fadds = k * (k * (1 - 2 * k / 3 + 2 * l) - 1.0 / 3);
+    return flops_from_ops<T>(fmuls, fadds);
+}
+
+// (estimate: the reduction to bidiagonal form and the generation of the
+// requested singular vectors; the iterations of the bidiagonal QR algorithm
+// are not counted)
+template <typename T>
+inline double gesvd_flop_count(char left_svect, char right_svect, double m, double n)
+{
+    double k = std::min(m, n);
+    double flops = gebrd_flop_count<T>(m, n);
+    if(left_svect == 'A')
+        flops += orgqr_flop_count<T>(m, m, k);
+    else if(left_svect == 'S' || left_svect == 'O')
+        flops += orgqr_flop_count<T>(m, k, k);
+    if(right_svect == 'A')
+        flops += orgqr_flop_count<T>(n, n, k);
+    else if(right_svect == 'S' || right_svect == 'O')
+        flops += orgqr_flop_count<T>(n, k, k);
+    return flops;
+}
+
+/*******************************************************************************
+ * Byte counts
+ ******************************************************************************/
+
+template <typename T>
+inline double getrf_byte_count(double m, double n)
+{
+    return 2 * m * n * sizeof(T) + std::min(m, n) * sizeof(rocblas_int);
+}
+
+template <typename T>
+inline double getrs_byte_count(double n, double nrhs)
+{
+    return (n * n + 2 * n * nrhs) * sizeof(T) + n * sizeof(rocblas_int);
+}
+
+template <typename T>
+inline double gesv_byte_count(double n, double nrhs)
+{
+    return 2 * (n * n + n * nrhs) * sizeof(T) + n * sizeof(rocblas_int);
+}
+
+template <typename T>
+inline double getri_byte_count(double n)
+{
+    return 2 * n * n * sizeof(T) + n * sizeof(rocblas_int);
+}
+
+// (only the referenced triangle is read and written)
+template <typename T>
+inline double potrf_byte_count(double n)
+{
+    return n * (n + 1) * sizeof(T);
+}
+
+// (the same for gelqf and geqlf)
+template <typename T>
+inline double geqrf_byte_count(double m, double n)
+{
+    return (2 * m * n + std::min(m, n)) * sizeof(T);
+}
+
+template <typename T>
+inline double orgqr_byte_count(double m, double n, double k)
+{
+    return (m * k + k + m * n) * sizeof(T);
+}
+
+template <typename T>
+inline double ormqr_byte_count(bool left, double m, double n, double k)
+{
+    return ((left ? m : n) * k + k + 2 * m * n) * sizeof(T);
+}
+
+template <typename T>
+inline double gebrd_byte_count(double m, double n)
+{
+    using S = decltype(std::real(T{}));
+    double k = std::min(m, n);
+    return (2 * m * n + 2 * k) * sizeof(T) + (2 * k - 1) * sizeof(S);
+}
+
+template <typename T>
+inline double gesvd_byte_count(char left_svect, char right_svect, double m, double n)
+{
+    using S = decltype(std::real(T{}));
+    double k = std::min(m, n);
+    double elems = m * n;
+    if(left_svect == 'A')
+        elems += m * m;
+    else if(left_svect == 'S' || left_svect == 'O')
+        elems += m * k;
+    if(right_svect == 'A')
+        elems += n * n;
+    else if(right_svect == 'S' || right_svect == 'O')
+        elems += k * n;
+    return elems * sizeof(T) + k * sizeof(S);
+}
+
+#endif
@@ -5,14 +5,19 @@
 #ifndef S_TEST_H_
 #define S_TEST_H_
 
+#include <algorithm>
 #include <boost/format.hpp>
+#include <cmath>
 #include <cstdarg>
 #include <limits>
+#include <vector>
 
 #define ROCSOLVER_BENCH_INFORM(case)                                       \
     do                                                                     \
     {                                                                      \
-        if(case == 2)                                                      \
+        if(rocsolver_bench_last().recording)                               \
+            rocsolver_bench_last().inform = case;                          \
+        else if(case == 2)                                                 \
             rocblas_cout << "Invalid value in arguments ..." << std::endl; \
         else if(case == 1)                                                 \
             rocblas_cout << "Invalid size arguments..." << std::endl;      \
@@ -37,6 +42,54 @@ inline void rocsolver_test_check(double max_error, int tol)
 #endif
 }
 
+/*******************************************************************************
+ * When rocsolver-bench sweeps over problem sizes, the testing functions record
+ * their results in rocsolver_bench_last (or the case of ROCSOLVER_BENCH_INFORM
+ * when there are none) instead of printing them, and the client writes them as
+ * rows of CSV or JSON.
+ ******************************************************************************/
+struct rocsolver_bench_results
+{
+    bool recording = false;
+    bool recorded = false;
+    int inform = -1;
+    double cpu_time = 0;
+    double gpu_time = 0;
+    double error = 0;
+    double gflops = 0;
+    double gbps = 0;
+
+    // (see rocsolver_bench_timer)
+    double cold_time = 0;
+    double min_time = 0;
+    double p95_time = 0;
+};
+
+inline rocsolver_bench_results& rocsolver_bench_last()
+{
+    static rocsolver_bench_results results;
+    return results;
+}
+
+// (the rates are 0 for the functions without flop and byte counts)
+inline void rocsolver_bench_record(
+    double cpu_time, double gpu_time, double error, double gflops = 0, double gbps = 0)
+{
+    rocsolver_bench_results& results = rocsolver_bench_last();
+    results.recorded = true;
+    results.cpu_time = cpu_time;
+    results.gpu_time = gpu_time;
+    results.error = error;
+    results.gflops = gflops;
+    results.gbps = gbps;
+}
+
+// rate, in billions per second, of the given count done in time_us microseconds
+inline double rocsolver_bench_rate(double count, double time_us)
+{
+    return time_us > 0 ? count / (time_us * 1e3) : 0;
+}
+
 inline void rocsolver_bench_output()
 {
     // empty version
@@ -53,6 +106,180 @@ inline void rocsolver_bench_output(T arg, Ts... args)
     rocsolver_bench_output(args...);
 }
 
+// prints the counters of the last call made with the handle
+inline void rocsolver_bench_counters(rocblas_handle handle)
+{
+    rocsolver_call_counters counters;
+    if(rocsolver_get_call_counters(handle, &counters) != rocblas_status_success)
+        return;
+
+    rocblas_cout << "\n============================================\n";
+    rocblas_cout << "Counters (last call):\n";
+    rocblas_cout << "============================================\n";
+    rocsolver_bench_output("kernels", "rocblas_calls", "memcpys", "allocations");
+    rocsolver_bench_output(counters.kernel_launches, counters.rocblas_calls, counters.memcpys,
+                           counters.allocations);
+}
+
+/*******************************************************************************
+ * rocsolver_bench_handle is the handle of a benchmark: a new handle, or the
+ * handle shared by all the benchmarks of a suite run by rocsolver-bench (which
+ * keeps its device memory from one benchmark to the next).
+ ******************************************************************************/
+class rocsolver_bench_handle
+{
+    rocblas_handle m_handle;
+    bool m_shared;
+
+    static rocblas_handle& shared_handle()
+    {
+        static rocblas_handle handle = nullptr;
+        return handle;
+    }
+
+public:
+    // sets the handle shared by the next benchmarks (or nullptr to stop sharing)
+    static void share(rocblas_handle handle)
+    {
+        shared_handle() = handle;
+    }
+
+    rocsolver_bench_handle()
+        : m_handle(shared_handle())
+        , m_shared(shared_handle() != nullptr)
+    {
+        if(!m_shared)
+            rocblas_create_handle(&m_handle);
+    }
+
+    ~rocsolver_bench_handle()
+    {
+        if(!m_shared)
+            rocblas_destroy_handle(m_handle);
+    }
+
+    rocsolver_bench_handle(const rocsolver_bench_handle&) = delete;
+    rocsolver_bench_handle& operator=(const rocsolver_bench_handle&) = delete;
+
+    bool shared() const
+    {
+        return m_shared;
+    }
+
+    operator rocblas_handle&()
+    {
+        return m_handle;
+    }
+    operator const rocblas_handle&() const
+    {
+        return m_handle;
+    }
+};
+
+/*******************************************************************************
+ * rocsolver_bench_timer times the calls of a benchmark. The calls are marked
+ * with start() and stop(); the first two are the cold calls, and the rest are
+ * the hot calls.
+ *
+ * The first cold call is timed on the host, with a synchronization, as it
+ * includes the setup of the handle and of the kernels. The hot calls are
+ * timed with hipEvents recorded in the stream of the handle, so the time of
+ * each call is the time the device took to run it, without the host jitter
+ * and the synchronizations outside of the call. The minimum, median and 95th
+ * percentile of the times of the hot calls are kept in rocsolver_bench_last,
+ * and the median is the gpu_time of the benchmark.
+ ******************************************************************************/
+class rocsolver_bench_timer
+{
+    static constexpr int cold_calls = 2;
+
+    hipStream_t stream;
+    std::vector<hipEvent_t> start_events, stop_events;
+    int calls = 0;
+    double cold_start = 0, cold_time = 0;
+
+public:
+    rocsolver_bench_timer(rocblas_handle handle, rocblas_int hot_calls)
+        : start_events(std::max(hot_calls, 0))
+        , stop_events(std::max(hot_calls, 0))
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        for(size_t i = 0; i < start_events.size(); ++i)
+        {
+            CHECK_HIP_ERROR(hipEventCreate(&start_events[i]));
+            CHECK_HIP_ERROR(hipEventCreate(&stop_events[i]));
+        }
+    }
+
+    ~rocsolver_bench_timer()
+    {
+        for(size_t i = 0; i < start_events.size(); ++i)
+        {
+            hipEventDestroy(start_events[i]);
+            hipEventDestroy(stop_events[i]);
+        }
+    }
+
+    rocsolver_bench_timer(const rocsolver_bench_timer&) = delete;
+    rocsolver_bench_timer& operator=(const rocsolver_bench_timer&) = delete;
+
+    void start()
+    {
+        if(calls == 0)
+            cold_start = get_time_us_sync(stream);
+        else if(calls >= cold_calls)
+            CHECK_HIP_ERROR(hipEventRecord(start_events[calls - cold_calls], stream));
+    }
+
+    void stop()
+    {
+        if(calls == 0)
+            cold_time = get_time_us_sync(stream) - cold_start;
+        else if(calls >= cold_calls)
+            CHECK_HIP_ERROR(hipEventRecord(stop_events[calls - cold_calls], stream));
+        calls++;
+    }
+
+    // waits for the hot calls, and sets gpu_time_used to the median of their times
+    void finish(double* gpu_time_used)
+    {
+        std::vector<double> times(std::max(calls - cold_calls, 0));
+        for(size_t i = 0; i < times.size(); ++i)
+        {
+            float ms;
+            CHECK_HIP_ERROR(hipEventSynchronize(stop_events[i]));
+            CHECK_HIP_ERROR(hipEventElapsedTime(&ms, start_events[i], stop_events[i]));
+            times[i] = 1000.0 * ms;
+        }
+        std::sort(times.begin(), times.end());
+
+        rocsolver_bench_results& results = rocsolver_bench_last();
+        results.cold_time = cold_time;
+        if(times.empty())
+        {
+            results.min_time = results.p95_time = *gpu_time_used = 0;
+            return;
+        }
+
+        size_t n = times.size();
+        size_t p95 = size_t(std::ceil(0.95 * n)) - 1;
+        results.min_time = times[0];
+        results.p95_time = times[p95];
+        *gpu_time_used = (n % 2) ? times[n / 2] : (times[n / 2 - 1] + times[n / 2]) / 2;
+    }
+};
+
+// prints the times of the cold call and the hot calls of the last benchmark
+inline void rocsolver_bench_timing(double gpu_time_used)
+{
+    const rocsolver_bench_results& results = rocsolver_bench_last();
+    rocblas_cout << "\n============================================\n";
+    rocblas_cout << "Timing (us):\n";
+    rocblas_cout << "============================================\n";
+    rocsolver_bench_output("cold_call", "min", "median", "p95");
+    rocsolver_bench_output(results.cold_time, results.min_time, gpu_time_used, results.p95_time);
+}
+
 template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
 inline T sconj(T scalar)
 {
@@ -362,29 +362,31 @@ void bdsqr_getPerfData(const rocblas_handle handle,
                                       ldc, dinfo, hD, hE, hV, hU, hC, hinfo, D, E);
 
     // cold calls
+    rocsolver_bench_timer timer(handle, hot_calls);
     for(int iter = 0; iter < 2; iter++)
     {
         bdsqr_initData<false, true, S, T>(handle, uplo, n, nv, nu, nc, dD, dE, dV, ldv, dU, ldu, dC,
                                           ldc, dinfo, hD, hE, hV, hU, hC, hinfo, D, E);
 
+        timer.start();
         CHECK_ROCBLAS_ERROR(rocsolver_bdsqr(handle, uplo, n, nv, nu, nc, dD.data(), dE.data(),
                                             dV.data(), ldv, dU.data(), ldu, dC.data(), ldc,
                                             dinfo.data()));
+        timer.stop();
     }
 
     // gpu-lapack performance
-    double start;
     for(rocblas_int iter = 0; iter < hot_calls; iter++)
     {
         bdsqr_initData<false, true, S, T>(handle, uplo, n, nv, nu, nc, dD, dE, dV, ldv, dU, ldu, dC,
                                           ldc, dinfo, hD, hE, hV, hU, hC, hinfo, D, E);
 
-        start = get_time_us();
+        timer.start();
         rocsolver_bdsqr(handle, uplo, n, nv, nu, nc, dD.data(), dE.data(), dV.data(), ldv,
                         dU.data(), ldu, dC.data(), ldc, dinfo.data());
-        *gpu_time_used += get_time_us() - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    timer.finish(gpu_time_used);
 }
 
 template <typename T>
@@ -393,7 +395,7 @@ void testing_bdsqr(Arguments argus)
     using S = decltype(std::real(T{}));
 
     // get arguments
-    rocblas_local_handle handle;
+    rocsolver_bench_handle handle;
     rocblas_int n = argus.M;
     rocblas_int nv = argus.N;
     rocblas_int nu = argus.K;
@@ -554,7 +556,9 @@ void testing_bdsqr(Arguments argus)
     // output results for rocsolver-bench
     if(argus.timing)
     {
-        if(!argus.perf)
+        if(rocsolver_bench_last().recording)
+            rocsolver_bench_record(cpu_time_used, gpu_time_used, max_error);
+        else if(!argus.perf)
         {
             if(nv || nu || nc)
                 max_error = (max_error >= max_errorv) ? max_error : max_errorv;
@@ -576,6 +580,9 @@ void testing_bdsqr(Arguments argus)
                 rocsolver_bench_output("cpu_time", "gpu_time");
                 rocsolver_bench_output(cpu_time_used, gpu_time_used);
             }
+            rocsolver_bench_timing(gpu_time_used);
+            if(argus.counters)
+                rocsolver_bench_counters(handle);
             rocblas_cout << std::endl;
         }
         else
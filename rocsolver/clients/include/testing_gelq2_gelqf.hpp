@@ -7,6 +7,7 @@
 #include "norm.hpp"
 #include "rocsolver.hpp"
 #include "rocsolver_arguments.hpp"
+#include "rocsolver_flops.hpp"
 #include "rocsolver_test.hpp"
 
 template <bool STRIDED, bool GELQF, typename T, typename U>
@@ -217,33 +218,35 @@ void gelq2_gelqf_getPerfData(const rocblas_handle handle,
     gelq2_gelqf_initData<true, false, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
     // cold calls
+    rocsolver_bench_timer timer(handle, hot_calls);
     for(int iter = 0; iter < 2; iter++)
     {
         gelq2_gelqf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
+        timer.start();
         CHECK_ROCBLAS_ERROR(rocsolver_gelq2_gelqf(STRIDED, GELQF, handle, m, n, dA.data(), lda, stA,
                                                   dIpiv.data(), stP, bc));
+        timer.stop();
     }
 
     // gpu-lapack performance
-    double start;
     for(rocblas_int iter = 0; iter < hot_calls; iter++)
     {
         gelq2_gelqf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
-        start = get_time_us();
+        timer.start();
         rocsolver_gelq2_gelqf(STRIDED, GELQF, handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP,
                               bc);
-        *gpu_time_used += get_time_us() - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    timer.finish(gpu_time_used);
 }
 
 template <bool BATCHED, bool STRIDED, bool GELQF, typename T>
 void testing_gelq2_gelqf(Arguments argus)
 {
     // get arguments
-    rocblas_local_handle handle;
+    rocsolver_bench_handle handle;
     rocblas_int m = argus.M;
     rocblas_int n = argus.N;
     rocblas_int lda = argus.lda;
@@ -367,7 +370,13 @@ void testing_gelq2_gelqf(Arguments argus)
     // output results for rocsolver-bench
     if(argus.timing)
     {
-        if(!argus.perf)
+        // rates of the whole batch
+        rocblas_int nb = (BATCHED || STRIDED) ? bc : 1;
+        double gflops = rocsolver_bench_rate(nb * gelqf_flop_count<T>(m, n), gpu_time_used);
+        double gbps = rocsolver_bench_rate(nb * geqrf_byte_count<T>(m, n), gpu_time_used);
+        if(rocsolver_bench_last().recording)
+            rocsolver_bench_record(cpu_time_used, gpu_time_used, max_error, gflops, gbps);
+        else if(!argus.perf)
         {
             rocblas_cout << "\n============================================\n";
             rocblas_cout << "Arguments:\n";
@@ -392,22 +401,25 @@ void testing_gelq2_gelqf(Arguments argus)
             rocblas_cout << "============================================\n";
             if(argus.norm_check)
             {
-                rocsolver_bench_output("cpu_time", "gpu_time", "error");
-                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+                rocsolver_bench_output("cpu_time", "gpu_time", "gflop/s", "gb/s", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, gflops, gbps, max_error);
             }
             else
             {
-                rocsolver_bench_output("cpu_time", "gpu_time");
-                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+                rocsolver_bench_output("cpu_time", "gpu_time", "gflop/s", "gb/s");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, gflops, gbps);
             }
+            rocsolver_bench_timing(gpu_time_used);
+            if(argus.counters)
+                rocsolver_bench_counters(handle);
             rocblas_cout << std::endl;
         }
         else
         {
             if(argus.norm_check)
-                rocsolver_bench_output(gpu_time_used, max_error);
+                rocsolver_bench_output(gpu_time_used, gflops, gbps, max_error);
             else
-                rocsolver_bench_output(gpu_time_used);
+                rocsolver_bench_output(gpu_time_used, gflops, gbps);
         }
     }
 }
@@ -7,6 +7,7 @@
 #include "norm.hpp"
 #include "rocsolver.hpp"
 #include "rocsolver_arguments.hpp"
+#include "rocsolver_flops.hpp"
 #include "rocsolver_test.hpp"
 
 template <bool STRIDED, typename T, typename TT, typename W, typename U>
@@ -421,28 +422,30 @@ void gesvd_getPerfData(const rocblas_handle handle,
     gesvd_initData<true, false, T>(handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A, 0);
 
     // cold calls
+    rocsolver_bench_timer timer(handle, hot_calls);
     for(int iter = 0; iter < 2; iter++)
     {
         gesvd_initData<false, true, T>(handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A, 0);
 
+        timer.start();
         CHECK_ROCBLAS_ERROR(rocsolver_gesvd(
             STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, stA, dS.data(), stS,
             dU.data(), ldu, stU, dV.data(), ldv, stV, dE.data(), stE, fa, dinfo.data(), bc));
+        timer.stop();
     }
 
     // gpu-lapack performance
-    double start;
     for(rocblas_int iter = 0; iter < hot_calls; iter++)
     {
         gesvd_initData<false, true, T>(handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A, 0);
 
-        start = get_time_us();
+        timer.start();
         rocsolver_gesvd(STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, stA,
                         dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv, stV, dE.data(), stE,
                         fa, dinfo.data(), bc);
-        *gpu_time_used += get_time_us() - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    timer.finish(gpu_time_used);
 }
 
 template <bool BATCHED, bool STRIDED, typename T>
@@ -451,7 +454,7 @@ void testing_gesvd(Arguments argus)
     using S = decltype(std::real(T{}));
 
     // get arguments
-    rocblas_local_handle handle;
+    rocsolver_bench_handle handle;
     rocblas_int m = argus.M;
     rocblas_int n = argus.N;
     rocblas_int lda = argus.lda;
@@ -741,10 +744,19 @@ void testing_gesvd(Arguments argus)
     // output results for rocsolver-bench
     if(argus.timing)
     {
-        if(!argus.perf)
+        if(svects)
+            max_error = (max_error >= max_errorv) ? max_error : max_errorv;
+
+        // rates of the whole batch
+        rocblas_int nb = (BATCHED || STRIDED) ? bc : 1;
+        double gflops
+            = rocsolver_bench_rate(nb * gesvd_flop_count<T>(leftvC, rightvC, m, n), gpu_time_used);
+        double gbps
+            = rocsolver_bench_rate(nb * gesvd_byte_count<T>(leftvC, rightvC, m, n), gpu_time_used);
+        if(rocsolver_bench_last().recording)
+            rocsolver_bench_record(cpu_time_used, gpu_time_used, max_error, gflops, gbps);
+        else if(!argus.perf)
         {
-            if(svects)
-                max_error = (max_error >= max_errorv) ? max_error : max_errorv;
             rocblas_cout << "\n============================================\n";
             rocblas_cout << "Arguments:\n";
             rocblas_cout << "============================================\n";
@@ -772,22 +784,25 @@ void testing_gesvd(Arguments argus)
             rocblas_cout << "============================================\n";
             if(argus.norm_check)
             {
-                rocsolver_bench_output("cpu_time", "gpu_time", "error");
-                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+                rocsolver_bench_output("cpu_time", "gpu_time", "gflop/s", "gb/s", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, gflops, gbps, max_error);
             }
             else
             {
-                rocsolver_bench_output("cpu_time", "gpu_time");
-                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+                rocsolver_bench_output("cpu_time", "gpu_time", "gflop/s", "gb/s");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, gflops, gbps);
             }
+            rocsolver_bench_timing(gpu_time_used);
+            if(argus.counters)
+                rocsolver_bench_counters(handle);
             rocblas_cout << std::endl;
         }
         else
         {
             if(argus.norm_check)
-                rocsolver_bench_output(gpu_time_used, max_error);
+                rocsolver_bench_output(gpu_time_used, gflops, gbps, max_error);
             else
-                rocsolver_bench_output(gpu_time_used);
+                rocsolver_bench_output(gpu_time_used, gflops, gbps);
         }
     }
 }
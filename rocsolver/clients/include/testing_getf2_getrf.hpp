@@ -7,6 +7,7 @@
 #include "norm.hpp"
 #include "rocsolver.hpp"
 #include "rocsolver_arguments.hpp"
+#include "rocsolver_flops.hpp"
 #include "rocsolver_test.hpp"
 
 template <bool STRIDED, bool GETRF, typename T, typename U>
@@ -120,7 +121,8 @@ void getf2_getrf_initData(const rocblas_handle handle,
                           const rocblas_int bc,
                           Th& hA,
                           Uh& hIpiv,
-                          Uh& hinfo)
+                          Uh& hinfo,
+                          const bool dominant)
 {
     if(CPU)
     {
@@ -130,11 +132,13 @@ void getf2_getrf_initData(const rocblas_handle handle,
         for(rocblas_int b = 0; b < bc; ++b)
         {
             // scale A to avoid singularities
+            // (without dominance, the entries are only centered around zero, so
+            // that the pivots are not on the diagonal)
             for(rocblas_int i = 0; i < m; i++)
             {
                 for(rocblas_int j = 0; j < n; j++)
                 {
-                    if(i == j)
+                    if(i == j && dominant)
                         hA[b][i + j * lda] += 400;
                     else
                         hA[b][i + j * lda] -= 4;
@@ -180,11 +184,12 @@ void getf2_getrf_getError(const rocblas_handle handle,
                           Uh& hIpiv,
                           Uh& hIpivRes,
                           Uh& hinfo,
-                          double* max_err)
+                          double* max_err,
+                          const bool dominant)
 {
     // input data initialization
     getf2_getrf_initData<true, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dinfo, bc, hA,
-                                        hIpiv, hinfo);
+                                        hIpiv, hinfo, dominant);
 
     // execute computations
     // GPU lapack
@@ -193,6 +198,51 @@ void getf2_getrf_getError(const rocblas_handle handle,
     CHECK_HIP_ERROR(hARes.transfer_from(dA));
     CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
 
+    double err;
+    *max_err = 0;
+
+    // without dominance, other pivoting strategies (tournament pivoting) can
+    // select pivots different from those of partial pivoting; error is then
+    // ||P*A - Lres*Ures|| / ||A||, after checking that the pivots are valid
+    // using frobenius norm
+    if(!dominant)
+    {
+        rocblas_int k = min(m, n);
+        std::vector<T> L(size_t(m) * k);
+        std::vector<T> U(size_t(k) * n);
+        std::vector<T> LU(size_t(lda) * n);
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            err = 0;
+            for(rocblas_int i = 0; i < k; ++i)
+                if(hIpivRes[b][i] <= i || hIpivRes[b][i] > m)
+                    err++;
+            if(err > 0)
+            {
+                *max_err = err > *max_err ? err : *max_err;
+                continue;
+            }
+
+            for(rocblas_int j = 0; j < k; ++j)
+            {
+                for(rocblas_int i = 0; i < m; ++i)
+                    L[i + j * m] = (i > j) ? hARes[b][i + j * lda] : T(i == j ? 1 : 0);
+            }
+            for(rocblas_int j = 0; j < n; ++j)
+            {
+                for(rocblas_int i = 0; i < k; ++i)
+                    U[i + j * k] = (i <= j) ? hARes[b][i + j * lda] : T(0);
+            }
+            cblas_gemm<T>(rocblas_operation_none, rocblas_operation_none, m, n, k, T(1), L.data(),
+                          m, U.data(), k, T(0), LU.data(), lda);
+            cblas_laswp<T>(n, hA[b], lda, 1, k, hIpivRes[b], 1);
+
+            err = norm_error('F', m, n, lda, hA[b], LU.data());
+            *max_err = err > *max_err ? err : *max_err;
+        }
+        return;
+    }
+
     // CPU lapack
     for(rocblas_int b = 0; b < bc; ++b)
     {
@@ -205,8 +255,6 @@ void getf2_getrf_getError(const rocblas_handle handle,
     // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
     // IT MIGHT BE REVISITED IN THE FUTURE)
     // using frobenius norm
-    double err;
-    *max_err = 0;
     for(rocblas_int b = 0; b < bc; ++b)
     {
         err = norm_error('F', m, n, lda, hA[b], hARes[b]);
@@ -245,7 +293,7 @@ void getf2_getrf_getPerfData(const rocblas_handle handle,
     if(!perf)
     {
         getf2_getrf_initData<true, false, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dinfo, bc, hA,
-                                             hIpiv, hinfo);
+                                             hIpiv, hinfo, true);
 
         // cpu-lapack performance (only if not in perf mode)
         *cpu_time_used = get_time_us();
@@ -258,38 +306,40 @@ void getf2_getrf_getPerfData(const rocblas_handle handle,
     }
 
     getf2_getrf_initData<true, false, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dinfo, bc, hA,
-                                         hIpiv, hinfo);
+                                         hIpiv, hinfo, true);
 
     // cold calls
+    rocsolver_bench_timer timer(handle, hot_calls);
     for(int iter = 0; iter < 2; iter++)
     {
         getf2_getrf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dinfo, bc, hA,
-                                             hIpiv, hinfo);
+                                             hIpiv, hinfo, true);
 
+        timer.start();
         CHECK_ROCBLAS_ERROR(rocsolver_getf2_getrf(STRIDED, GETRF, handle, m, n, dA.data(), lda, stA,
                                                   dIpiv.data(), stP, dinfo.data(), bc));
+        timer.stop();
     }
 
     // gpu-lapack performance
-    double start;
     for(rocblas_int iter = 0; iter < hot_calls; iter++)
     {
         getf2_getrf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dinfo, bc, hA,
-                                             hIpiv, hinfo);
+                                             hIpiv, hinfo, true);
 
-        start = get_time_us();
+        timer.start();
         rocsolver_getf2_getrf(STRIDED, GETRF, handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP,
                               dinfo.data(), bc);
-        *gpu_time_used += get_time_us() - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    timer.finish(gpu_time_used);
 }
 
 template <bool BATCHED, bool STRIDED, bool GETRF, typename T>
-void testing_getf2_getrf(Arguments argus)
+void testing_getf2_getrf(Arguments argus, const bool dominant = true)
 {
     // get arguments
-    rocblas_local_handle handle;
+    rocsolver_bench_handle handle;
     rocblas_int m = argus.M;
     rocblas_int n = argus.N;
     rocblas_int lda = argus.lda;
@@ -365,7 +415,8 @@ void testing_getf2_getrf(Arguments argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
             getf2_getrf_getError<STRIDED, GETRF, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dinfo, bc,
-                                                    hA, hARes, hIpiv, hIpivRes, hinfo, &max_error);
+                                                    hA, hARes, hIpiv, hIpivRes, hinfo, &max_error,
+                                                    dominant);
 
         // collect performance data
         if(argus.timing)
@@ -406,7 +457,8 @@ void testing_getf2_getrf(Arguments argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
             getf2_getrf_getError<STRIDED, GETRF, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dinfo, bc,
-                                                    hA, hARes, hIpiv, hIpivRes, hinfo, &max_error);
+                                                    hA, hARes, hIpiv, hIpivRes, hinfo, &max_error,
+                                                    dominant);
 
         // collect performance data
         if(argus.timing)
@@ -423,7 +475,13 @@ void testing_getf2_getrf(Arguments argus)
     // output results for rocsolver-bench
     if(argus.timing)
     {
-        if(!argus.perf)
+        // rates of the whole batch
+        rocblas_int nb = (BATCHED || STRIDED) ? bc : 1;
+        double gflops = rocsolver_bench_rate(nb * getrf_flop_count<T>(m, n), gpu_time_used);
+        double gbps = rocsolver_bench_rate(nb * getrf_byte_count<T>(m, n), gpu_time_used);
+        if(rocsolver_bench_last().recording)
+            rocsolver_bench_record(cpu_time_used, gpu_time_used, max_error, gflops, gbps);
+        else if(!argus.perf)
         {
             rocblas_cout << "\n============================================\n";
             rocblas_cout << "Arguments:\n";
@@ -448,22 +506,25 @@ void testing_getf2_getrf(Arguments argus)
             rocblas_cout << "============================================\n";
             if(argus.norm_check)
             {
-                rocsolver_bench_output("cpu_time", "gpu_time", "error");
-                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+                rocsolver_bench_output("cpu_time", "gpu_time", "gflop/s", "gb/s", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, gflops, gbps, max_error);
             }
             else
             {
-                rocsolver_bench_output("cpu_time", "gpu_time");
-                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+                rocsolver_bench_output("cpu_time", "gpu_time", "gflop/s", "gb/s");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, gflops, gbps);
             }
+            rocsolver_bench_timing(gpu_time_used);
+            if(argus.counters)
+                rocsolver_bench_counters(handle);
             rocblas_cout << std::endl;
         }
         else
         {
             if(argus.norm_check)
-                rocsolver_bench_output(gpu_time_used, max_error);
+                rocsolver_bench_output(gpu_time_used, gflops, gbps, max_error);
             else
-                rocsolver_bench_output(gpu_time_used);
+                rocsolver_bench_output(gpu_time_used, gflops, gbps);
         }
     }
 }
@@ -7,6 +7,7 @@
 #include "norm.hpp"
 #include "rocsolver.hpp"
 #include "rocsolver_arguments.hpp"
+#include "rocsolver_flops.hpp"
 #include "rocsolver_test.hpp"
 
 template <bool STRIDED, typename T, typename U>
@@ -259,38 +260,43 @@ void getri_getPerfData(const rocblas_handle handle,
                                    hIpiv, hInfo);
 
     // cold calls
+    rocsolver_bench_timer timer(handle, hot_calls);
     for(int iter = 0; iter < 2; iter++)
     {
         getri_initData<false, true, T>(handle, n, dA1, dA, lda, stA, dIpiv, stP, dInfo, bc, hA1, hA,
                                        hIpiv, hInfo);
 
+        timer.start();
         CHECK_ROCBLAS_ERROR(rocsolver_getri(STRIDED, handle, n, dA1.data(), dA.data(), lda, stA,
                                             dIpiv.data(), stP, dInfo.data(), bc));
+        timer.stop();
     }
 
     // gpu-lapack performance
-    double start;
     for(rocblas_int iter = 0; iter < hot_calls; iter++)
     {
         getri_initData<false, true, T>(handle, n, dA1, dA, lda, stA, dIpiv, stP, dInfo, bc, hA1, hA,
                                        hIpiv, hInfo);
 
-        start = get_time_us();
+        timer.start();
         rocsolver_getri(STRIDED, handle, n, dA1.data(), dA.data(), lda, stA, dIpiv.data(), stP,
                         dInfo.data(), bc);
-        *gpu_time_used += get_time_us() - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    timer.finish(gpu_time_used);
 }
 
 template <bool BATCHED, bool STRIDED, typename T>
 void testing_getri(Arguments argus)
 {
-    rocblas_local_handle handle;
+    rocsolver_bench_handle handle;
     /* Set handle memory size to a large enough value for all tests to pass.
    (TODO: Investigate why rocblas is not automatically increasing the size of
-   the memory stack in rocblas_handle)*/
-    rocblas_set_device_memory_size(handle, 80000000);
+   the memory stack in rocblas_handle)
+   The size of the handle shared by a suite is not fixed, as it has to grow for
+   the other benchmarks.*/
+    if(!handle.shared())
+        rocblas_set_device_memory_size(handle, 80000000);
 
     // get arguments
     rocblas_int n = argus.N;
@@ -467,7 +473,13 @@ void testing_getri(Arguments argus)
     // output results for rocsolver-bench
     if(argus.timing)
     {
-        if(!argus.perf)
+        // rates of the whole batch
+        rocblas_int nb = (BATCHED || STRIDED) ? bc : 1;
+        double gflops = rocsolver_bench_rate(nb * getri_flop_count<T>(n), gpu_time_used);
+        double gbps = rocsolver_bench_rate(nb * getri_byte_count<T>(n), gpu_time_used);
+        if(rocsolver_bench_last().recording)
+            rocsolver_bench_record(cpu_time_used, gpu_time_used, max_error, gflops, gbps);
+        else if(!argus.perf)
         {
             rocblas_cout << "\n============================================\n";
             rocblas_cout << "Arguments:\n";
@@ -492,22 +504,25 @@ void testing_getri(Arguments argus)
             rocblas_cout << "============================================\n";
             if(argus.norm_check)
             {
-                rocsolver_bench_output("cpu_time", "gpu_time", "error");
-                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+                rocsolver_bench_output("cpu_time", "gpu_time", "gflop/s", "gb/s", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, gflops, gbps, max_error);
             }
             else
             {
-                rocsolver_bench_output("cpu_time", "gpu_time");
-                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+                rocsolver_bench_output("cpu_time", "gpu_time", "gflop/s", "gb/s");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, gflops, gbps);
             }
+            rocsolver_bench_timing(gpu_time_used);
+            if(argus.counters)
+                rocsolver_bench_counters(handle);
             rocblas_cout << std::endl;
         }
         else
         {
             if(argus.norm_check)
-                rocsolver_bench_output(gpu_time_used, max_error);
+                rocsolver_bench_output(gpu_time_used, gflops, gbps, max_error);
             else
-                rocsolver_bench_output(gpu_time_used);
+                rocsolver_bench_output(gpu_time_used, gflops, gbps);
         }
     }
 }
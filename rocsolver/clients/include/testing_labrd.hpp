@@ -255,29 +255,31 @@ void labrd_getPerfData(const rocblas_handle handle,
                                       ldy, hA, hD, hE, hTauq, hTaup, hX, hY);
 
     // cold calls
+    rocsolver_bench_timer timer(handle, hot_calls);
     for(int iter = 0; iter < 2; iter++)
     {
         labrd_initData<false, true, S, T>(handle, m, n, nb, dA, lda, dD, dE, dTauq, dTaup, dX, ldx,
                                           dY, ldy, hA, hD, hE, hTauq, hTaup, hX, hY);
 
+        timer.start();
         CHECK_ROCBLAS_ERROR(rocsolver_labrd(handle, m, n, nb, dA.data(), lda, dD.data(), dE.data(),
                                             dTauq.data(), dTaup.data(), dX.data(), ldx, dY.data(),
                                             ldy));
+        timer.stop();
     }
 
     // gpu-lapack performance
-    double start;
     for(rocblas_int iter = 0; iter < hot_calls; iter++)
     {
         labrd_initData<false, true, S, T>(handle, m, n, nb, dA, lda, dD, dE, dTauq, dTaup, dX, ldx,
                                           dY, ldy, hA, hD, hE, hTauq, hTaup, hX, hY);
 
-        start = get_time_us();
+        timer.start();
         rocsolver_labrd(handle, m, n, nb, dA.data(), lda, dD.data(), dE.data(), dTauq.data(),
                         dTaup.data(), dX.data(), ldx, dY.data(), ldy);
-        *gpu_time_used += get_time_us() - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    timer.finish(gpu_time_used);
 }
 
 template <typename T>
@@ -286,7 +288,7 @@ void testing_labrd(Arguments argus)
     using S = decltype(std::real(T{}));
 
     // get arguments
-    rocblas_local_handle handle;
+    rocsolver_bench_handle handle;
     rocblas_int m = argus.M;
     rocblas_int n = argus.N;
     rocblas_int nb = argus.K;
@@ -392,7 +394,9 @@ void testing_labrd(Arguments argus)
     // output results for rocsolver-bench
     if(argus.timing)
     {
-        if(!argus.perf)
+        if(rocsolver_bench_last().recording)
+            rocsolver_bench_record(cpu_time_used, gpu_time_used, max_error);
+        else if(!argus.perf)
         {
             rocblas_cout << "\n============================================\n";
             rocblas_cout << "Arguments:\n";
@@ -412,6 +416,9 @@ void testing_labrd(Arguments argus)
                 rocsolver_bench_output("cpu_time", "gpu_time");
                 rocsolver_bench_output(cpu_time_used, gpu_time_used);
             }
+            rocsolver_bench_timing(gpu_time_used);
+            if(argus.counters)
+                rocsolver_bench_counters(handle);
             rocblas_cout << std::endl;
         }
         else
@@ -115,31 +115,33 @@ void lacgv_getPerfData(const rocblas_handle handle,
     lacgv_initData<true, false, T>(handle, n, dA, inc, hA);
 
     // cold calls
+    rocsolver_bench_timer timer(handle, hot_calls);
     for(int iter = 0; iter < 2; iter++)
     {
         lacgv_initData<false, true, T>(handle, n, dA, inc, hA);
 
+        timer.start();
         CHECK_ROCBLAS_ERROR(rocsolver_lacgv(handle, n, dA.data(), inc));
+        timer.stop();
     }
 
     // gpu-lapack performance
-    double start;
     for(int iter = 0; iter < hot_calls; iter++)
     {
         lacgv_initData<false, true, T>(handle, n, dA, inc, hA);
 
-        start = get_time_us();
+        timer.start();
         rocsolver_lacgv(handle, n, dA.data(), inc);
-        *gpu_time_used += get_time_us() - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    timer.finish(gpu_time_used);
 }
 
 template <typename T>
 void testing_lacgv(Arguments argus)
 {
     // get arguments
-    rocblas_local_handle handle;
+    rocsolver_bench_handle handle;
     rocblas_int n = argus.N;
     rocblas_int inc = argus.incx;
     rocblas_int hot_calls = argus.iters;
@@ -201,7 +203,9 @@ void testing_lacgv(Arguments argus)
     // output results for rocsolver-bench
     if(argus.timing)
     {
-        if(!argus.perf)
+        if(rocsolver_bench_last().recording)
+            rocsolver_bench_record(cpu_time_used, gpu_time_used, max_error);
+        else if(!argus.perf)
         {
             rocblas_cout << "\n============================================\n";
             rocblas_cout << "Arguments:\n";
@@ -222,6 +226,9 @@ void testing_lacgv(Arguments argus)
                 rocsolver_bench_output("cpu_time", "gpu_time");
                 rocsolver_bench_output(cpu_time_used, gpu_time_used);
             }
+            rocsolver_bench_timing(gpu_time_used);
+            if(argus.counters)
+                rocsolver_bench_counters(handle);
             rocblas_cout << std::endl;
         }
         else
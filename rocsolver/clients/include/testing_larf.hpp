@@ -184,32 +184,34 @@ void larf_getPerfData(const rocblas_handle handle,
     larf_initData<true, false, T>(handle, side, m, n, dx, inc, dt, dA, lda, xx, hx, ht, hA);
 
     // cold calls
+    rocsolver_bench_timer timer(handle, hot_calls);
     for(int iter = 0; iter < 2; iter++)
     {
         larf_initData<false, true, T>(handle, side, m, n, dx, inc, dt, dA, lda, xx, hx, ht, hA);
 
+        timer.start();
         CHECK_ROCBLAS_ERROR(
             rocsolver_larf(handle, side, m, n, dx.data(), inc, dt.data(), dA.data(), lda));
+        timer.stop();
     }
 
     // gpu-lapack performance
-    double start;
     for(int iter = 0; iter < hot_calls; iter++)
     {
         larf_initData<false, true, T>(handle, side, m, n, dx, inc, dt, dA, lda, xx, hx, ht, hA);
 
-        start = get_time_us();
+        timer.start();
         rocsolver_larf(handle, side, m, n, dx.data(), inc, dt.data(), dA.data(), lda);
-        *gpu_time_used += get_time_us() - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    timer.finish(gpu_time_used);
 }
 
 template <typename T>
 void testing_larf(Arguments argus)
 {
     // get arguments
-    rocblas_local_handle handle;
+    rocsolver_bench_handle handle;
     rocblas_int m = argus.M;
     rocblas_int n = argus.N;
     rocblas_int inc = argus.incx;
@@ -299,7 +301,9 @@ void testing_larf(Arguments argus)
     // output results for rocsolver-bench
     if(argus.timing)
     {
-        if(!argus.perf)
+        if(rocsolver_bench_last().recording)
+            rocsolver_bench_record(cpu_time_used, gpu_time_used, max_error);
+        else if(!argus.perf)
         {
             rocblas_cout << "\n============================================\n";
             rocblas_cout << "Arguments:\n";
@@ -320,6 +324,9 @@ void testing_larf(Arguments argus)
                 rocsolver_bench_output("cpu_time", "gpu_time");
                 rocsolver_bench_output(cpu_time_used, gpu_time_used);
             }
+            rocsolver_bench_timing(gpu_time_used);
+            if(argus.counters)
+                rocsolver_bench_counters(handle);
             rocblas_cout << std::endl;
         }
         else
@@ -311,35 +311,37 @@ void larfb_getPerfData(const rocblas_handle handle,
                                    dA, lda, hV, hT, hA, hW, sizeW);
 
     // cold calls
+    rocsolver_bench_timer timer(handle, hot_calls);
     for(int iter = 0; iter < 2; iter++)
     {
         larfb_initData<false, true, T>(handle, side, trans, direct, storev, m, n, k, dV, ldv, dT,
                                        ldt, dA, lda, hV, hT, hA, hW, sizeW);
 
+        timer.start();
         CHECK_ROCBLAS_ERROR(rocsolver_larfb(handle, side, trans, direct, storev, m, n, k, dV.data(),
                                             ldv, dT.data(), ldt, dA.data(), lda));
+        timer.stop();
     }
 
     // gpu-lapack performance
-    double start;
     for(int iter = 0; iter < hot_calls; iter++)
     {
         larfb_initData<false, true, T>(handle, side, trans, direct, storev, m, n, k, dV, ldv, dT,
                                        ldt, dA, lda, hV, hT, hA, hW, sizeW);
 
-        start = get_time_us();
+        timer.start();
         rocsolver_larfb(handle, side, trans, direct, storev, m, n, k, dV.data(), ldv, dT.data(),
                         ldt, dA.data(), lda);
-        *gpu_time_used += get_time_us() - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    timer.finish(gpu_time_used);
 }
 
 template <typename T>
 void testing_larfb(Arguments argus)
 {
     // get arguments
-    rocblas_local_handle handle;
+    rocsolver_bench_handle handle;
     rocblas_int k = argus.K;
     rocblas_int m = argus.M;
     rocblas_int n = argus.N;
@@ -445,7 +447,9 @@ void testing_larfb(Arguments argus)
     // output results for rocsolver-bench
     if(argus.timing)
     {
-        if(!argus.perf)
+        if(rocsolver_bench_last().recording)
+            rocsolver_bench_record(cpu_time_used, gpu_time_used, max_error);
+        else if(!argus.perf)
         {
             rocblas_cout << "\n============================================\n";
             rocblas_cout << "Arguments:\n";
@@ -467,6 +471,9 @@ void testing_larfb(Arguments argus)
                 rocsolver_bench_output("cpu_time", "gpu_time");
                 rocsolver_bench_output(cpu_time_used, gpu_time_used);
             }
+            rocsolver_bench_timing(gpu_time_used);
+            if(argus.counters)
+                rocsolver_bench_counters(handle);
             rocblas_cout << std::endl;
         }
         else
@@ -141,31 +141,33 @@ void larfg_getPerfData(const rocblas_handle handle,
     larfg_initData<true, false, T>(handle, n, da, dx, inc, dt, ha, hx, ht);
 
     // cold calls
+    rocsolver_bench_timer timer(handle, hot_calls);
     for(int iter = 0; iter < 2; iter++)
     {
         larfg_initData<false, true, T>(handle, n, da, dx, inc, dt, ha, hx, ht);
 
+        timer.start();
         CHECK_ROCBLAS_ERROR(rocsolver_larfg(handle, n, da.data(), dx.data(), inc, dt.data()));
+        timer.stop();
     }
 
     // gpu-lapack performance
-    double start;
     for(int iter = 0; iter < hot_calls; iter++)
     {
         larfg_initData<false, true, T>(handle, n, da, dx, inc, dt, ha, hx, ht);
 
-        start = get_time_us();
+        timer.start();
         rocsolver_larfg(handle, n, da.data(), dx.data(), inc, dt.data());
-        *gpu_time_used += get_time_us() - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    timer.finish(gpu_time_used);
 }
 
 template <typename T>
 void testing_larfg(Arguments argus)
 {
     // get arguments
-    rocblas_local_handle handle;
+    rocsolver_bench_handle handle;
     rocblas_int n = argus.N;
     rocblas_int inc = argus.incx;
     rocblas_int hot_calls = argus.iters;
@@ -239,7 +241,9 @@ void testing_larfg(Arguments argus)
     // output results for rocsolver-bench
     if(argus.timing)
     {
-        if(!argus.perf)
+        if(rocsolver_bench_last().recording)
+            rocsolver_bench_record(cpu_time_used, gpu_time_used, max_error);
+        else if(!argus.perf)
         {
             rocblas_cout << "\n============================================\n";
             rocblas_cout << "Arguments:\n";
@@ -260,6 +264,9 @@ void testing_larfg(Arguments argus)
                 rocsolver_bench_output("cpu_time", "gpu_time");
                 rocsolver_bench_output(cpu_time_used, gpu_time_used);
             }
+            rocsolver_bench_timing(gpu_time_used);
+            if(argus.counters)
+                rocsolver_bench_counters(handle);
             rocblas_cout << std::endl;
         }
         else
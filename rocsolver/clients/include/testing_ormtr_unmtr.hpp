@@ -229,35 +229,37 @@ void ormtr_unmtr_getPerfData(const rocblas_handle handle,
                                          hA, hIpiv, hC, hW, size_W);
 
     // cold calls
+    rocsolver_bench_timer timer(handle, hot_calls);
     for(int iter = 0; iter < 2; iter++)
     {
         ormtr_unmtr_initData<false, true, T>(handle, side, uplo, trans, m, n, dA, lda, dIpiv, dC,
                                              ldc, hA, hIpiv, hC, hW, size_W);
 
+        timer.start();
         CHECK_ROCBLAS_ERROR(rocsolver_ormtr_unmtr(handle, side, uplo, trans, m, n, dA.data(), lda,
                                                   dIpiv.data(), dC.data(), ldc));
+        timer.stop();
     }
 
     // gpu-lapack performance
-    double start;
     for(int iter = 0; iter < hot_calls; iter++)
     {
         ormtr_unmtr_initData<false, true, T>(handle, side, uplo, trans, m, n, dA, lda, dIpiv, dC,
                                              ldc, hA, hIpiv, hC, hW, size_W);
 
-        start = get_time_us();
+        timer.start();
         rocsolver_ormtr_unmtr(handle, side, uplo, trans, m, n, dA.data(), lda, dIpiv.data(),
                               dC.data(), ldc);
-        *gpu_time_used += get_time_us() - start;
+        timer.stop();
     }
-    *gpu_time_used /= hot_calls;
+    timer.finish(gpu_time_used);
 }
 
 template <typename T, bool COMPLEX = is_complex<T>>
 void testing_ormtr_unmtr(Arguments argus)
 {
     // get arguments
-    rocblas_local_handle handle;
+    rocsolver_bench_handle handle;
     rocblas_int m = argus.M;
     rocblas_int n = argus.N;
     rocblas_int lda = argus.lda;
@@ -358,7 +360,9 @@ void testing_ormtr_unmtr(Arguments argus)
     // output results for rocsolver-bench
     if(argus.timing)
     {
-        if(!argus.perf)
+        if(rocsolver_bench_last().recording)
+            rocsolver_bench_record(cpu_time_used, gpu_time_used, max_error);
+        else if(!argus.perf)
         {
             rocblas_cout << "\n============================================\n";
             rocblas_cout << "Arguments:\n";
@@ -379,6 +383,9 @@ void testing_ormtr_unmtr(Arguments argus)
                 rocsolver_bench_output("cpu_time", "gpu_time");
                 rocsolver_bench_output(cpu_time_used, gpu_time_used);
             }
+            rocsolver_bench_timing(gpu_time_used);
+            if(argus.counters)
+                rocsolver_bench_counters(handle);
             rocblas_cout << std::endl;
         }
         else
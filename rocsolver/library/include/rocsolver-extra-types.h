@@ -46,4 +46,70 @@ typedef enum rocblas_workmode_
     rocblas_inplace = 202, /**< When not enough memory, this forces in-place computations  */
 } rocblas_workmode;
 
+/*! \brief Used to identify the tuning parameters (crossover points and block sizes)
+ *that can be modified at run time
+ ********************************************************************************/
+typedef enum rocsolver_tuning_param_
+{
+    rocsolver_tuning_getrf_switchsize = 301, /**< GETRF calls GETF2 when min(m,n) is smaller
+                                               than this value; otherwise it is also the
+                                               size of the blocks. */
+    rocsolver_tuning_getf2_optim_ngrp = 302, /**< Number of instances of the batch factorized
+                                               by each workgroup in the optimized small-size
+                                               GETF2 kernel (size is m). */
+    rocsolver_tuning_potrf_switchsize = 303, /**< POTRF calls POTF2 when n is smaller than this
+                                               value; otherwise it is also the size of the
+                                               blocks. */
+    rocsolver_tuning_geqxf_switchsize = 304, /**< GEQRF/GEQLF call GEQR2/GEQL2 when min(m,n)
+                                               is not larger than this value. */
+    rocsolver_tuning_geqxf_blocksize = 305, /**< Size of the blocks in GEQRF/GEQLF. */
+    rocsolver_tuning_gexqf_switchsize = 306, /**< GELQF calls GELQ2 when min(m,n) is not larger
+                                               than this value. */
+    rocsolver_tuning_gexqf_blocksize = 307, /**< Size of the blocks in GELQF. */
+    rocsolver_tuning_orgxx_switchsize = 308, /**< ORGxx/UNGxx call ORGx2/UNGx2 when k is not
+                                               larger than this value. */
+    rocsolver_tuning_orgxx_blocksize = 309, /**< Size of the blocks in ORGxx/UNGxx. */
+    rocsolver_tuning_getri_switchsize_mid = 310, /**< GETRI uses the unblocked algorithm when n
+                                                   is not larger than this value. */
+    rocsolver_tuning_getri_switchsize_large = 311, /**< GETRI uses a trsm-based algorithm
+                                                     that needs more workspace when n is not
+                                                     larger than this value. */
+    rocsolver_tuning_getri_blocksize = 312, /**< Size of the blocks in GETRI. */
+    rocsolver_tuning_ormxx_blocksize = 313, /**< ORMxx/UNMxx call ORMx2/UNMx2 when k is not
+                                              larger than this value; otherwise it is also
+                                              the size of the blocks. */
+    rocsolver_tuning_gebrd_switchsize = 314, /**< GEBRD calls GEBD2 when min(m,n) is not larger
+                                               than this value; otherwise it is also the
+                                               size of the blocks. */
+    rocsolver_tuning_getrf_lookahead_switchsize = 315, /**< The blocked GETRF factorizes the
+                                                         next panel while the rest of the
+                                                         trailing matrix is updated
+                                                         (look-ahead) when min(m,n) is not
+                                                         smaller than this value. */
+    rocsolver_tuning_getrf_tslu_switchsize = 316, /**< When this value is positive, GETRF selects
+                                                    the pivots of the panels by tournament
+                                                    pivoting (TSLU) when m is not smaller
+                                                    than this value. The default, 0,
+                                                    disables it. */
+    rocsolver_tuning_gesvd_bdsdc_switchsize = 317, /**< When this value is positive, GESVD
+                                                     computes the singular vectors of the
+                                                     bidiagonal form with divide and conquer
+                                                     (BDSDC) instead of QR iterations (BDSQR)
+                                                     when min(m,n) is not smaller than this
+                                                     value. The default, 0, disables it. */
+} rocsolver_tuning_param;
+
+/*! \brief Counters of the work issued by a call to a rocSOLVER function
+ *(see rocsolver_get_call_counters)
+ ********************************************************************************/
+typedef struct rocsolver_call_counters_
+{
+    rocblas_int kernel_launches; /**< Kernels launched by rocSOLVER (the kernels launched
+                                   by the rocBLAS functions are not included). */
+    rocblas_int rocblas_calls; /**< Calls to rocBLAS functions. */
+    rocblas_int memcpys; /**< Synchronous copies between host and device memory. */
+    rocblas_int allocations; /**< Allocations of device memory, i.e. the times that the
+                               device memory of the handle had to be increased. */
+} rocsolver_call_counters;
+
 #endif
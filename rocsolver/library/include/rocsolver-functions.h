@@ -32,6 +32,155 @@ extern "C" {
 
 ROCSOLVER_EXPORT rocblas_status rocsolver_get_version_string(char* buf, size_t len);
 
+/*
+ * ===========================================================================
+ *      Tuning parameters
+ * ===========================================================================
+ */
+
+/*! \brief GET_TUNING_PARAMETER queries the value of a tuning parameter (a crossover
+    point or block size) used by rocSOLVER on the current device.
+
+    \details
+    The compiled default values can be overridden at run time, without rebuilding the library,
+    with entries of the form
+
+        arch  precision  parameter  min_size  max_size  value
+
+    where arch is the architecture name (e.g. gfx908), precision is one of s, d, c or z,
+    parameter is the name of the rocsolver_tuning_param without the rocsolver_tuning_ prefix
+    (e.g. getrf_switchsize), and [min_size, max_size] is the range of problem sizes the
+    entry applies to. A '*' in place of arch, precision or max_size matches any value.
+    When more than one entry matches, the one with the most specific arch and precision
+    is used, and among those, the last one that was added.
+
+    The entries are read, one per line, from the file named by the environment variable
+    ROCSOLVER_TUNING_FILE, and then from the environment variable ROCSOLVER_TUNING
+    (separated by ';'), when the handle is created or when a parameter is used for the first
+    time. Malformed sources are ignored. More entries can be added with
+    \ref rocsolver_set_tuning_parameter and \ref rocsolver_load_tuning_file.
+
+    The problem size is m for getrf_tslu_switchsize and getf2_optim_ngrp,
+    min(m,n) for the other getrf_* parameters, geqxf_*, gexqf_* and
+    gesvd_bdsdc_switchsize, n for potrf_switchsize and getri_*, and k for orgxx_*.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    param       rocsolver_tuning_param.\n
+                The tuning parameter to query.
+    @param[in]
+    precision   rocblas_datatype.\n
+                The precision of the routine (rocblas_datatype_f32_r, rocblas_datatype_f64_r,
+                rocblas_datatype_f32_c or rocblas_datatype_f64_c).
+    @param[in]
+    size        rocblas_int. size >= 0.\n
+                The problem size.
+    @param[out]
+    value       pointer to rocblas_int.\n
+                The value of the parameter that will be used.
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_tuning_parameter(rocblas_handle handle,
+                                                               const rocsolver_tuning_param param,
+                                                               const rocblas_datatype precision,
+                                                               const rocblas_int size,
+                                                               rocblas_int* value);
+
+/*! \brief SET_TUNING_PARAMETER overrides the value of a tuning parameter for the
+    architecture of the current device.
+
+    \details
+    The entry takes precedence over all the previous entries with the same precision.
+    Workspace sizes depend on the tuning parameters, so a workspace size query is only
+    valid for calls made with the same parameter values.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    param       rocsolver_tuning_param.\n
+                The tuning parameter to set.
+    @param[in]
+    precision   rocblas_datatype.\n
+                The precision of the routine (rocblas_datatype_f32_r, rocblas_datatype_f64_r,
+                rocblas_datatype_f32_c or rocblas_datatype_f64_c).
+    @param[in]
+    min_size    rocblas_int. min_size >= 0.\n
+                The smallest problem size the value applies to.
+    @param[in]
+    max_size    rocblas_int. max_size >= min_size, or max_size < 0.\n
+                The largest problem size the value applies to. If max_size < 0, there is
+                no upper bound.
+    @param[in]
+    value       rocblas_int. value >= 1.\n
+                The new value of the parameter.
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_tuning_parameter(rocblas_handle handle,
+                                                               const rocsolver_tuning_param param,
+                                                               const rocblas_datatype precision,
+                                                               const rocblas_int min_size,
+                                                               const rocblas_int max_size,
+                                                               const rocblas_int value);
+
+/*! \brief LOAD_TUNING_FILE adds the entries of a tuning file.
+
+    \details
+    See \ref rocsolver_get_tuning_parameter for the format of the file. If the file cannot be
+    read or any of its lines is malformed, no entry is added and rocblas_status_invalid_value
+    is returned.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    path        pointer to char.\n
+                The name of the file.
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_load_tuning_file(rocblas_handle handle,
+                                                           const char* path);
+
+/*! \brief RESET_TUNING discards all the tuning entries, including those read from the
+    environment, so that the compiled default values are used.
+
+    @param[in]
+    handle      rocblas_handle.
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_reset_tuning(rocblas_handle handle);
+
+/*
+ * ===========================================================================
+ *      Call counters
+ * ===========================================================================
+ */
+
+/*! \brief GET_CALL_COUNTERS returns the number of kernel launches, rocBLAS calls,
+    synchronous memory copies and device memory allocations made by the last call
+    to a rocSOLVER function made by the calling thread, if it was made with the
+    given handle.
+
+    \details
+    The counted call is the last one that started its computations; workspace size
+    queries and calls that return before doing any work because of invalid arguments
+    are not counted. The counters are kept by each host thread (without
+    synchronization between threads), so they must be read by the thread that made
+    the call, before it makes another call. If the last call of the thread was made
+    with another handle, or no call has been made, all the counters are zero. The
+    counters are always collected and do not depend on the timing of the device, so
+    they can be used to detect changes in the overhead of the routines (e.g. more
+    kernel launches for the same problem).
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[out]
+    counters    pointer to rocsolver_call_counters.\n
+                The counters of the last call.
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_get_call_counters(rocblas_handle handle,
+                                                            rocsolver_call_counters* counters);
+
 /*
  * ===========================================================================
  *      Auxiliary functions
@@ -3059,6 +3208,9 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zunmtr(rocblas_handle handle,
 
     Optionally, this function can also compute Ub'*C for a given n-by-nc input matrix C.
 
+    When no singular vectors are required (nv = nu = nc = 0), the singular values are computed
+    to high relative accuracy with the dqds algorithm instead of the implicit QR iteration.
+
     @param[in]
     handle      rocblas_handle.
     @param[in]
@@ -3087,6 +3239,8 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zunmtr(rocblas_handle handle,
                 On entry, the off-diagonal elements of B. On exit, if info > 0,
                 the off-diagonal elements of a bidiagonal matrix
                 orthogonally equivalent to B (if info = 0 this matrix converges to zero).
+                (If nv = nu = nc = 0 and info > 0, D and E contain intermediate values
+                of the dqds algorithm instead).
     @param[inout]
     V           pointer to type. Array on the GPU of dimension ldv*nv.\n
                 On entry, the matrix V. On exit, it is overwritten with Vb'*V.
@@ -3179,6 +3333,147 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zbdsqr(rocblas_handle handle,
                                                  const rocblas_int ldc,
                                                  rocblas_int* info);
 
+/*! @{
+    \brief BDSDC computes the singular value decomposition (SVD) of a
+    n-by-n bidiagonal matrix B, using a divide and conquer approach.
+
+    \details
+    The SVD of B has the form:
+
+        B = Ub * S * Vb'
+
+    where S is the n-by-n diagonal matrix of singular values of B, the columns of Ub are the left
+    singular vectors of B, and the columns of Vb are its right singular vectors.
+
+    B is split recursively at one of its rows, and the SVDs of the two halves are merged by
+    solving the secular equation of a rank-one modification, as in LAPACK. The singular vectors
+    of every merge are computed from the roots of the secular equation, so they are numerically
+    orthogonal, and they are applied with matrix-matrix products, so this function is usually
+    faster than BDSQR for large sizes when the singular vectors are required. The deflation
+    criteria are relative to the norm of each merge, so the singular values that are tiny
+    compared to the norm of B are computed with absolute (not relative) accuracy.
+
+    The computation of the singular vectors is optional; this function accepts input matrices
+    U (of size nu-by-n) and V (of size n-by-nv) that are overwritten with U*Ub and Vb'*V. If nu = 0
+    no left vectors are computed; if nv = 0 no right vectors are computed.
+
+    Optionally, this function can also compute Ub'*C for a given n-by-nc input matrix C.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether B is upper or lower bidiagonal.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The number of rows and columns of matrix B.
+    @param[in]
+    nv          rocblas_int. nv >= 0.\n
+                The number of columns of matrix V.
+    @param[in]
+    nu          rocblas_int. nu >= 0.\n
+                The number of rows of matrix U.
+    @param[in]
+    nc          rocblas_int. nu >= 0.\n
+                The number of columns of matrix C.
+    @param[inout]
+    D           pointer to real type. Array on the GPU of dimension n.\n
+                On entry, the diagonal elements of B. On exit,
+                the singular values of B in decreasing order.
+    @param[in]
+    E           pointer to real type. Array on the GPU of dimension n-1.\n
+                The off-diagonal elements of B. Not modified.
+    @param[inout]
+    V           pointer to type. Array on the GPU of dimension ldv*nv.\n
+                On entry, the matrix V. On exit, it is overwritten with Vb'*V.
+                (Not referenced if nv = 0).
+    @param[in]
+    ldv         rocblas_int. ldv >= n if nv > 0, or ldv >=1 if nv = 0.\n
+                Specifies the leading dimension of V.
+    @param[inout]
+    U           pointer to type. Array on the GPU of dimension ldu*n.\n
+                On entry, the matrix U. On exit, it is overwritten with U*Ub.
+                (Not referenced if nu = 0).
+    @param[in]
+    ldu         rocblas_int. ldu >= nu.\n
+                Specifies the leading dimension of U.
+    @param[inout]
+    C           pointer to type. Array on the GPU of dimension ldc*nc.\n
+                On entry, the matrix C. On exit, it is overwritten with Ub'*C.
+                (Not referenced if nc = 0).
+    @param[in]
+    ldc         rocblas_int. ldc >= n if nc > 0, or ldc >=1 if nc = 0.\n
+                Specifies the leading dimension of C.
+    @param[out]
+    info        pointer to a rocblas_int on the GPU.\n
+                If info = 0, successful exit.
+
+    ****************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sbdsdc(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n,
+                                                 const rocblas_int nv,
+                                                 const rocblas_int nu,
+                                                 const rocblas_int nc,
+                                                 float* D,
+                                                 float* E,
+                                                 float* V,
+                                                 const rocblas_int ldv,
+                                                 float* U,
+                                                 const rocblas_int ldu,
+                                                 float* C,
+                                                 const rocblas_int ldc,
+                                                 rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dbdsdc(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n,
+                                                 const rocblas_int nv,
+                                                 const rocblas_int nu,
+                                                 const rocblas_int nc,
+                                                 double* D,
+                                                 double* E,
+                                                 double* V,
+                                                 const rocblas_int ldv,
+                                                 double* U,
+                                                 const rocblas_int ldu,
+                                                 double* C,
+                                                 const rocblas_int ldc,
+                                                 rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cbdsdc(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n,
+                                                 const rocblas_int nv,
+                                                 const rocblas_int nu,
+                                                 const rocblas_int nc,
+                                                 float* D,
+                                                 float* E,
+                                                 rocblas_float_complex* V,
+                                                 const rocblas_int ldv,
+                                                 rocblas_float_complex* U,
+                                                 const rocblas_int ldu,
+                                                 rocblas_float_complex* C,
+                                                 const rocblas_int ldc,
+                                                 rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zbdsdc(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n,
+                                                 const rocblas_int nv,
+                                                 const rocblas_int nu,
+                                                 const rocblas_int nc,
+                                                 double* D,
+                                                 double* E,
+                                                 rocblas_double_complex* V,
+                                                 const rocblas_int ldv,
+                                                 rocblas_double_complex* U,
+                                                 const rocblas_int ldu,
+                                                 rocblas_double_complex* C,
+                                                 const rocblas_int ldc,
+                                                 rocblas_int* info);
+
 /*
  * ===========================================================================
  *      LAPACK functions
@@ -6652,6 +6947,9 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgebrd_strided_batched(rocblas_handle
 
     depending on the value of trans.
 
+    For small sizes (n <= 64), the permutation and the two triangular solves are computed
+    in a single kernel that keeps the factors in registers.
+
     @param[in]
     handle      rocblas_handle.
     @param[in]
@@ -6737,6 +7035,9 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs(rocblas_handle handle,
 
     depending on the value of trans.
 
+    For small sizes (n <= 64), the permutation and the two triangular solves are computed
+    in a single kernel that keeps the factors of each A_j in registers.
+
     @param[in]
     handle      rocblas_handle.
     @param[in]
@@ -6837,6 +7138,9 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_batched(rocblas_handle handle,
 
     depending on the value of trans.
 
+    For small sizes (n <= 64), the permutation and the two triangular solves are computed
+    in a single kernel that keeps the factors of each A_j in registers.
+
     @param[in]
     handle      rocblas_handle.
     @param[in]
@@ -6940,6 +7244,324 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_strided_batched(rocblas_handle
                                                                  const rocblas_int batch_count);
 //! @}
 
+/*! @{
+    \brief GESV solves a general system of n linear equations on n variables.
+
+    \details
+    The linear system is of the form
+
+        A * X = B
+
+    where A is a general n-by-n matrix. Matrix A is first factorized in triangular factors L and U
+    using GETRF; then, the solution is computed with GETRS.
+
+    For small sizes (n <= 64), the factorization and the solution are computed in a single kernel
+    that keeps A in local memory.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrix B.
+    @param[inout]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the matrix A.
+                On exit, the factors L and U from the factorization A = P*L*U returned by GETRF.
+                The unit diagonal elements of L are not stored.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.
+    @param[out]
+    ipiv        pointer to rocblas_int. Array on the GPU of dimension n.\n
+                The pivot indices returned by GETRF.
+    @param[in,out]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X if info = 0.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+    @param[out]
+    info        pointer to a rocblas_int on the GPU.\n
+                If info = 0, successful exit.
+                If info = j > 0, U is singular, and the solution could not be computed.
+                U(j,j) is the first zero pivot.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                rocblas_int* ipiv,
+                                                float* B,
+                                                const rocblas_int ldb,
+                                                rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                rocblas_int* ipiv,
+                                                double* B,
+                                                const rocblas_int ldb,
+                                                rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                rocblas_int* ipiv,
+                                                rocblas_float_complex* B,
+                                                const rocblas_int ldb,
+                                                rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                rocblas_int* ipiv,
+                                                rocblas_double_complex* B,
+                                                const rocblas_int ldb,
+                                                rocblas_int* info);
+//! @}
+
+/*! @{
+    \brief GESV_BATCHED solves a batch of general systems of n linear equations on n
+    variables.
+
+    \details
+    For each instance j in the batch, the linear system is of the form
+
+        A_j * X_j = B_j
+
+    where A_j is a general n-by-n matrix. Matrix A_j is first factorized in triangular factors
+    L_j and U_j using GETRF_BATCHED; then, the solution is computed with GETRS_BATCHED.
+
+    For small sizes (n <= 64), the factorization and the solution are computed in a single kernel
+    that keeps each A_j in local memory.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_j matrices.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[inout]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the matrices A_j.
+                On exit, the factors L_j and U_j from the factorization A_j = P_j*L_j*U_j returned by GETRF_BATCHED.
+                The unit diagonal elements of L_j are not stored.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[out]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                The vectors ipiv_j of pivot indices returned by GETRF_BATCHED.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in,out]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch, if info_j = 0.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[out]
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit for A_j.
+                If info_j = i > 0, U_j is singular, and the solution could not be computed.
+                U_j(i,i) is the first zero pivot.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        float* const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int* ipiv,
+                                                        const rocblas_stride strideP,
+                                                        float* const B[],
+                                                        const rocblas_int ldb,
+                                                        rocblas_int* info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        double* const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int* ipiv,
+                                                        const rocblas_stride strideP,
+                                                        double* const B[],
+                                                        const rocblas_int ldb,
+                                                        rocblas_int* info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        rocblas_float_complex* const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int* ipiv,
+                                                        const rocblas_stride strideP,
+                                                        rocblas_float_complex* const B[],
+                                                        const rocblas_int ldb,
+                                                        rocblas_int* info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        rocblas_double_complex* const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int* ipiv,
+                                                        const rocblas_stride strideP,
+                                                        rocblas_double_complex* const B[],
+                                                        const rocblas_int ldb,
+                                                        rocblas_int* info,
+                                                        const rocblas_int batch_count);
+//! @}
+
+/*! @{
+    \brief GESV_STRIDED_BATCHED solves a batch of general systems of n linear equations
+    on n variables.
+
+    \details
+    For each instance j in the batch, the linear system is of the form
+
+        A_j * X_j = B_j
+
+    where A_j is a general n-by-n matrix. Matrix A_j is first factorized in triangular factors
+    L_j and U_j using GETRF_STRIDED_BATCHED; then, the solution is computed with GETRS_STRIDED_BATCHED.
+
+    For small sizes (n <= 64), the factorization and the solution are computed in a single kernel
+    that keeps each A_j in local memory.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_j matrices.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[inout]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the matrices A_j.
+                On exit, the factors L_j and U_j from the factorization A_j = P_j*L_j*U_j returned by GETRF_STRIDED_BATCHED.
+                The unit diagonal elements of L_j are not stored.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[in]
+    strideA     rocblas_stride.\n
+                Stride from the start of one matrix A_j and the next one A_(j+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                The vectors ipiv_j of pivot indices returned by GETRF_STRIDED_BATCHED.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in,out]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch, if info_j = 0.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    strideB     rocblas_stride.\n
+                Stride from the start of one matrix B_j and the next one B_(j+1).
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[out]
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit for A_j.
+                If info_j = i > 0, U_j is singular, and the solution could not be computed.
+                U_j(i,i) is the first zero pivot.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv_strided_batched(rocblas_handle handle,
+                                                                const rocblas_int n,
+                                                                const rocblas_int nrhs,
+                                                                float* A,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                rocblas_int* ipiv,
+                                                                const rocblas_stride strideP,
+                                                                float* B,
+                                                                const rocblas_int ldb,
+                                                                const rocblas_stride strideB,
+                                                                rocblas_int* info,
+                                                                const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_strided_batched(rocblas_handle handle,
+                                                                const rocblas_int n,
+                                                                const rocblas_int nrhs,
+                                                                double* A,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                rocblas_int* ipiv,
+                                                                const rocblas_stride strideP,
+                                                                double* B,
+                                                                const rocblas_int ldb,
+                                                                const rocblas_stride strideB,
+                                                                rocblas_int* info,
+                                                                const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv_strided_batched(rocblas_handle handle,
+                                                                const rocblas_int n,
+                                                                const rocblas_int nrhs,
+                                                                rocblas_float_complex* A,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                rocblas_int* ipiv,
+                                                                const rocblas_stride strideP,
+                                                                rocblas_float_complex* B,
+                                                                const rocblas_int ldb,
+                                                                const rocblas_stride strideB,
+                                                                rocblas_int* info,
+                                                                const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_strided_batched(rocblas_handle handle,
+                                                                const rocblas_int n,
+                                                                const rocblas_int nrhs,
+                                                                rocblas_double_complex* A,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                rocblas_int* ipiv,
+                                                                const rocblas_stride strideP,
+                                                                rocblas_double_complex* B,
+                                                                const rocblas_int ldb,
+                                                                const rocblas_stride strideB,
+                                                                rocblas_int* info,
+                                                                const rocblas_int batch_count);
+//! @}
+
 /*! @{
     \brief GETRI inverts a general n-by-n matrix A using the LU factorization
     computed by GETRF.
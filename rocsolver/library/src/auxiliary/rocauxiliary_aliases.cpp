@@ -2,7 +2,9 @@
  * Copyright (c) 2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
+#include "logging.hpp"
 #include "rocsolver-aliases.h"
+#include "tuning.hpp"
 
 // We need to include extern definitions for these inline functions to ensure
 // that librocsolver.so will contain these symbols for FFI or when inlining
@@ -21,11 +23,14 @@ rocsolver_status rocsolver_create_handle(rocsolver_handle* handle)
     {
         return stat;
     }
+    rocsolver_init_tuning();
     return rocblas_set_pointer_mode(*handle, rocblas_pointer_mode_device);
 }
 
 rocsolver_status rocsolver_destroy_handle(rocsolver_handle handle)
 {
+    if(handle)
+        rocsolver_log_release(handle);
     return rocblas_destroy_handle(handle);
 }
 
@@ -0,0 +1,929 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     June 2017
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_BDSDC_H
+#define ROCLAPACK_BDSDC_H
+
+#include "common_device.hpp"
+#include "rocauxiliary_bdsqr.hpp"
+#include "rocblas.hpp"
+#include "rocsolver.h"
+
+/****************************************************************************
+(TODO:THIS IS BASIC IMPLEMENTATION. THE SVD OF THE n-by-n UPPER BIDIAGONAL MATRIX
+  B IS COMPUTED WITH A DIVIDE AND CONQUER ALGORITHM WORKING DIRECTLY ON B, AS IN
+  LAPACK'S LASD1, LASD2 AND LASD3: THE SVDS OF TWO SUBPROBLEMS ARE MERGED BY
+  DEFLATING AND SOLVING THE SECULAR EQUATION OF A RANK-ONE MODIFICATION (ONE
+  THREAD PER ROOT), THE UPDATING VECTOR IS RECOMPUTED FROM THE ROOTS (AS IN
+  GU AND EISENSTAT) SO THAT THE SINGULAR VECTORS OF THE MERGE ARE NUMERICALLY
+  ORTHOGONAL, AND THESE ARE APPLIED WITH GEMM. THE MERGES OF EACH LEVEL OF THE
+  TREE ARE SOLVED IN PARALLEL. UNLIKE LAPACK, THE LEAVES ARE THE 1-by-2 BLOCKS
+  OF B, WHICH ARE ALSO MERGES)
+
+  At the level of the tree with nodes of at most p - 1 rows (p = 2, 4, 8, ...),
+  node j covers rows [a, b) of B, with a = j * p and b = min(a + p - 1, n), and
+  also column b if b < n (sqre = 1). Row mid = a + p/2 - 1 joins the nodes of the
+  previous level [a, mid) and [mid + 1, b), and the node is only merged if mid < n.
+  The singular values of the node are stored in D at positions [a, b) (in any order),
+  with the corresponding singular vectors in the same columns of U and V. If sqre = 1,
+  column b of V is the null vector of the node.
+
+  Layout of the real workspace of each instance of the batch (arrays of size n, each
+  node uses the positions [a, b)):
+  ds | zs | dK | zK | zt | rc | rs | nv | nu | scl
+  Layout of the integer workspace of each instance of the batch:
+  src | kpos | idx | ri | rj | kk | perm
+***************************************************************************/
+
+/** BDSDC_MERGE_PREP prepares the merges of the level with nodes of p - 1 rows.
+    For each merge, it computes (scaled by the largest element of the merge) the
+    vector z of the rank-one modification (the row mid), rotates the null vector
+    of the right child into column mid, sorts the singular values of the two
+    children in ascending order, and deflates the small components of z and the
+    close singular values (applying the corresponding Givens rotations to the
+    singular vectors). dK and zK are the non-deflated values (the first one is
+    that of row mid), idx their positions in the node, and kpos the inverse
+    permutation (-1 if deflated). A workgroup works on each merge **/
+template <typename S>
+__global__ void bdsdc_merge_prep(const rocblas_int n,
+                                 const rocblas_int p,
+                                 S* DD,
+                                 const rocblas_stride strideD,
+                                 S* EE,
+                                 const rocblas_stride strideE,
+                                 S* UU,
+                                 S* VV,
+                                 const rocblas_stride strideQ,
+                                 S* workS,
+                                 const rocblas_stride strideS,
+                                 rocblas_int* workI,
+                                 const rocblas_stride strideI,
+                                 const S eps)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int nthds = hipBlockDim_x;
+    rocblas_int a = hipBlockIdx_x * p;
+    rocblas_int b = std::min(a + p - 1, n);
+    rocblas_int sqre = (b < n) ? 1 : 0;
+    rocblas_int r = b - a;
+    rocblas_int h = p / 2 - 1;
+
+    S* D = DD + bid * strideD + a;
+    S* E = EE + bid * strideE + a;
+    S* U = UU ? UU + bid * strideQ + a + a * n : nullptr;
+    S* V = VV + bid * strideQ + a + a * n;
+    S* ds = workS + bid * strideS + a;
+    S* zs = ds + n;
+    S* dK = ds + 2 * n;
+    S* zK = ds + 3 * n;
+    S* rc = ds + 5 * n;
+    S* rs = ds + 6 * n;
+    S* scl = ds + 9 * n;
+    rocblas_int* src = workI + bid * strideI + a;
+    rocblas_int* kpos = src + n;
+    rocblas_int* idx = src + 2 * n;
+    rocblas_int* ri = src + 3 * n;
+    rocblas_int* rj = src + 4 * n;
+    rocblas_int* kk = src + 5 * n;
+
+    // number of non-deflated singular values, number of rotations,
+    // tolerance and rotation of the null vector
+    __shared__ rocblas_int sk, sr;
+    __shared__ S stol, sc, ss;
+
+    // elements of row mid
+    S alpha = D[h];
+    S beta = (h + 1 < r + sqre) ? E[h] : 0;
+
+    // find the scaling factor
+    __shared__ S sval[BDSDC_MAX_THDS];
+    S smax = std::max(std::abs(alpha), std::abs(beta));
+    for(rocblas_int i = tid; i < r; i += nthds)
+    {
+        if(i != h)
+            smax = std::max(smax, D[i]);
+    }
+    sval[tid] = smax;
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        for(rocblas_int i = 1; i < nthds; ++i)
+            smax = std::max(smax, sval[i]);
+        stol = (smax > 0) ? 8 * eps : 0;
+        sval[0] = (smax > 0) ? smax : 1;
+        scl[0] = sval[0];
+    }
+    __syncthreads();
+    smax = sval[0];
+
+    // vector z of the rank-one modification, sorted in ascending order of the
+    // singular values of the children (row mid is excluded)
+    for(rocblas_int i = tid; i < r; i += nthds)
+    {
+        kpos[i] = -1;
+        if(i == h)
+            continue;
+
+        rocblas_int k = 0;
+        for(rocblas_int j = 0; j < r; ++j)
+        {
+            if(j != h && (D[j] < D[i] || (D[j] == D[i] && j < i)))
+                k++;
+        }
+        ds[k] = D[i] / smax;
+        zs[k] = (i < h ? alpha * V[h + i * n] : beta * V[h + 1 + i * n]) / smax;
+        src[k] = i;
+    }
+    __syncthreads();
+
+    // deflation
+    // (the sorted positions of the non-deflated values are listed in idx)
+    if(tid == 0)
+    {
+        S tol = stol;
+
+        // rotate the null vector of the right child into column mid
+        S zm = alpha * V[h + h * n] / smax;
+        S c = 1, s = 0;
+        if(sqre)
+        {
+            S zb = beta * V[h + 1 + r * n] / smax;
+            S hyp = std::sqrt(zm * zm + zb * zb);
+            if(hyp <= tol)
+                zm = tol;
+            else
+            {
+                c = zm / hyp;
+                s = zb / hyp;
+                zm = hyp;
+            }
+        }
+        else if(std::abs(zm) <= tol)
+            zm = tol;
+
+        rocblas_int nk = 1, nr = 0, pj = -1;
+        for(rocblas_int k = 0; k < r - 1; ++k)
+        {
+            // small component of z
+            if(std::abs(zs[k]) <= tol)
+                continue;
+            if(pj < 0)
+            {
+                pj = k;
+                continue;
+            }
+
+            // close singular values
+            if(ds[k] - ds[pj] <= tol)
+            {
+                S zj = zs[k];
+                S zp = zs[pj];
+                S tau = std::sqrt(zj * zj + zp * zp);
+                zs[k] = tau;
+                zs[pj] = 0;
+                ri[nr] = src[pj];
+                rj[nr] = src[k];
+                rc[nr] = zj / tau;
+                rs[nr] = -zp / tau;
+                nr++;
+            }
+            else
+                idx[nk++] = pj;
+            pj = k;
+        }
+        if(pj >= 0)
+            idx[nk++] = pj;
+
+        dK[0] = 0;
+        zK[0] = zm;
+        kk[0] = nk;
+        sk = nk;
+        sr = nr;
+        sc = c;
+        ss = s;
+    }
+    __syncthreads();
+
+    // non-deflated values
+    // (the smallest one is kept away from the singular value 0 of row mid)
+    for(rocblas_int i = tid; i < sk; i += nthds)
+    {
+        if(i == 0)
+        {
+            idx[0] = h;
+            kpos[h] = 0;
+            continue;
+        }
+
+        rocblas_int k = idx[i];
+        dK[i] = (i == 1) ? std::max(ds[k], stol / 2) : ds[k];
+        zK[i] = zs[k];
+        idx[i] = src[k];
+        kpos[src[k]] = i;
+    }
+
+    // apply the rotations to the singular vectors
+    for(rocblas_int i = tid; i < r + sqre; i += nthds)
+    {
+        if(sqre)
+        {
+            S x = V[i + h * n];
+            S y = V[i + r * n];
+            V[i + h * n] = sc * x + ss * y;
+            V[i + r * n] = sc * y - ss * x;
+        }
+        for(rocblas_int k = 0; k < sr; ++k)
+        {
+            S x = V[i + ri[k] * n];
+            S y = V[i + rj[k] * n];
+            V[i + ri[k] * n] = rc[k] * x + rs[k] * y;
+            V[i + rj[k] * n] = rc[k] * y - rs[k] * x;
+        }
+        if(U && i < r)
+        {
+            for(rocblas_int k = 0; k < sr; ++k)
+            {
+                S x = U[i + ri[k] * n];
+                S y = U[i + rj[k] * n];
+                U[i + ri[k] * n] = rc[k] * x + rs[k] * y;
+                U[i + rj[k] * n] = rc[k] * y - rs[k] * x;
+            }
+        }
+    }
+}
+
+/** BDSDC_SECULAR solves the secular equations of the merges of the level with
+    nodes of p - 1 rows. A thread computes each non-deflated singular value with a
+    safeguarded Newton iteration (relative to the closest pole), and stores the
+    differences dK(i) - sigma(j) and the sums dK(i) + sigma(j) (computed from the
+    closest pole to avoid cancellation) in the diagonal blocks of H and T.
+    The (unscaled) singular values overwrite D at the positions of idx **/
+template <typename S>
+__global__ void bdsdc_secular(const rocblas_int n,
+                              const rocblas_int p,
+                              S* DD,
+                              const rocblas_stride strideD,
+                              S* HH,
+                              S* TT,
+                              const rocblas_stride strideQ,
+                              S* workS,
+                              const rocblas_stride strideS,
+                              rocblas_int* workI,
+                              const rocblas_stride strideI,
+                              const S eps)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int a = hipBlockIdx_y * p;
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    rocblas_int k = workI[bid * strideI + 5 * n + a];
+    if(j >= k)
+        return;
+
+    S* D = DD + bid * strideD + a;
+    S* H = HH + bid * strideQ + a + a * n;
+    S* T = TT + bid * strideQ + a + a * n;
+    S* dK = workS + bid * strideS + a + 2 * n;
+    S* zK = dK + n;
+    S* scl = dK + 7 * n;
+    rocblas_int* idx = workI + bid * strideI + a + 2 * n;
+
+    rocblas_int org = j;
+    S tau;
+    if(k == 1)
+        tau = std::abs(zK[0]);
+    else
+    {
+        // find the origin (closest pole) and the bounds of the root
+        S lo, hi, f, fp;
+        if(j < k - 1)
+        {
+            S g = (dK[j + 1] - dK[j]) / 2;
+            f = 1;
+            for(rocblas_int i = 0; i < k; ++i)
+                f += zK[i] * zK[i] / (((dK[i] - dK[j]) - g) * ((dK[i] + dK[j]) + g));
+            if(f >= 0)
+            {
+                lo = 0;
+                hi = g;
+            }
+            else
+            {
+                org = j + 1;
+                lo = -g;
+                hi = 0;
+            }
+        }
+        else
+        {
+            S z2 = 0;
+            for(rocblas_int i = 0; i < k; ++i)
+                z2 += zK[i] * zK[i];
+            lo = 0;
+            hi = z2 / (std::sqrt(dK[j] * dK[j] + z2) + dK[j]);
+        }
+
+        // safeguarded Newton iteration
+        tau = (lo + hi) / 2;
+        for(rocblas_int it = 0; it < 400; ++it)
+        {
+            f = 1;
+            fp = 0;
+            for(rocblas_int i = 0; i < k; ++i)
+            {
+                S q = zK[i] / (((dK[i] - dK[org]) - tau) * ((dK[i] + dK[org]) + tau));
+                f += zK[i] * q;
+                fp += q * q;
+            }
+            fp *= 2 * (dK[org] + tau);
+            if(f == 0)
+                break;
+            if(f < 0)
+                lo = tau;
+            else
+                hi = tau;
+
+            S tn = tau - f / fp;
+            if(!(tn > lo && tn < hi))
+                tn = (lo + hi) / 2;
+            if(tn == tau || hi - lo <= 2 * eps * std::max(std::abs(lo), std::abs(hi)))
+            {
+                tau = tn;
+                break;
+            }
+            tau = tn;
+        }
+    }
+
+    D[idx[j]] = (dK[org] + tau) * scl[0];
+    for(rocblas_int i = 0; i < k; ++i)
+    {
+        H[i + j * n] = (dK[i] - dK[org]) - tau;
+        T[i + j * n] = (dK[i] + dK[org]) + tau;
+    }
+}
+
+/** BDSDC_LOWNER recomputes the vector z of the merges of the level with nodes of
+    p - 1 rows from the computed singular values (Lowner's theorem, as proposed by
+    Gu and Eisenstat), so that the singular vectors are numerically orthogonal.
+    The result is stored in zt **/
+template <typename S>
+__global__ void bdsdc_lowner(const rocblas_int n,
+                             const rocblas_int p,
+                             S* HH,
+                             S* TT,
+                             const rocblas_stride strideQ,
+                             S* workS,
+                             const rocblas_stride strideS,
+                             rocblas_int* workI,
+                             const rocblas_stride strideI)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int a = hipBlockIdx_y * p;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    rocblas_int k = workI[bid * strideI + 5 * n + a];
+    if(i >= k)
+        return;
+
+    S* H = HH + bid * strideQ + a + a * n;
+    S* T = TT + bid * strideQ + a + a * n;
+    S* dK = workS + bid * strideS + a + 2 * n;
+    S* zK = dK + n;
+    S* zt = dK + 2 * n;
+
+    S w = H[i + (k - 1) * n] * T[i + (k - 1) * n];
+    for(rocblas_int j = 0; j < i; ++j)
+        w *= H[i + j * n] * T[i + j * n] / ((dK[i] - dK[j]) * (dK[i] + dK[j]));
+    for(rocblas_int j = i; j < k - 1; ++j)
+        w *= H[i + j * n] * T[i + j * n] / ((dK[i] - dK[j + 1]) * (dK[i] + dK[j + 1]));
+    w = std::sqrt(std::abs(w));
+    zt[i] = (zK[i] < 0) ? -w : w;
+}
+
+/** BDSDC_VECTORS computes the (unnormalized) right singular vectors of the
+    rank-one modifications of the merges of the level with nodes of p - 1 rows.
+    They overwrite H. The norms of the right and left singular vectors are stored
+    in nv and nu **/
+template <typename S>
+__global__ void bdsdc_vectors(const rocblas_int n,
+                              const rocblas_int p,
+                              S* HH,
+                              S* TT,
+                              const rocblas_stride strideQ,
+                              S* workS,
+                              const rocblas_stride strideS,
+                              rocblas_int* workI,
+                              const rocblas_stride strideI)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int a = hipBlockIdx_y * p;
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    rocblas_int k = workI[bid * strideI + 5 * n + a];
+    if(j >= k)
+        return;
+
+    S* H = HH + bid * strideQ + a + a * n;
+    S* T = TT + bid * strideQ + a + a * n;
+    S* dK = workS + bid * strideS + a + 2 * n;
+    S* zt = dK + 2 * n;
+    S* nv = dK + 5 * n;
+    S* nu = dK + 6 * n;
+
+    if(k == 1)
+    {
+        H[0] = (zt[0] < 0) ? 1 : -1;
+        nv[0] = 1;
+        nu[0] = 1;
+        return;
+    }
+
+    // (the norms are computed with scaling to avoid overflow)
+    S vmax = 0, umax = 1;
+    for(rocblas_int i = 0; i < k; ++i)
+    {
+        S q = zt[i] / (H[i + j * n] * T[i + j * n]);
+        H[i + j * n] = q;
+        vmax = std::max(vmax, std::abs(q));
+        if(i > 0)
+            umax = std::max(umax, std::abs(dK[i] * q));
+    }
+    vmax = (vmax > 0) ? vmax : 1;
+
+    S sv = 0, su = 1 / (umax * umax);
+    for(rocblas_int i = 0; i < k; ++i)
+    {
+        S q = H[i + j * n];
+        sv += (q / vmax) * (q / vmax);
+        if(i > 0)
+            su += (dK[i] * q / umax) * (dK[i] * q / umax);
+    }
+    nv[j] = vmax * std::sqrt(sv);
+    nu[j] = umax * std::sqrt(su);
+}
+
+/** BDSDC_ASSEMBLE sets the diagonal blocks of T of the merges of the level with
+    nodes of p - 1 rows to the right singular vectors of the rank-one modifications
+    (if left is false), or overwrites them with the left singular vectors (if left is
+    true). The columns of the deflated singular values and of the null vector are
+    those of the identity **/
+template <typename S>
+__global__ void bdsdc_assemble(const rocblas_int n,
+                               const rocblas_int p,
+                               const rocblas_int nmerge,
+                               const bool left,
+                               S* HH,
+                               S* TT,
+                               const rocblas_stride strideQ,
+                               S* workS,
+                               const rocblas_stride strideS,
+                               rocblas_int* workI,
+                               const rocblas_stride strideI)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    // node of row i
+    if(i >= n || i / p >= nmerge)
+        return;
+    rocblas_int a = (i / p) * p;
+    rocblas_int b = std::min(a + p - 1, n);
+    rocblas_int r = b - a;
+    rocblas_int rb = (left || b == n) ? r : r + 1;
+    i -= a;
+    if(i >= rb || j >= rb)
+        return;
+
+    S* H = HH + bid * strideQ + a + a * n;
+    S* T = TT + bid * strideQ + a + a * n;
+    S* dK = workS + bid * strideS + a + 2 * n;
+    S* nv = dK + 5 * n;
+    S* nu = dK + 6 * n;
+    rocblas_int* kpos = workI + bid * strideI + a + n;
+
+    rocblas_int ki = (i < r) ? kpos[i] : -1;
+    rocblas_int kj = (j < r) ? kpos[j] : -1;
+    if(left)
+    {
+        if(ki >= 0 && kj >= 0)
+            T[i + j * n] = (ki == 0) ? -1 / nu[kj] : dK[ki] * T[i + j * n] * nv[kj] / nu[kj];
+    }
+    else if(kj >= 0)
+        T[i + j * n] = (ki >= 0) ? H[ki + kj * n] / nv[kj] : 0;
+    else
+        T[i + j * n] = (i == j) ? 1 : 0;
+}
+
+/** BDSDC_COPY_BLOCKS copies the diagonal blocks of A of the merges of the level
+    with nodes of p - 1 rows to B (including the null vector if left is false) **/
+template <typename S>
+__global__ void bdsdc_copy_blocks(const rocblas_int n,
+                                  const rocblas_int p,
+                                  const rocblas_int nmerge,
+                                  const bool left,
+                                  S* AA,
+                                  S* BB,
+                                  const rocblas_stride strideQ)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    // node of row i
+    if(i >= n || i / p >= nmerge)
+        return;
+    rocblas_int a = (i / p) * p;
+    rocblas_int b = std::min(a + p - 1, n);
+    rocblas_int rb = (left || b == n) ? b - a : b - a + 1;
+    i -= a;
+    if(i >= rb || j >= rb)
+        return;
+
+    S* A = AA + bid * strideQ + a + a * n;
+    S* B = BB + bid * strideQ + a + a * n;
+    B[i + j * n] = A[i + j * n];
+}
+
+/** BDSDC_SORT finds the permutation that sorts the singular values in decreasing
+    order. The sorted values are stored in ds **/
+template <typename S>
+__global__ void bdsdc_sort(const rocblas_int n,
+                           S* DD,
+                           const rocblas_stride strideD,
+                           S* workS,
+                           const rocblas_stride strideS,
+                           rocblas_int* workI,
+                           const rocblas_stride strideI)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i >= n)
+        return;
+
+    S* D = DD + bid * strideD;
+    S* ds = workS + bid * strideS;
+    rocblas_int* perm = workI + bid * strideI + 6 * n;
+
+    rocblas_int k = 0;
+    for(rocblas_int j = 0; j < n; ++j)
+    {
+        if(D[j] > D[i] || (D[j] == D[i] && j < i))
+            k++;
+    }
+    ds[k] = D[i];
+    perm[k] = i;
+}
+
+/** BDSDC_COPY_VECTORS sets Q to the left singular vectors of B (if left is true)
+    or to the transpose of its right singular vectors (if left is false), sorted as
+    the singular values. U and V are the left and right singular vectors of the
+    upper bidiagonal matrix (B' if B is lower bidiagonal) **/
+template <typename T, typename S>
+__global__ void bdsdc_copy_vectors(const rocblas_int n,
+                                   const rocblas_fill uplo,
+                                   const bool left,
+                                   S* UU,
+                                   S* VV,
+                                   const rocblas_stride strideQ,
+                                   T* QQ,
+                                   rocblas_int* workI,
+                                   const rocblas_stride strideI)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < n && j < n)
+    {
+        S* X = ((uplo == rocblas_fill_upper) == left ? UU : VV) + bid * strideQ;
+        T* Q = QQ + bid * strideQ;
+        rocblas_int* perm = workI + bid * strideI + 6 * n;
+
+        Q[i + j * n] = left ? T(X[i + perm[j] * n]) : T(X[j + perm[i] * n]);
+    }
+}
+
+/** BDSDC_GEMM_BLOCKS computes C = A * B for the diagonal blocks of the merges of
+    the level with nodes of p - 1 rows (including the null vector if left is false).
+    The blocks of full size of an instance are multiplied in a single strided call,
+    unless there are more instances in the batch than blocks **/
+template <typename S>
+void bdsdc_gemm_blocks(rocblas_handle handle,
+                       const rocblas_int n,
+                       const rocblas_int p,
+                       const rocblas_int nmerge,
+                       const bool left,
+                       S* A,
+                       S* B,
+                       S* C,
+                       const rocblas_stride strideQ,
+                       const rocblas_int batch_count,
+                       S* sscalars)
+{
+    // size of the full blocks and of the block of the last merge
+    rocblas_int m = left ? p - 1 : p;
+    rocblas_int a = (nmerge - 1) * p;
+    rocblas_int b = std::min(a + p - 1, n);
+    rocblas_int rl = (left || b == n) ? b - a : b - a + 1;
+    rocblas_int nfull = (rl == m) ? nmerge : nmerge - 1;
+    rocblas_stride strideM = p * (n + 1);
+
+    if(nfull >= batch_count)
+    {
+        for(rocblas_int bb = 0; bb < batch_count; ++bb)
+            rocblasCall_gemm<false, true, S>(
+                handle, rocblas_operation_none, rocblas_operation_none, m, m, m, (sscalars + 2),
+                (A + bb * strideQ), 0, n, strideM, (B + bb * strideQ), 0, n, strideM,
+                (sscalars + 1), (C + bb * strideQ), 0, n, strideM, nfull, (S**)nullptr);
+    }
+    else
+    {
+        for(rocblas_int k = 0; k < nfull; ++k)
+            rocblasCall_gemm<false, true, S>(handle, rocblas_operation_none, rocblas_operation_none,
+                                             m, m, m, (sscalars + 2), A, k * strideM, n, strideQ, B,
+                                             k * strideM, n, strideQ, (sscalars + 1), C,
+                                             k * strideM, n, strideQ, batch_count, (S**)nullptr);
+    }
+    if(nfull < nmerge)
+        rocblasCall_gemm<false, true, S>(handle, rocblas_operation_none, rocblas_operation_none, rl,
+                                         rl, rl, (sscalars + 2), A, a * (n + 1), n, strideQ, B,
+                                         a * (n + 1), n, strideQ, (sscalars + 1), C, a * (n + 1), n,
+                                         strideQ, batch_count, (S**)nullptr);
+}
+
+/** BDSDC_UPDATE_VECTORS overwrites the singular vectors with V = QV * V,
+    U = U * QU and C = QU' * C, where QV and QU are the n-by-n orthogonal
+    matrices with the singular vectors of the bidiagonal matrix.
+    tmp is a workspace of size n * max(nv, nu, nc) for every instance of the batch **/
+template <bool BATCHED, typename T, typename W>
+void bdsdc_update_vectors(rocblas_handle handle,
+                          const rocblas_int n,
+                          const rocblas_int nv,
+                          const rocblas_int nu,
+                          const rocblas_int nc,
+                          T* QV,
+                          T* QU,
+                          const rocblas_int ldq,
+                          const rocblas_stride strideQ,
+                          W V,
+                          const rocblas_int shiftV,
+                          const rocblas_int ldv,
+                          const rocblas_stride strideV,
+                          W U,
+                          const rocblas_int shiftU,
+                          const rocblas_int ldu,
+                          const rocblas_stride strideU,
+                          W C,
+                          const rocblas_int shiftC,
+                          const rocblas_int ldc,
+                          const rocblas_stride strideC,
+                          T* tmp,
+                          const rocblas_int batch_count,
+                          T* scalars,
+                          T** workArr)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_stride strideT = n * std::max(nv, std::max(nu, nc));
+
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+
+    rocblas_int blocks_n = (n - 1) / BS + 1;
+    if(nv)
+    {
+        rocblasCall_gemm<BATCHED, true, T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                           n, nv, n, (scalars + 2), QV, 0, ldq, strideQ, V, shiftV,
+                                           ldv, strideV, (scalars + 1), tmp, 0, n, strideT,
+                                           batch_count, workArr);
+        ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_n, (nv - 1) / BS + 1, batch_count),
+                                dim3(BS, BS), 0, stream, n, nv, tmp, 0, n, strideT, V, shiftV, ldv,
+                                strideV);
+    }
+    if(nu)
+    {
+        rocblasCall_gemm<BATCHED, true, T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                           nu, n, n, (scalars + 2), U, shiftU, ldu, strideU, QU, 0,
+                                           ldq, strideQ, (scalars + 1), tmp, 0, nu, strideT,
+                                           batch_count, workArr);
+        ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3((nu - 1) / BS + 1, blocks_n, batch_count),
+                                dim3(BS, BS), 0, stream, nu, n, tmp, 0, nu, strideT, U, shiftU, ldu,
+                                strideU);
+    }
+    if(nc)
+    {
+        rocblasCall_gemm<BATCHED, true, T>(handle, rocblas_operation_transpose,
+                                           rocblas_operation_none, n, nc, n, (scalars + 2), QU, 0,
+                                           ldq, strideQ, C, shiftC, ldc, strideC, (scalars + 1),
+                                           tmp, 0, n, strideT, batch_count, workArr);
+        ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_n, (nc - 1) / BS + 1, batch_count),
+                                dim3(BS, BS), 0, stream, n, nc, tmp, 0, n, strideT, C, shiftC, ldc,
+                                strideC);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+}
+
+template <typename T, typename S>
+void rocsolver_bdsdc_getMemorySize(const rocblas_int n,
+                                   const rocblas_int nv,
+                                   const rocblas_int nu,
+                                   const rocblas_int nc,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work)
+{
+    *size_work = 0;
+
+    // if quick return, no workspace is needed
+    if(n == 0 || batch_count == 0)
+        return;
+
+    bool vect = (nv || nu || nc);
+
+    // size of the result of the final GEMMs
+    *size_work = sizeof(T) * n * std::max(nv, std::max(nu, nc));
+
+    // size of the right (and left) singular vectors, and of the blocks of the
+    // merges and the results of their GEMMs
+    // (the last two also hold the sorted singular vectors of B)
+    *size_work += sizeof(S) * n * n * (vect ? 4 : 3);
+
+    // size of the real and integer arrays of the merge phase
+    *size_work += sizeof(S) * 10 * n + sizeof(rocblas_int) * 7 * n;
+
+    *size_work *= batch_count;
+}
+
+template <bool BATCHED, typename T, typename S, typename W>
+rocblas_status rocsolver_bdsdc_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nv,
+                                        const rocblas_int nu,
+                                        const rocblas_int nc,
+                                        S* D,
+                                        const rocblas_stride strideD,
+                                        S* E,
+                                        const rocblas_stride strideE,
+                                        W V,
+                                        const rocblas_int shiftV,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        W U,
+                                        const rocblas_int shiftU,
+                                        const rocblas_int ldu,
+                                        const rocblas_stride strideU,
+                                        W C,
+                                        const rocblas_int shiftC,
+                                        const rocblas_int ldc,
+                                        const rocblas_stride strideC,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        S* work,
+                                        T** workArr)
+{
+    rocsolver_stage stage(handle, "bdsdc");
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // constants {-1, 0, 1} of the real type for the GEMMs of the merge phase
+    S* sscalars = rocsolver_get_constants<S>();
+    if(!sscalars)
+        return rocblas_status_internal_error;
+
+    // machine precision (considering rounding strategy)
+    S eps = get_epsilon<S>() / 2;
+
+    const bool vect = (nv || nu || nc);
+    // the left singular vectors of the upper bidiagonal matrix are only needed
+    // for U and C (or for V if B is lower bidiagonal)
+    const bool left = (uplo == rocblas_fill_upper) ? (nu || nc) : (nv > 0);
+    const rocblas_stride strideQ = n * n;
+    const rocblas_stride strideS = 10 * n;
+    const rocblas_stride strideI = 7 * n;
+
+    // distribute the workspace
+    T* tmp = (T*)work;
+    S* Qh = (S*)(tmp + n * std::max(nv, std::max(nu, nc)) * batch_count);
+    S* Qt = Qh + strideQ * batch_count;
+    S* Qv = Qt + strideQ * batch_count;
+    S* Qu = Qv + strideQ * batch_count;
+    S* workS = Qu + (vect ? strideQ * batch_count : 0);
+    rocblas_int* workI = (rocblas_int*)(workS + strideS * batch_count);
+
+    rocblas_int nthds = std::min(BDSDC_MAX_THDS, ((n - 1) / WAVESIZE + 1) * WAVESIZE);
+    rocblas_int blocks = (n - 1) / BS + 1;
+
+    // initialize the singular vectors of the leaves
+    ROCSOLVER_LAUNCH_KERNEL(init_ident<S>, dim3(blocks, blocks, batch_count), dim3(BS, BS), 0,
+                            stream, n, n, Qv, 0, n, strideQ);
+    if(left)
+        ROCSOLVER_LAUNCH_KERNEL(init_ident<S>, dim3(blocks, blocks, batch_count), dim3(BS, BS), 0,
+                                stream, n, n, Qu, 0, n, strideQ);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3((batch_count - 1) / BS + 1), dim3(BS), 0, stream,
+                            info, batch_count, 0);
+
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+
+    // merge phase:
+    // at each level, the nodes of at most p - 1 rows are merged at their row p/2 - 1
+    for(rocblas_int p = 2; p / 2 <= n; p *= 2)
+    {
+        rocblas_int nmerge = (n - p / 2) / p + 1;
+        rocblas_int mm = std::min(p, n);
+        rocblas_int mthds = std::min(BDSDC_MAX_THDS, ((mm - 1) / WAVESIZE + 1) * WAVESIZE);
+        rocblas_int blocks_m = (mm - 1) / mthds + 1;
+        dim3 grid(blocks, (mm - 1) / BS + 1, batch_count);
+
+        // solve the rank-one modifications
+        ROCSOLVER_LAUNCH_KERNEL(bdsdc_merge_prep<S>, dim3(nmerge, 1, batch_count), dim3(mthds), 0,
+                                stream, n, p, D, strideD, E, strideE, (left ? Qu : nullptr), Qv,
+                                strideQ, workS, strideS, workI, strideI, eps);
+        ROCSOLVER_LAUNCH_KERNEL(bdsdc_secular<S>, dim3(blocks_m, nmerge, batch_count), dim3(mthds),
+                                0, stream, n, p, D, strideD, Qh, Qt, strideQ, workS, strideS, workI,
+                                strideI, eps);
+        ROCSOLVER_LAUNCH_KERNEL(bdsdc_lowner<S>, dim3(blocks_m, nmerge, batch_count), dim3(mthds),
+                                0, stream, n, p, Qh, Qt, strideQ, workS, strideS, workI, strideI);
+        ROCSOLVER_LAUNCH_KERNEL(bdsdc_vectors<S>, dim3(blocks_m, nmerge, batch_count), dim3(mthds),
+                                0, stream, n, p, Qh, Qt, strideQ, workS, strideS, workI, strideI);
+
+        // update the right singular vectors of the merged nodes: Qv = Qv * Vh
+        ROCSOLVER_LAUNCH_KERNEL(bdsdc_assemble<S>, grid, dim3(BS, BS), 0, stream, n, p, nmerge,
+                                false, Qh, Qt, strideQ, workS, strideS, workI, strideI);
+        bdsdc_gemm_blocks<S>(handle, n, p, nmerge, false, Qv, Qt, Qh, strideQ, batch_count,
+                             sscalars);
+        ROCSOLVER_LAUNCH_KERNEL(bdsdc_copy_blocks<S>, grid, dim3(BS, BS), 0, stream, n, p, nmerge,
+                                false, Qh, Qv, strideQ);
+
+        // update the left singular vectors of the merged nodes: Qu = Qu * Uh
+        if(left)
+        {
+            ROCSOLVER_LAUNCH_KERNEL(bdsdc_assemble<S>, grid, dim3(BS, BS), 0, stream, n, p, nmerge,
+                                    true, Qh, Qt, strideQ, workS, strideS, workI, strideI);
+            bdsdc_gemm_blocks<S>(handle, n, p, nmerge, true, Qu, Qt, Qh, strideQ, batch_count,
+                                 sscalars);
+            ROCSOLVER_LAUNCH_KERNEL(bdsdc_copy_blocks<S>, grid, dim3(BS, BS), 0, stream, n, p,
+                                    nmerge, true, Qh, Qu, strideQ);
+        }
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+
+    // sort the singular values in decreasing order
+    ROCSOLVER_LAUNCH_KERNEL(bdsdc_sort<S>, dim3((n - 1) / nthds + 1, 1, batch_count), dim3(nthds),
+                            0, stream, n, D, strideD, workS, strideS, workI, strideI);
+    ROCSOLVER_LAUNCH_KERNEL(copy_array<S>, dim3(blocks, 1, batch_count), dim3(BS, 1), 0, stream, n,
+                            1, workS, 0, n, strideS, D, 0, n, strideD);
+
+    // update singular vectors
+    // (the sorted singular vectors of B overwrite Qh and Qt)
+    if(vect)
+    {
+        T* Q = (T*)Qh;
+        if(nv)
+        {
+            ROCSOLVER_LAUNCH_KERNEL(bdsdc_copy_vectors<T>, dim3(blocks, blocks, batch_count),
+                                    dim3(BS, BS), 0, stream, n, uplo, false, Qu, Qv, strideQ, Q,
+                                    workI, strideI);
+            bdsdc_update_vectors<BATCHED, T>(handle, n, nv, 0, 0, Q, (T*)nullptr, n, strideQ, V,
+                                             shiftV, ldv, strideV, U, shiftU, ldu, strideU, C,
+                                             shiftC, ldc, strideC, tmp, batch_count, scalars,
+                                             workArr);
+        }
+        if(nu || nc)
+        {
+            ROCSOLVER_LAUNCH_KERNEL(bdsdc_copy_vectors<T>, dim3(blocks, blocks, batch_count),
+                                    dim3(BS, BS), 0, stream, n, uplo, true, Qu, Qv, strideQ, Q,
+                                    workI, strideI);
+            bdsdc_update_vectors<BATCHED, T>(handle, n, 0, nu, nc, (T*)nullptr, Q, n, strideQ, V,
+                                             shiftV, ldv, strideV, U, shiftU, ldu, strideU, C,
+                                             shiftC, ldc, strideC, tmp, batch_count, scalars,
+                                             workArr);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_BDSDC_H */
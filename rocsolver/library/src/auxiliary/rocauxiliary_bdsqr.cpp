@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_bdsqr.hpp"
+#include "logging.hpp"
 
 template <typename T, typename S, typename W>
 rocblas_status rocsolver_bdsqr_impl(rocblas_handle handle,
@@ -24,7 +25,9 @@ rocblas_status rocsolver_bdsqr_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "bdsqr", "--uplo", uplo, "-m", n, "-n", nv, "-k", nu, "--size4", nc,
+                     "D", D, "E", E, "V", V, "--lda", ldv, "U", U, "--ldb", ldu, "C", C,
+                     "--ldc", ldc, "info", info);
 
     // argument checking
     rocblas_status st
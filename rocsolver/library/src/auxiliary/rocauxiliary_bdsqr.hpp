@@ -15,14 +15,19 @@
 #include "rocsolver.h"
 
 /****************************************************************************
-(TODO:THIS IS BASIC IMPLEMENTATION. THE ONLY PARALLELISM INTRODUCED HERE IS
-  FOR THE BATCHED VERSIONS (A DIFFERENT THREAD WORKS ON EACH INSTANCE OF THE
-  BATCH). MORE PARALLELISM CAN BE INTRODUCED IN THE FUTURE IN AT LEAST TWO
-  WAYS:
+(TODO:THIS IS BASIC IMPLEMENTATION. A DIFFERENT WORKGROUP WORKS ON EACH
+  INSTANCE OF THE BATCH; WITHIN THE WORKGROUP, THE QR SWEEPS ON THE BIDIAGONAL
+  MATRIX ARE EXECUTED BY A SINGLE THREAD, WHILE THE ROTATIONS ARE APPLIED TO
+  THE SINGULAR VECTORS BY ALL THE THREADS IN PARALLEL. MORE PARALLELISM CAN BE
+  INTRODUCED IN THE FUTURE IN AT LEAST TWO WAYS:
   1. the split diagonal blocks can be worked in parallel as they are
   independent
   2. for each block, multiple threads can accelerate some of the reductions
-  and vector operations
+  THE ROTATIONS ARE NOT ACCUMULATED INTO BLOCKS AND APPLIED WITH GEMM: WITH A
+  SINGLE WORKGROUP PER INSTANCE, THAT NEEDS THE SHIFTS OF SEVERAL SWEEPS TO BE
+  CHOSEN AHEAD AND THE SWEEPS TO BE REORDERED IN A WAVEFRONT, SO THAT EACH
+  SMALL BLOCK OF ROTATIONS CAN BE FORMED, AND A HOST-DRIVEN LOOP TO LAUNCH THE
+  GEMMS)
 ***************************************************************************/
 
 /** LARTG device function computes the sine (s) and cosine (c) values
@@ -59,7 +64,8 @@ __device__ void lartg(T& f, T& g, T& c, T& s, T& r)
 /** LASR device function applies a sequence of rotations P(i) i=1,2,...z
     to a m-by-n matrix A from either the left (P*A with z=m) or the right (A*P'
    with z=n). P = P(z-1)*...*P(1) if forward direction, P = P(1)*...*P(z-1) if
-   backward direction. **/
+   backward direction. The independent columns (or rows) of A are distributed
+   among the threads of the workgroup. **/
 template <typename T, typename W>
 __device__ void lasr(const rocblas_side side,
                      const rocblas_direct direc,
@@ -70,6 +76,8 @@ __device__ void lasr(const rocblas_side side,
                      T* A,
                      const rocblas_int lda)
 {
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nthds = hipBlockDim_x;
     T temp;
     W cs, sn;
 
@@ -77,9 +85,9 @@ __device__ void lasr(const rocblas_side side,
     {
         if(direc == rocblas_forward_direction)
         {
-            for(rocblas_int i = 0; i < m - 1; ++i)
+            for(rocblas_int j = tid; j < n; j += nthds)
             {
-                for(rocblas_int j = 0; j < n; ++j)
+                for(rocblas_int i = 0; i < m - 1; ++i)
                 {
                     temp = A[i + j * lda];
                     cs = c[i];
@@ -91,9 +99,9 @@ __device__ void lasr(const rocblas_side side,
         }
         else
         {
-            for(rocblas_int i = m - 1; i > 0; --i)
+            for(rocblas_int j = tid; j < n; j += nthds)
             {
-                for(rocblas_int j = 0; j < n; ++j)
+                for(rocblas_int i = m - 1; i > 0; --i)
                 {
                     temp = A[i + j * lda];
                     cs = c[i];
@@ -109,9 +117,9 @@ __device__ void lasr(const rocblas_side side,
     {
         if(direc == rocblas_forward_direction)
         {
-            for(rocblas_int j = 0; j < n - 1; ++j)
+            for(rocblas_int i = tid; i < m; i += nthds)
             {
-                for(rocblas_int i = 0; i < m; ++i)
+                for(rocblas_int j = 0; j < n - 1; ++j)
                 {
                     temp = A[i + j * lda];
                     cs = c[j];
@@ -123,9 +131,9 @@ __device__ void lasr(const rocblas_side side,
         }
         else
         {
-            for(rocblas_int j = n - 1; j > 0; --j)
+            for(rocblas_int i = tid; i < m; i += nthds)
             {
-                for(rocblas_int i = 0; i < m; ++i)
+                for(rocblas_int j = n - 1; j > 0; --j)
                 {
                     temp = A[i + j * lda];
                     cs = c[j];
@@ -178,11 +186,12 @@ __device__ T maxval(const rocblas_int n, T* V)
     return maxv;
 }
 
-/** NEGVECT device function multiply a vector x of dimension n by -1**/
+/** NEGVECT device function multiply a vector x of dimension n by -1.
+    The elements of x are distributed among the threads of the workgroup **/
 template <typename T>
 __device__ void negvect(const rocblas_int n, T* x, const rocblas_int incx)
 {
-    for(rocblas_int i = 0; i < n; ++i)
+    for(rocblas_int i = hipThreadIdx_x; i < n; i += hipBlockDim_x)
     {
         if(x[incx * i] != 0)
             x[incx * i] = -x[incx * i];
@@ -191,20 +200,15 @@ __device__ void negvect(const rocblas_int n, T* x, const rocblas_int incx)
 
 /** T2BQRSTEP device function applies implicit QR interation to
     the n-by-n bidiagonal matrix given by D and E, using shift = sh,
-    from top to bottom **/
-template <typename S, typename W>
+    from top to bottom. The rotations are saved in rots to update the
+    singular vectors afterwards **/
+template <typename S>
 __device__ void t2bQRstep(const rocblas_int n,
                           const rocblas_int nv,
                           const rocblas_int nu,
                           const rocblas_int nc,
                           S* D,
                           S* E,
-                          W* V,
-                          const rocblas_int ldv,
-                          W* U,
-                          const rocblas_int ldu,
-                          W* C,
-                          const rocblas_int ldc,
                           const S sh,
                           S* rots)
 {
@@ -253,34 +257,19 @@ __device__ void t2bQRstep(const rocblas_int n,
         }
     }
     E[n - 2] = f;
-
-    // update singular vectors
-    if(nv)
-        lasr(rocblas_side_left, rocblas_forward_direction, n, nv, rots, rots + n - 1, V, ldv);
-    if(nu)
-        lasr(rocblas_side_right, rocblas_forward_direction, nu, n, rots + nr, rots + nr + n - 1, U,
-             ldu);
-    if(nc)
-        lasr(rocblas_side_left, rocblas_forward_direction, n, nc, rots + nr, rots + nr + n - 1, C,
-             ldc);
 }
 
 /** B2TQRSTEP device function applies implicit QR interation to
     the n-by-n bidiagonal matrix given by D and E, using shift = sh,
-    from bottom to top **/
-template <typename S, typename W>
+    from bottom to top. The rotations are saved in rots to update the
+    singular vectors afterwards **/
+template <typename S>
 __device__ void b2tQRstep(const rocblas_int n,
                           const rocblas_int nv,
                           const rocblas_int nu,
                           const rocblas_int nc,
                           S* D,
                           S* E,
-                          W* V,
-                          const rocblas_int ldv,
-                          W* U,
-                          const rocblas_int ldu,
-                          W* C,
-                          const rocblas_int ldc,
                           const S sh,
                           S* rots)
 {
@@ -329,20 +318,12 @@ __device__ void b2tQRstep(const rocblas_int n,
         }
     }
     E[0] = f;
-
-    // update singular vectors
-    if(nv)
-        lasr(rocblas_side_left, rocblas_backward_direction, n, nv, rots, rots + n - 1, V, ldv);
-    if(nu)
-        lasr(rocblas_side_right, rocblas_backward_direction, nu, n, rots + nr, rots + nr + n - 1, U,
-             ldu);
-    if(nc)
-        lasr(rocblas_side_left, rocblas_backward_direction, n, nc, rots + nr, rots + nr + n - 1, C,
-             ldc);
 }
 
 /** BDSQRKERNEL implements the main loop of the bdsqr algorithm
-    to compute the SVD of an upper bidiagonal matrix given by D and E **/
+    to compute the SVD of an upper bidiagonal matrix given by D and E.
+    The QR sweeps are executed by the first thread of the workgroup, and the
+    resulting rotations are applied to the singular vectors by all the threads **/
 template <typename T, typename S, typename W>
 __global__ void bdsqrKernel(const rocblas_int n,
                             const rocblas_int nv,
@@ -374,6 +355,8 @@ __global__ void bdsqrKernel(const rocblas_int n,
                             const rocblas_stride strideW)
 {
     rocblas_int bid = hipBlockIdx_x;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int nthds = hipBlockDim_x;
 
     // select batch instance to work with
     // (avoiding arithmetics with possible nullptrs)
@@ -390,130 +373,198 @@ __global__ void bdsqrKernel(const rocblas_int n,
     if(workA)
         rots = workA + bid * strideW;
 
-    // calculate threshold for zeroing elements (convergence threshold)
-    int t2b = (D[0] >= D[n - 1]) ? 1 : 0; // direction
-    S smin = estimate<S>(n, D, E, t2b, tol,
-                         0); // estimate of the smallest singular value
-    S thresh = std::max(tol * smin / S(std::sqrt(n)),
-                        S(maxiter) * sfm); // threshold
+    // state of the main loop shared with the workgroup:
+    // the QR step (if any) was applied to the block from sbeg to send
+    __shared__ rocblas_int sstep, sbeg, send, st2b;
 
     rocblas_int k = n - 1; // k is the last element of last unconverged diagonal block
     rocblas_int iter = 0; // iter is the number of iterations (QR steps) applied
-    rocblas_int i;
-    S sh, smax;
+    rocblas_int i, t2b;
+    S sh, smin, smax, thresh;
 
-    // main loop
-    while(k > 0 && iter < maxiter)
+    if(tid == 0)
     {
-        // split the diagonal blocks
-        for(rocblas_int j = 0; j < k + 1; ++j)
-        {
-            i = k - j - 1;
-            if(i >= 0 && std::abs(E[i]) < thresh)
-            {
-                E[i] = 0;
-                break;
-            }
-        }
+        // calculate threshold for zeroing elements (convergence threshold)
+        t2b = (D[0] >= D[n - 1]) ? 1 : 0; // direction
+        smin = estimate<S>(n, D, E, t2b, tol,
+                           0); // estimate of the smallest singular value
+        thresh = std::max(tol * smin / S(std::sqrt(n)),
+                          S(maxiter) * sfm); // threshold
+    }
 
-        // check if last singular value converged,
-        // if not, continue with the QR step
-        //(TODO: splitted blocks can be analyzed in parallel)
-        if(i == k - 1)
-            k--;
-        else
+    // main loop
+    while(true)
+    {
+        if(tid == 0)
         {
-            // last block goes from i+1 until k
-            // determine shift for the QR step
-            // (apply convergence test to find gaps)
-            i++;
-            if(std::abs(D[i]) >= std::abs(D[k]))
-            {
-                t2b = 1;
-                sh = std::abs(D[i]);
-            }
-            else
+            // look for the next QR step
+            sstep = 0;
+            while(k > 0 && iter < maxiter && !sstep)
             {
-                t2b = 0;
-                sh = std::abs(D[k]);
-            }
-            smin = estimate<S>(k - i + 1, D + i, E + i, t2b, tol, 1); // shift
-            smax = std::max(maxval<S>(k - i + 1, D + i),
-                            maxval<S>(k - i,
-                                      E + i)); // estimate of the largest singular value in the block
-
-            // check for gaps, if none then continue
-            if(smin >= 0)
-            {
-                if(smin / smax <= minshift)
-                    smin = 0; // shift set to zero if less than accepted value
-                else if(sh > 0)
+                // split the diagonal blocks
+                for(rocblas_int j = 0; j < k + 1; ++j)
                 {
-                    if(smin * smin / sh / sh < eps)
-                        smin = 0; // shift set to zero if negligible
+                    i = k - j - 1;
+                    if(i >= 0 && std::abs(E[i]) < thresh)
+                    {
+                        E[i] = 0;
+                        break;
+                    }
                 }
 
-                // apply QR step
-                iter += k - i;
-                if(t2b)
-                    t2bQRstep(k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv, U + i * ldu, ldu,
-                              C + i, ldc, smin, rots);
+                // check if last singular value converged,
+                // if not, continue with the QR step
+                //(TODO: splitted blocks can be analyzed in parallel)
+                if(i == k - 1)
+                    k--;
                 else
-                    b2tQRstep(k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv, U + i * ldu, ldu,
-                              C + i, ldc, smin, rots);
+                {
+                    // last block goes from i+1 until k
+                    // determine shift for the QR step
+                    // (apply convergence test to find gaps)
+                    i++;
+                    if(std::abs(D[i]) >= std::abs(D[k]))
+                    {
+                        t2b = 1;
+                        sh = std::abs(D[i]);
+                    }
+                    else
+                    {
+                        t2b = 0;
+                        sh = std::abs(D[k]);
+                    }
+                    smin = estimate<S>(k - i + 1, D + i, E + i, t2b, tol, 1); // shift
+                    // estimate of the largest singular value in the block
+                    smax = std::max(maxval<S>(k - i + 1, D + i), maxval<S>(k - i, E + i));
+
+                    // check for gaps, if none then continue
+                    if(smin >= 0)
+                    {
+                        if(smin / smax <= minshift)
+                            smin = 0; // shift set to zero if less than accepted value
+                        else if(sh > 0)
+                        {
+                            if(smin * smin / sh / sh < eps)
+                                smin = 0; // shift set to zero if negligible
+                        }
+
+                        // apply QR step
+                        iter += k - i;
+                        if(t2b)
+                            t2bQRstep(k - i + 1, nv, nu, nc, D + i, E + i, smin, rots);
+                        else
+                            b2tQRstep(k - i + 1, nv, nu, nc, D + i, E + i, smin, rots);
+
+                        sstep = 1;
+                        sbeg = i;
+                        st2b = t2b;
+                    }
+                }
             }
+            send = k;
         }
-    }
+        __syncthreads();
 
-    info[bid] = 0;
+        if(!sstep)
+            break;
+
+        // update singular vectors with the rotations of the QR step
+        rocblas_int nb = send - sbeg + 1;
+        rocblas_int nr = nv ? 2 * (nb - 1) : 0;
+        rocblas_direct direc = st2b ? rocblas_forward_direction : rocblas_backward_direction;
+        if(nv)
+            lasr(rocblas_side_left, direc, nb, nv, rots, rots + nb - 1, V + sbeg, ldv);
+        if(nu)
+            lasr(rocblas_side_right, direc, nu, nb, rots + nr, rots + nr + nb - 1, U + sbeg * ldu,
+                 ldu);
+        if(nc)
+            lasr(rocblas_side_left, direc, nb, nc, rots + nr, rots + nr + nb - 1, C + sbeg, ldc);
+        __syncthreads();
+    }
 
     // re-arrange singular values/vectors if algorithm converged
-    if(k == 0)
+    if(send == 0)
     {
         // all positive
         for(rocblas_int ii = 0; ii < n; ++ii)
         {
-            if(D[ii] < 0)
+            if(D[ii] < 0 && nv)
+                negvect(nv, V + ii, ldv);
+        }
+        __syncthreads();
+
+        if(tid == 0)
+        {
+            for(rocblas_int ii = 0; ii < n; ++ii)
             {
-                D[ii] = -D[ii];
-                if(nv)
-                    negvect(nv, V + ii, ldv);
+                if(D[ii] < 0)
+                    D[ii] = -D[ii];
             }
         }
 
         // in decreasing order
+        __shared__ rocblas_int sidx;
         rocblas_int idx;
+        T temp;
         for(rocblas_int ii = 0; ii < n - 1; ++ii)
         {
-            idx = ii;
-            smax = D[ii];
-            // detect maximum
-            for(rocblas_int jj = ii + 1; jj < n; ++jj)
+            __syncthreads();
+            if(tid == 0)
             {
-                if(D[jj] > smax)
+                idx = ii;
+                smax = D[ii];
+                // detect maximum
+                for(rocblas_int jj = ii + 1; jj < n; ++jj)
+                {
+                    if(D[jj] > smax)
+                    {
+                        idx = jj;
+                        smax = D[jj];
+                    }
+                }
+                // swap
+                if(idx != ii)
                 {
-                    idx = jj;
-                    smax = D[jj];
+                    D[idx] = D[ii];
+                    D[ii] = smax;
                 }
+                sidx = idx;
             }
-            // swap
+            __syncthreads();
+
+            // swap singular vectors
+            idx = sidx;
             if(idx != ii)
             {
-                D[idx] = D[ii];
-                D[ii] = smax;
-                if(nv)
-                    swapvect(nv, V + idx, ldv, V + ii, ldv);
-                if(nu)
-                    swapvect(nu, U + idx * ldu, 1, U + ii * ldu, 1);
-                if(nc)
-                    swapvect(nc, C + idx, ldc, C + ii, ldc);
+                for(rocblas_int j = tid; j < nv; j += nthds)
+                {
+                    temp = V[idx + j * ldv];
+                    V[idx + j * ldv] = V[ii + j * ldv];
+                    V[ii + j * ldv] = temp;
+                }
+                for(rocblas_int j = tid; j < nu; j += nthds)
+                {
+                    temp = U[j + idx * ldu];
+                    U[j + idx * ldu] = U[j + ii * ldu];
+                    U[j + ii * ldu] = temp;
+                }
+                for(rocblas_int j = tid; j < nc; j += nthds)
+                {
+                    temp = C[idx + j * ldc];
+                    C[idx + j * ldc] = C[ii + j * ldc];
+                    C[ii + j * ldc] = temp;
+                }
             }
         }
+
+        if(tid == 0)
+            info[bid] = 0;
     }
 
     // if not, set value of info
-    else
+    else if(tid == 0)
     {
+        info[bid] = 0;
         for(rocblas_int i = 0; i < n - 1; ++i)
             if(E[i] != 0)
                 info[bid] += 1;
@@ -521,7 +572,9 @@ __global__ void bdsqrKernel(const rocblas_int n,
 }
 
 /** LOWER2UPPER kernel transforms a lower bidiagonal matrix given by D and E
-    into an upper bidiagonal matrix via givens rotations **/
+    into an upper bidiagonal matrix via givens rotations. The rotations are
+    generated by the first thread of the workgroup and applied to the singular
+    vectors by all the threads **/
 template <typename T, typename S, typename W>
 __global__ void lower2upper(const rocblas_int n,
                             const rocblas_int nu,
@@ -557,25 +610,29 @@ __global__ void lower2upper(const rocblas_int n,
     if(workA)
         rots = workA + bid * strideW;
 
-    f = D[0];
-    g = E[0];
-    for(rocblas_int i = 0; i < n - 1; ++i)
+    if(hipThreadIdx_x == 0)
     {
-        // apply rotations by rows
-        lartg(f, g, c, s, r);
-        D[i] = r;
-        E[i] = -s * D[i + 1];
-        f = c * D[i + 1];
-        g = E[i + 1];
-
-        // save rotation to update singular vectors
-        if(nu || nc)
+        f = D[0];
+        g = E[0];
+        for(rocblas_int i = 0; i < n - 1; ++i)
         {
-            rots[i] = c;
-            rots[i + n - 1] = -s;
+            // apply rotations by rows
+            lartg(f, g, c, s, r);
+            D[i] = r;
+            E[i] = -s * D[i + 1];
+            f = c * D[i + 1];
+            g = E[i + 1];
+
+            // save rotation to update singular vectors
+            if(nu || nc)
+            {
+                rots[i] = c;
+                rots[i + n - 1] = -s;
+            }
         }
+        D[n - 1] = f;
     }
-    D[n - 1] = f;
+    __syncthreads();
 
     // update singular vectors
     if(nu)
@@ -584,7 +641,286 @@ __global__ void lower2upper(const rocblas_int n,
         lasr(rocblas_side_left, rocblas_forward_direction, n, nc, rots, rots + n - 1, C, ldc);
 }
 
-template <typename T>
+/** DQDS device function applies a dqds transform with shift tau to the
+    qd array of size n given by Q and E. If APPLY = false, Q and E are not
+    modified and the function only checks that the transform keeps the array
+    positive; it returns 0 if so, 1 if only the last auxiliary value becomes
+    negative (in which case dn is set to this value), and 2 otherwise.
+    If APPLY = true, the transform overwrites Q and E, and dmin (dmin1) is set to
+    the minimum of the auxiliary values (excluding the last one) **/
+template <bool APPLY, typename S>
+__device__ rocblas_int
+    dqds(const rocblas_int n, S* Q, S* E, const S tau, const S sfm, S& dn, S& dmin, S& dmin1)
+{
+    S d = Q[0] - tau;
+    S qh, t;
+    if(APPLY)
+        dmin1 = d;
+
+    for(rocblas_int i = 0; i < n - 1; ++i)
+    {
+        if(!APPLY && d < 0)
+            return 2;
+
+        qh = d + E[i];
+        if(APPLY)
+            dmin1 = std::min(dmin1, d);
+
+        // (avoid underflow and overflow of the ratio Q[i+1] / qh)
+        if(qh == 0)
+        {
+            t = 0;
+            d = Q[i + 1] - tau;
+        }
+        else if(sfm * Q[i + 1] < qh && sfm * qh < Q[i + 1])
+        {
+            t = Q[i + 1] / qh;
+            d = d * t - tau;
+            t = E[i] * t;
+        }
+        else
+        {
+            t = Q[i + 1] * (E[i] / qh);
+            d = Q[i + 1] * (d / qh) - tau;
+        }
+
+        if(APPLY)
+        {
+            Q[i] = qh;
+            E[i] = t;
+        }
+    }
+
+    dn = d;
+    if(APPLY)
+    {
+        Q[n - 1] = d;
+        dmin = std::min(dmin1, d);
+    }
+
+    return (d < 0) ? 1 : 0;
+}
+
+/** DQDS_SPLIT device function looks for the negligible elements of E in the
+    qd array of size n given by Q and E, and marks them with -sigma,
+    the accumulated shift of the corresponding blocks **/
+template <typename S>
+__device__ void dqds_split(const rocblas_int n, S* Q, S* E, const S sigma, const S tol2)
+{
+    for(rocblas_int i = 0; i < n - 1; ++i)
+    {
+        // (the last element of E is also negligible if it is small compared
+        // to the last element of Q)
+        if(E[i] <= tol2 * sigma || (i == n - 2 && E[i] <= tol2 * (sigma + Q[i + 1])))
+            E[i] = -sigma;
+    }
+}
+
+/** DQDS2X2 device function computes the eigenvalues of the 2-by-2 block
+    of a qd array given by Q[0], e and Q[1] **/
+template <typename S>
+__device__ void dqds2x2(S* Q, const S e, const S tol2)
+{
+    S a = Q[0];
+    S c = Q[1];
+    S s, t;
+
+    if(c > a)
+    {
+        s = c;
+        c = a;
+        a = s;
+    }
+
+    t = ((a - c) + e) / 2;
+    if(e > c * tol2 && t != 0)
+    {
+        s = c * (e / t);
+        if(s <= t)
+            s = c * (e / (t * (1 + std::sqrt(1 + s / t))));
+        else
+            s = c * (e / (t + std::sqrt(t) * std::sqrt(t + s)));
+        t = a + (s + e);
+        c = c * (a / t);
+        a = t;
+    }
+
+    Q[0] = a;
+    Q[1] = c;
+}
+
+/** DQDSKERNEL computes the singular values of the bidiagonal matrix given by D
+    and E (without singular vectors) with the dqds algorithm. Each thread works
+    on an instance of the batch. The squares of the elements of the bidiagonal
+    matrix (scaled by scl / max element) form the qd array, which is stored in D
+    and E, and the singular values converge from the bottom of the array.
+    (Negligible elements of E split the array; they are marked with -sigma,
+    where sigma is the accumulated shift of the block above them) **/
+template <typename S>
+__global__ void dqdsKernel(const rocblas_int n,
+                           S* DD,
+                           const rocblas_stride strideD,
+                           S* EE,
+                           const rocblas_stride strideE,
+                           rocblas_int* info,
+                           const rocblas_int maxiter,
+                           const S eps,
+                           const S sfm,
+                           const S tol2,
+                           const S scl,
+                           const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // select batch instance to work with
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+
+    // scale and square the elements of the bidiagonal matrix
+    S smax = 0;
+    for(rocblas_int i = 0; i < n; ++i)
+        smax = std::max(smax, std::abs(D[i]));
+    for(rocblas_int i = 0; i < n - 1; ++i)
+        smax = std::max(smax, std::abs(E[i]));
+
+    if(smax == 0)
+    {
+        for(rocblas_int i = 0; i < n; ++i)
+            D[i] = 0;
+        info[bid] = 0;
+        return;
+    }
+
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        D[i] = D[i] / smax * scl;
+        D[i] = D[i] * D[i];
+    }
+    for(rocblas_int i = 0; i < n - 1; ++i)
+    {
+        E[i] = E[i] / smax * scl;
+        E[i] = E[i] * E[i];
+    }
+    dqds_split(n, D, E, S(0), tol2);
+
+    // main loop
+    rocblas_int n0 = n - 1; // n0 is the last element of the last unconverged block
+    rocblas_int iter = 0; // iter is the number of dqds transforms applied
+    rocblas_int i0, ntry;
+    S sigma = 0, dmin = 0, dmin1 = 0, dn = 0, g = S(0.25);
+    S tau, s;
+    bool inner;
+    while(n0 >= 0)
+    {
+        // the last block goes from i0 until n0
+        i0 = n0;
+        while(i0 > 0 && E[i0 - 1] > 0)
+            i0--;
+
+        // deflate the block if it is of size 1 or 2
+        if(n0 - i0 < 2)
+        {
+            if(n0 > i0)
+                dqds2x2(D + i0, E[i0], tol2);
+            for(rocblas_int i = i0; i <= n0; ++i)
+                D[i] += sigma;
+
+            // (the auxiliary values of the last transform are still
+            // a good estimate if only the last element was deflated)
+            dmin = (n0 == i0) ? dmin1 : 0;
+            n0 = i0 - 1;
+            if(n0 >= 0)
+                sigma = -E[n0];
+            continue;
+        }
+
+        if(iter >= maxiter)
+            break;
+
+        // reverse the block if the largest values are at the bottom
+        if(S(1.5) * D[i0] < D[n0])
+        {
+            for(rocblas_int i = 0; i < (n0 - i0 + 1) / 2; ++i)
+            {
+                s = D[i0 + i];
+                D[i0 + i] = D[n0 - i];
+                D[n0 - i] = s;
+            }
+            for(rocblas_int i = 0; i < (n0 - i0) / 2; ++i)
+            {
+                s = E[i0 + i];
+                E[i0 + i] = E[n0 - 1 - i];
+                E[n0 - 1 - i] = s;
+            }
+        }
+
+        // determine the shift: dmin is an upper bound of the smallest eigenvalue.
+        // If dmin was attained at the last element, it is used as shift; if the
+        // transform then fails only at the last element, tau + dn is an excellent
+        // shift. Otherwise a fraction g of dmin is used, which grows while the
+        // transforms succeed. After a failure the shift is reduced
+        // (a zero shift always keeps the array positive)
+        inner = (dmin < dn);
+        tau = inner ? g * dmin : dmin;
+        for(ntry = 0; tau > 0; ++ntry)
+        {
+            rocblas_int fail = dqds<false>(n0 - i0 + 1, D + i0, E + i0, tau, sfm, dn, s, s);
+            if(!fail)
+                break;
+
+            g = S(0.25);
+            if(ntry >= 2)
+                tau = 0;
+            else if(fail == 1)
+                tau = std::max(S(0), (tau + dn) * (1 - 2 * eps));
+            else
+                tau = tau / 4;
+        }
+        if(inner && ntry == 0)
+            g += (1 - g) / 3;
+
+        // apply the dqds transform and look for new splits
+        dqds<true>(n0 - i0 + 1, D + i0, E + i0, tau, sfm, dn, dmin, dmin1);
+        sigma += tau;
+        iter++;
+        dqds_split(n0 - i0 + 1, D + i0, E + i0, sigma, tol2);
+    }
+
+    // unscale the singular values
+    for(rocblas_int i = 0; i < n; ++i)
+        D[i] = std::sqrt(std::max(D[i], S(0))) / scl * smax;
+
+    // if the algorithm did not converge, set value of info
+    if(n0 >= 0)
+    {
+        info[bid] = 0;
+        for(rocblas_int i = 0; i < n0; ++i)
+            if(E[i] > 0)
+                info[bid] += 1;
+        return;
+    }
+
+    // otherwise, sort the singular values in decreasing order
+    for(rocblas_int i = 1; i < n; ++i)
+    {
+        s = D[i];
+        rocblas_int j = i - 1;
+        while(j >= 0 && D[j] < s)
+        {
+            D[j + 1] = D[j];
+            j--;
+        }
+        D[j + 1] = s;
+    }
+
+    for(rocblas_int i = 0; i < n - 1; ++i)
+        E[i] = 0;
+    info[bid] = 0;
+}
+
+template <typename S>
 void rocsolver_bdsqr_getMemorySize(const rocblas_int n,
                                    const rocblas_int nv,
                                    const rocblas_int nu,
@@ -598,12 +934,16 @@ void rocsolver_bdsqr_getMemorySize(const rocblas_int n,
     if(n == 0 || batch_count == 0)
         return;
 
-    // size of workspace
+    // if only the singular values are required (dqds algorithm), no workspace is needed
+    if(!nv && !nu && !nc)
+        return;
+
+    // size of workspace to store the rotations
     if(nv)
         *size_work += 2;
     if(nu || nc)
         *size_work += 2;
-    *size_work *= sizeof(T) * n * batch_count;
+    *size_work *= sizeof(S) * n * batch_count;
 }
 
 template <typename S, typename W>
@@ -669,6 +1009,8 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
                                         const rocblas_int batch_count,
                                         S* work)
 {
+    rocsolver_stage stage(handle, "bdsqr");
+
     // quick return
     if(n == 0 || batch_count == 0)
         return rocblas_status_success;
@@ -689,6 +1031,25 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
     // value)
     S minshift = std::max(eps, tol / S(100)) / (n * tol);
 
+    // singular values only:
+    // the dqds algorithm is used instead of the QR iteration; it does not need
+    // the upper bidiagonal form nor any workspace
+    if(!nv && !nu && !nc)
+    {
+        // tolerance for the deflation of the qd array (relative to its elements)
+        S tol2 = S(100) * get_epsilon<S>();
+        tol2 *= tol2;
+        // scaling factor such that the squares of the elements do not overflow
+        S scl = std::sqrt(get_epsilon<S>() / sfm);
+
+        rocblas_int blocks = (batch_count - 1) / BS + 1;
+        ROCSOLVER_LAUNCH_KERNEL(dqdsKernel<S>, dim3(blocks, 1, 1), dim3(BS, 1, 1), 0, stream, n, D,
+                                strideD, E, strideE, info, 100 * n, eps, sfm, tol2, scl,
+                                batch_count);
+
+        return rocblas_status_success;
+    }
+
     rocblas_stride strideW = 0;
     if(nv)
         strideW += 2;
@@ -696,18 +1057,26 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
         strideW += 2;
     strideW *= n;
 
+    // a workgroup works on each instance of the batch; the number of threads
+    // depends on the number of rows/columns of the singular vectors to update
+    rocblas_int nvec = std::max(nv, std::max(nu, nc));
+    rocblas_int nthds
+        = nvec ? std::min(BDSQR_MAX_THDS, ((nvec - 1) / WAVESIZE + 1) * WAVESIZE) : 1;
+    dim3 grid(batch_count, 1, 1);
+    dim3 threads(nthds, 1, 1);
+
     // rotate to upper bidiagonal if necessary
     if(uplo == rocblas_fill_lower)
     {
-        hipLaunchKernelGGL((lower2upper<T>), dim3(batch_count), dim3(1), 0, stream, n, nu, nc, D,
-                           strideD, E, strideE, U, shiftU, ldu, strideU, C, shiftC, ldc, strideC,
-                           work, strideW);
+        ROCSOLVER_LAUNCH_KERNEL((lower2upper<T>), grid, threads, 0, stream, n, nu, nc, D, strideD,
+                                E, strideE, U, shiftU, ldu, strideU, C, shiftC, ldc, strideC, work,
+                                strideW);
     }
 
     // main computation of SVD
-    hipLaunchKernelGGL((bdsqrKernel<T>), dim3(batch_count), dim3(1), 0, stream, n, nv, nu, nc, D,
-                       strideD, E, strideE, V, shiftV, ldv, strideV, U, shiftU, ldu, strideU, C,
-                       shiftC, ldc, strideC, info, maxiter, eps, sfm, tol, minshift, work, strideW);
+    ROCSOLVER_LAUNCH_KERNEL((bdsqrKernel<T>), grid, threads, 0, stream, n, nv, nu, nc, D, strideD,
+                            E, strideE, V, shiftV, ldv, strideV, U, shiftU, ldu, strideU, C, shiftC,
+                            ldc, strideC, info, maxiter, eps, sfm, tol, minshift, work, strideW);
 
     return rocblas_status_success;
 }
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_labrd.hpp"
+#include "logging.hpp"
 
 template <typename S, typename T, typename U>
 rocblas_status rocsolver_labrd_impl(rocblas_handle handle,
@@ -23,7 +24,9 @@ rocblas_status rocsolver_labrd_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "labrd", "-m", m, "-n", n, "-k", k, "A", A, "--lda", lda, "D", D,
+                     "E", E, "tauq", tauq, "taup", taup, "X", X, "--ldb", ldx, "Y", Y,
+                     "--ldc", ldy);
 
     // argument checking
     rocblas_status st = rocsolver_labrd_argCheck(m, n, k, lda, ldx, ldy, A, D, E, tauq, taup, X, Y);
@@ -46,37 +49,34 @@ rocblas_status rocsolver_labrd_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of arrays of pointers (for batched cases) and re-usable workspace
     size_t size_work_workArr;
     // extra requirements for calling LARFG
     size_t size_norms;
-    rocsolver_labrd_getMemorySize<T, false>(m, n, k, batch_count, &size_scalars, &size_work_workArr,
-                                            &size_norms);
+    rocsolver_labrd_getMemorySize<T, false>(m, n, k, batch_count, &size_work_workArr, &size_norms);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
-                                                      size_norms);
+        return rocblas_set_optimal_device_memory_size(handle, size_work_workArr, size_norms);
 
     // memory workspace allocation
-    void *scalars, *work_workArr, *norms;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_norms);
+    void *work_workArr, *norms;
+    rocblas_device_malloc mem(handle, size_work_workArr, size_norms);
 
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work_workArr = mem[1];
-    norms = mem[2];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work_workArr = mem[0];
+    norms = mem[1];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_labrd_template<S, T>(handle, m, n, k, A, shiftA, lda, strideA, D, strideD, E,
                                           strideE, tauq, strideQ, taup, strideP, X, shiftX, ldx,
-                                          strideX, Y, shiftY, ldy, strideY, batch_count,
-                                          (T*)scalars, work_workArr, (T*)norms);
+                                          strideX, Y, shiftY, ldy, strideY, batch_count, scalars,
+                                          work_workArr, (T*)norms);
 }
 
 /*
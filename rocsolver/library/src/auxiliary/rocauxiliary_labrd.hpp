@@ -21,22 +21,17 @@ void rocsolver_labrd_getMemorySize(const rocblas_int m,
                                    const rocblas_int n,
                                    const rocblas_int k,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work_workArr,
                                    size_t* size_norms)
 {
     // if quick return no workspace needed
     if(m == 0 || n == 0 || k == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work_workArr = 0;
         *size_norms = 0;
         return;
     }
 
-    // size of scalars (constants) for rocblas calls
-    *size_scalars = sizeof(T) * 3;
-
     size_t s1, s2;
 
     // size of array of pointers (batched cases)
@@ -115,6 +110,8 @@ rocblas_status rocsolver_labrd_template(rocblas_handle handle,
                                         void* work_workArr,
                                         T* norms)
 {
+    rocsolver_stage stage(handle, "labrd");
+
     // quick return
     if(m == 0 || n == 0 || k == 0 || batch_count == 0)
         return rocblas_status_success;
@@ -161,8 +158,9 @@ rocblas_status rocsolver_labrd_template(rocblas_handle handle,
                                      (tauq + j), strideQ, // tau
                                      batch_count, (T*)work_workArr, norms);
 
-            hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, D, j,
-                               strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, 1, j < n - 1);
+            ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                    D, j, strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, 1,
+                                    j < n - 1);
 
             if(j < n - 1)
             {
@@ -233,9 +231,9 @@ rocblas_status rocsolver_labrd_template(rocblas_handle handle,
                     (taup + j), strideP, // tau
                     batch_count, (T*)work_workArr, norms);
 
-                hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
-                                   E, j, strideE, A, shiftA + idx2D(j, j + 1, lda), lda, strideA, 1,
-                                   true);
+                ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                        stream, E, j, strideE, A, shiftA + idx2D(j, j + 1, lda),
+                                        lda, strideA, 1, true);
 
                 // compute column j of X
                 rocblasCall_gemv<T>(
@@ -317,8 +315,9 @@ rocblas_status rocsolver_labrd_template(rocblas_handle handle,
                                      (taup + j), strideP, // tau
                                      batch_count, (T*)work_workArr, norms);
 
-            hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, D, j,
-                               strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, 1, j < m - 1);
+            ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                    D, j, strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, 1,
+                                    j < m - 1);
 
             if(j < m - 1)
             {
@@ -386,9 +385,9 @@ rocblas_status rocsolver_labrd_template(rocblas_handle handle,
                     (tauq + j), strideQ, // tau
                     batch_count, (T*)work_workArr, norms);
 
-                hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
-                                   E, j, strideE, A, shiftA + idx2D(j + 1, j, lda), lda, strideA, 1,
-                                   true);
+                ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                        stream, E, j, strideE, A, shiftA + idx2D(j + 1, j, lda),
+                                        lda, strideA, 1, true);
 
                 // compute column j of Y
                 rocblasCall_gemv<T>(
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_lacgv.hpp"
+#include "logging.hpp"
 
 template <typename T>
 rocblas_status
@@ -11,7 +12,7 @@ rocblas_status
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "lacgv", "-n", n, "x", x, "--incx", incx);
 
     // argument checking
     rocblas_status st = rocsolver_lacgv_argCheck(n, incx, x);
@@ -71,6 +71,8 @@ rocblas_status rocsolver_lacgv_template(rocblas_handle handle,
                                         const rocblas_stride stridex,
                                         const rocblas_int batch_count)
 {
+    rocsolver_stage stage(handle, "lacgv");
+
     // quick return
     if(n == 0 || !batch_count || !COMPLEX)
         return rocblas_status_success;
@@ -83,8 +85,8 @@ rocblas_status rocsolver_lacgv_template(rocblas_handle handle,
 
     // conjugate x
     rocblas_int blocks = (n - 1) / 64 + 1;
-    hipLaunchKernelGGL(conj_in_place<T>, dim3(1, blocks, batch_count), dim3(1, 64, 1), 0, stream, 1,
-                       n, x, offset, incx, stridex);
+    ROCSOLVER_LAUNCH_KERNEL(conj_in_place<T>, dim3(1, blocks, batch_count), dim3(1, 64, 1), 0,
+                            stream, 1, n, x, offset, incx, stridex);
 
     return rocblas_status_success;
 }
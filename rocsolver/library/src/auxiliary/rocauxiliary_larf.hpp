@@ -18,22 +18,17 @@ void rocsolver_larf_getMemorySize(const rocblas_side side,
                                   const rocblas_int m,
                                   const rocblas_int n,
                                   const rocblas_int batch_count,
-                                  size_t* size_scalars,
                                   size_t* size_Abyx,
                                   size_t* size_workArr)
 {
     // if quick return no workspace needed
     if(n == 0 || m == 0 || !batch_count)
     {
-        *size_scalars = 0;
         *size_Abyx = 0;
         *size_workArr = 0;
         return;
     }
 
-    // size of scalars (constants)
-    *size_scalars = sizeof(T) * 3;
-
     // size of temporary result in Householder matrix generation
     if(side == rocblas_side_left)
         *size_Abyx = n;
@@ -98,6 +93,8 @@ rocblas_status rocsolver_larf_template(rocblas_handle handle,
                                        T* Abyx,
                                        T** workArr)
 {
+    rocsolver_stage stage(handle, "larf");
+
     // quick return
     if(n == 0 || m == 0 || !batch_count)
         return rocblas_status_success;
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_larfb.hpp"
+#include "logging.hpp"
 
 template <typename T>
 rocblas_status rocsolver_larfb_impl(rocblas_handle handle,
@@ -23,7 +24,9 @@ rocblas_status rocsolver_larfb_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "larfb", "--side", side, "--transposeH", trans, "--direct", direct,
+                     "--storev", storev, "-m", m, "-n", n, "-k", k, "V", V, "--ldv", ldv, "F", F,
+                     "--ldt", ldf, "A", A, "--lda", lda);
 
     // argument checking
     rocblas_status st
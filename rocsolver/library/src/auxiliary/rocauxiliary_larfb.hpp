@@ -93,8 +93,10 @@ void rocsolver_larfb_getMemorySize(const rocblas_side side,
     *size_tmptr *= sizeof(T) * k * batch_count;
 
     // size of array of pointers to workspace
+    // (TRMM needs 3 arrays of pointers in the batched case: one for the workspace
+    // and two for the shifted matrices)
     if(BATCHED)
-        *size_workArr = sizeof(T*) * batch_count;
+        *size_workArr = sizeof(T*) * batch_count * 3;
     else
         *size_workArr = 0;
 
@@ -173,6 +175,8 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
                                         T* tmptr,
                                         T** workArr)
 {
+    rocsolver_stage stage(handle, "larfb");
+
     // quick return
     if(m == 0 || n == 0 || batch_count == 0)
         return rocblas_status_success;
@@ -287,8 +291,8 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
     // copy A1 to tmptr
     rocblas_int blocksx = (order - 1) / 32 + 1;
     rocblas_int blocksy = (ldw - 1) / 32 + 1;
-    hipLaunchKernelGGL(copymatA1, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0, stream, ldw,
-                       order, A, offsetA1, lda, strideA, tmptr);
+    ROCSOLVER_LAUNCH_KERNEL(copymatA1, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0, stream,
+                            ldw, order, A, offsetA1, lda, strideA, tmptr);
 
     // compute: V1' * A1
     //   or    A1 * V1
@@ -347,8 +351,8 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
 
     // compute: A1 - V1 * trans(T) * (V1' * A1 + V2' * A2)
     //    or    A1 - (A1 * V1 + A2 * V2) * trans(T) * V1'
-    hipLaunchKernelGGL(addmatA1, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0, stream, ldw,
-                       order, A, offsetA1, lda, strideA, tmptr);
+    ROCSOLVER_LAUNCH_KERNEL(addmatA1, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0, stream,
+                            ldw, order, A, offsetA1, lda, strideA, tmptr);
 
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_larfg.hpp"
+#include "logging.hpp"
 
 template <typename T>
 rocblas_status rocsolver_larfg_impl(rocblas_handle handle,
@@ -15,7 +16,7 @@ rocblas_status rocsolver_larfg_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "larfg", "-n", n, "alpha", alpha, "x", x, "--incx", incx, "tau", tau);
 
     // argument checking
     rocblas_status st = rocsolver_larfg_argCheck(n, incx, alpha, x, tau);
@@ -152,6 +152,8 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle,
                                         T* work,
                                         T* norms)
 {
+    rocsolver_stage stage(handle, "larfg");
+
     // quick return
     if(n == 0 || batch_count == 0)
         return rocblas_status_success;
@@ -164,7 +166,8 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle,
     dim3 threads(1, 1, 1);
     if(n == 1 && !COMPLEX)
     {
-        hipLaunchKernelGGL(reset_batch_info<T>, gridReset, threads, 0, stream, tau, strideP, 1, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>, gridReset, threads, 0, stream, tau, strideP, 1,
+                                0);
         return rocblas_status_success;
     }
 
@@ -179,8 +182,8 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle,
 
     // set value of tau and beta and scalling factor for vector x
     // alpha <- beta, norms <- scaling
-    hipLaunchKernelGGL(set_taubeta<T>, dim3(batch_count), dim3(1), 0, stream, tau, strideP, norms,
-                       alpha, shifta, stridex);
+    ROCSOLVER_LAUNCH_KERNEL(set_taubeta<T>, dim3(batch_count), dim3(1), 0, stream, tau, strideP,
+                            norms, alpha, shifta, stridex);
 
     // compute vector v=x*norms
     rocblasCall_scal<T>(handle, n - 1, norms, 1, x, shiftx, incx, stridex, batch_count);
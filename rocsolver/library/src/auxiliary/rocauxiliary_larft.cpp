@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_larft.hpp"
+#include "logging.hpp"
 
 template <typename T>
 rocblas_status rocsolver_larft_impl(rocblas_handle handle,
@@ -19,7 +20,8 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "larft", "--direct", direct, "--storev", storev, "-n", n, "-k", k,
+                     "V", V, "--ldv", ldv, "tau", tau, "F", F, "--ldt", ldf);
 
     // argument checking
     rocblas_status st = rocsolver_larft_argCheck(direct, storev, n, k, ldv, ldf, V, tau, F);
@@ -36,33 +38,31 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of re-usable workspace
     size_t size_work;
     // size of arrays of pointers (for batched cases)
     size_t size_workArr;
-    rocsolver_larft_getMemorySize<T, false>(n, k, batch_count, &size_scalars, &size_work,
-                                            &size_workArr);
+    rocsolver_larft_getMemorySize<T, false>(n, k, batch_count, &size_work, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_workArr);
 
     // memory workspace allocation
-    void *scalars, *work, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_workArr);
+    void *work, *workArr;
+    rocblas_device_malloc mem(handle, size_work, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work = mem[1];
-    workArr = mem[2];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work = mem[0];
+    workArr = mem[1];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_larft_template<T>(handle, direct, storev, n, k, V, shiftV, ldv, stridev, tau,
-                                       stridet, F, ldf, stridef, batch_count, (T*)scalars, (T*)work,
+                                       stridet, F, ldf, stridef, batch_count, scalars, (T*)work,
                                        (T**)workArr);
 }
 
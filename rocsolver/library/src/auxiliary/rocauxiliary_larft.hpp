@@ -141,22 +141,17 @@ template <typename T, bool BATCHED>
 void rocsolver_larft_getMemorySize(const rocblas_int n,
                                    const rocblas_int k,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work,
                                    size_t* size_workArr)
 {
     // if quick return, no workspace is needed
     if(n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work = 0;
         *size_workArr = 0;
         return;
     }
 
-    // size of scalars (constants)
-    *size_scalars = sizeof(T) * 3;
-
     // size of re-usable workspace
     *size_work = sizeof(T) * k * batch_count;
 
@@ -220,6 +215,8 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
                                         T* work,
                                         T** workArr)
 {
+    rocsolver_stage stage(handle, "larft");
+
     // quick return
     if(n == 0 || batch_count == 0)
         return rocblas_status_success;
@@ -241,9 +238,11 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
     // setup tau (changing signs) and account for the non-stored 1's on the
     // householder vectors
     rocblas_int blocks = (k - 1) / 32 + 1;
-    hipLaunchKernelGGL(set_triangular, dim3(blocks, blocks, batch_count), dim3(32, 32), 0, stream,
-                       n, k, V, shiftV, ldv, strideV, tau, strideT, F, ldf, strideF, direct, storev);
-    hipLaunchKernelGGL(set_tau, dim3(blocks, batch_count), dim3(32, 1), 0, stream, k, tau, strideT);
+    ROCSOLVER_LAUNCH_KERNEL(set_triangular, dim3(blocks, blocks, batch_count), dim3(32, 32), 0,
+                            stream, n, k, V, shiftV, ldv, strideV, tau, strideT, F, ldf, strideF,
+                            direct, storev);
+    ROCSOLVER_LAUNCH_KERNEL(set_tau, dim3(blocks, batch_count), dim3(32, 1), 0, stream, k, tau,
+                            strideT);
 
     if(direct == rocblas_forward_direction)
     {
@@ -334,7 +333,8 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
     }
 
     // restore tau
-    hipLaunchKernelGGL(set_tau, dim3(blocks, batch_count), dim3(32, 1), 0, stream, k, tau, strideT);
+    ROCSOLVER_LAUNCH_KERNEL(set_tau, dim3(blocks, batch_count), dim3(32, 1), 0, stream, k, tau,
+                            strideT);
 
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_laswp.hpp"
+#include "logging.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_laswp_impl(rocblas_handle handle,
@@ -17,7 +18,8 @@ rocblas_status rocsolver_laswp_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "laswp", "-n", n, "A", A, "--lda", lda, "--k1", k1, "--k2", k2,
+                     "ipiv", ipiv, "--incx", incx);
 
     // argument checking
     rocblas_status st = rocsolver_laswp_argCheck(n, lda, k1, k2, incx, A, ipiv);
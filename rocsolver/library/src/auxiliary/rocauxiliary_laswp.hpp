@@ -13,13 +13,19 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
+/** LASWP_KERNEL applies the complete sequence of row interchanges given by ipiv[k1:k2]
+    to the n columns of A in a single launch. Each thread owns one column and executes
+    the swaps sequentially in the order given by inc, so that the result is the
+    same as applying the interchanges one at a time. **/
 template <typename T, typename U>
 __global__ void laswp_kernel(const rocblas_int n,
                              U AA,
                              const rocblas_int shiftA,
                              const rocblas_int lda,
                              const rocblas_stride stride,
-                             const rocblas_int i,
+                             const rocblas_int start,
+                             const rocblas_int end,
+                             const rocblas_int inc,
                              const rocblas_int k1,
                              const rocblas_int* ipivA,
                              const rocblas_int shiftP,
@@ -27,17 +33,30 @@ __global__ void laswp_kernel(const rocblas_int n,
                              const rocblas_int incx)
 {
     int id = hipBlockIdx_y;
+    int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
-    // shiftP must be used so that ipiv[k1] is the desired first index of ipiv
-    const rocblas_int* ipiv = ipivA + id * strideP + shiftP;
-    rocblas_int exch = ipiv[k1 + (i - k1) * incx - 1];
-
-    // will exchange rows i and exch if they are not the same
-    if(exch != i)
+    if(tid < n)
     {
+        // shiftP must be used so that ipiv[k1] is the desired first index of ipiv
+        const rocblas_int* ipiv = ipivA + id * strideP + shiftP;
         T* A = load_ptr_batch(AA, id, shiftA, stride);
-        swap(n, A + i - 1, lda, A + exch - 1,
-             lda); // row indices are base-1 from the API
+        A += tid * lda;
+
+        rocblas_int exch;
+        T orig;
+        for(rocblas_int i = start; i != end; i += inc)
+        {
+            exch = ipiv[k1 + (i - k1) * incx - 1];
+
+            // will exchange rows i and exch if they are not the same
+            // (row indices are base-1 from the API)
+            if(exch != i)
+            {
+                orig = A[i - 1];
+                A[i - 1] = A[exch - 1];
+                A[exch - 1] = orig;
+            }
+        }
     }
 }
 
@@ -81,6 +100,8 @@ rocblas_status rocsolver_laswp_template(rocblas_handle handle,
                                         rocblas_int incx,
                                         const rocblas_int batch_count)
 {
+    rocsolver_stage stage(handle, "laswp");
+
     // quick return
     if(n == 0 || batch_count == 0)
         return rocblas_status_success;
@@ -107,11 +128,9 @@ rocblas_status rocsolver_laswp_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    for(rocblas_int i = start; i != end; i += inc)
-    {
-        hipLaunchKernelGGL(laswp_kernel<T>, gridPivot, threads, 0, stream, n, A, shiftA, lda,
-                           strideA, i, k1, ipiv, shiftP, strideP, incx);
-    }
+    // all the interchanges are applied by a single kernel launch
+    ROCSOLVER_LAUNCH_KERNEL(laswp_kernel<T>, gridPivot, threads, 0, stream, n, A, shiftA, lda,
+                            strideA, start, end, inc, k1, ipiv, shiftP, strideP, incx);
 
     return rocblas_status_success;
 }
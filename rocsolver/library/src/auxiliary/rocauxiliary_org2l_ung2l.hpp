@@ -48,22 +48,20 @@ template <typename T, bool BATCHED>
 void rocsolver_org2l_ung2l_getMemorySize(const rocblas_int m,
                                          const rocblas_int n,
                                          const rocblas_int batch_count,
-                                         size_t* size_scalars,
                                          size_t* size_Abyx,
                                          size_t* size_workArr)
 {
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_Abyx = 0;
         *size_workArr = 0;
         return;
     }
 
     // memory requirements to call larf
-    rocsolver_larf_getMemorySize<T, BATCHED>(rocblas_side_left, m, n, batch_count, size_scalars,
-                                             size_Abyx, size_workArr);
+    rocsolver_larf_getMemorySize<T, BATCHED>(rocblas_side_left, m, n, batch_count, size_Abyx,
+                                             size_workArr);
 }
 
 template <typename T, typename U>
@@ -106,6 +104,8 @@ rocblas_status rocsolver_org2l_ung2l_template(rocblas_handle handle,
                                               T* Abyx,
                                               T** workArr)
 {
+    rocsolver_stage stage(handle, is_complex<T> ? "ung2l" : "org2l");
+
     // quick return
     if(!n || !m || !batch_count)
         return rocblas_status_success;
@@ -121,8 +121,8 @@ rocblas_status rocsolver_org2l_ung2l_template(rocblas_handle handle,
     // Initialize identity matrix (non used rows)
     rocblas_int blocksx = (m - 1) / 32 + 1;
     rocblas_int blocksy = (n - 1) / 32 + 1;
-    hipLaunchKernelGGL(org2l_init_ident<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
-                       stream, m, n, k, A, shiftA, lda, strideA);
+    ROCSOLVER_LAUNCH_KERNEL(org2l_init_ident<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                            0, stream, m, n, k, A, shiftA, lda, strideA);
 
     for(rocblas_int j = 0; j < k; ++j)
     {
@@ -134,8 +134,8 @@ rocblas_status rocsolver_org2l_ung2l_template(rocblas_handle handle,
                                    shiftA, lda, strideA, batch_count, scalars, Abyx, workArr);
 
         // set the diagonal element and negative tau
-        hipLaunchKernelGGL(subtract_tau<T>, dim3(batch_count), dim3(1), 0, stream, m - n + jj, jj,
-                           A, shiftA, lda, strideA, ipiv + j, strideP);
+        ROCSOLVER_LAUNCH_KERNEL(subtract_tau<T>, dim3(batch_count), dim3(1), 0, stream, m - n + jj,
+                                jj, A, shiftA, lda, strideA, ipiv + j, strideP);
 
         // update i-th column -corresponding to H(i)-
         rocblasCall_scal<T>(handle, m - n + jj, ipiv + j, strideP, A, shiftA + idx2D(0, jj, lda), 1,
@@ -144,7 +144,8 @@ rocblas_status rocsolver_org2l_ung2l_template(rocblas_handle handle,
 
     // restore values of tau
     blocksx = (k - 1) / 128 + 1;
-    hipLaunchKernelGGL(restau<T>, dim3(blocksx, batch_count), dim3(128), 0, stream, k, ipiv, strideP);
+    ROCSOLVER_LAUNCH_KERNEL(restau<T>, dim3(blocksx, batch_count), dim3(128), 0, stream, k, ipiv,
+                            strideP);
 
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
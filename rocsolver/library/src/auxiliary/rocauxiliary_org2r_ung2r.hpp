@@ -49,22 +49,20 @@ template <typename T, bool BATCHED>
 void rocsolver_org2r_ung2r_getMemorySize(const rocblas_int m,
                                          const rocblas_int n,
                                          const rocblas_int batch_count,
-                                         size_t* size_scalars,
                                          size_t* size_Abyx,
                                          size_t* size_workArr)
 {
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_Abyx = 0;
         *size_workArr = 0;
         return;
     }
 
     // memory requirements to call larf
-    rocsolver_larf_getMemorySize<T, BATCHED>(rocblas_side_left, m, n, batch_count, size_scalars,
-                                             size_Abyx, size_workArr);
+    rocsolver_larf_getMemorySize<T, BATCHED>(rocblas_side_left, m, n, batch_count, size_Abyx,
+                                             size_workArr);
 }
 
 template <typename T, typename U>
@@ -107,6 +105,8 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
                                               T* Abyx,
                                               T** workArr)
 {
+    rocsolver_stage stage(handle, is_complex<T> ? "ung2r" : "org2r");
+
     // quick return
     if(!n || !m || !batch_count)
         return rocblas_status_success;
@@ -122,8 +122,8 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
     // Initialize identity matrix (non used columns)
     rocblas_int blocksx = (m - 1) / 32 + 1;
     rocblas_int blocksy = (n - 1) / 32 + 1;
-    hipLaunchKernelGGL(org2r_init_ident<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
-                       stream, m, n, k, A, shiftA, lda, strideA);
+    ROCSOLVER_LAUNCH_KERNEL(org2r_init_ident<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                            0, stream, m, n, k, A, shiftA, lda, strideA);
 
     for(rocblas_int j = k - 1; j >= 0; --j)
     {
@@ -137,8 +137,8 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
         }
 
         // set the diagonal element and negative tau
-        hipLaunchKernelGGL(subtract_tau<T>, dim3(batch_count), dim3(1), 0, stream, j, j, A, shiftA,
-                           lda, strideA, ipiv + j, strideP);
+        ROCSOLVER_LAUNCH_KERNEL(subtract_tau<T>, dim3(batch_count), dim3(1), 0, stream, j, j, A,
+                                shiftA, lda, strideA, ipiv + j, strideP);
 
         // update i-th column -corresponding to H(i)-
         if(j < m - 1)
@@ -150,8 +150,8 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
     if(k > 0)
     {
         blocksx = (k - 1) / 128 + 1;
-        hipLaunchKernelGGL(restau<T>, dim3(blocksx, batch_count), dim3(128), 0, stream, k, ipiv,
-                           strideP);
+        ROCSOLVER_LAUNCH_KERNEL(restau<T>, dim3(blocksx, batch_count), dim3(128), 0, stream, k,
+                                ipiv, strideP);
     }
 
     rocblas_set_pointer_mode(handle, old_mode);
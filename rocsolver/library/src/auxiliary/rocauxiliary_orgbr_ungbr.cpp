@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_orgbr_ungbr.hpp"
+#include "logging.hpp"
 
 template <typename T>
 rocblas_status rocsolver_orgbr_ungbr_impl(rocblas_handle handle,
@@ -17,7 +18,8 @@ rocblas_status rocsolver_orgbr_ungbr_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, is_complex<T> ? "ungbr" : "orgbr", "--storev", storev, "-m", m,
+                     "-n", n, "-k", k, "A", A, "--lda", lda, "ipiv", ipiv);
 
     // argument checking
     rocblas_status st = rocsolver_orgbr_argCheck(storev, m, n, k, lda, A, ipiv);
@@ -34,37 +36,35 @@ rocblas_status rocsolver_orgbr_ungbr_impl(rocblas_handle handle,
 
     // memory workspace sizes:
     // requirements for calling ORGQR/UNGQR or ORGLQ/UNGLQ
-    size_t size_scalars;
     size_t size_workArr;
     size_t size_work;
     size_t size_Abyx_tmptr;
     size_t size_trfact;
-    rocsolver_orgbr_ungbr_getMemorySize<T, false>(storev, m, n, k, batch_count, &size_scalars,
-                                                  &size_work, &size_Abyx_tmptr, &size_trfact,
-                                                  &size_workArr);
+    rocsolver_orgbr_ungbr_getMemorySize<T, false>(storev, m, n, k, batch_count, &size_work,
+                                                  &size_Abyx_tmptr, &size_trfact, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work,
-                                                      size_Abyx_tmptr, size_trfact, size_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_Abyx_tmptr,
+                                                      size_trfact, size_workArr);
 
     // memory workspace allocation
-    void *scalars, *work, *Abyx_tmptr, *trfact, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_Abyx_tmptr, size_trfact,
-                              size_workArr);
+    void *work, *Abyx_tmptr, *trfact, *workArr;
+    rocblas_device_malloc mem(handle, size_work, size_Abyx_tmptr, size_trfact, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work = mem[1];
-    Abyx_tmptr = mem[2];
-    trfact = mem[3];
-    workArr = mem[4];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work = mem[0];
+    Abyx_tmptr = mem[1];
+    trfact = mem[2];
+    workArr = mem[3];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_orgbr_ungbr_template<false, false, T>(
-        handle, storev, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, batch_count, (T*)scalars,
+        handle, storev, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars,
         (T*)work, (T*)Abyx_tmptr, (T*)trfact, (T**)workArr);
 }
 
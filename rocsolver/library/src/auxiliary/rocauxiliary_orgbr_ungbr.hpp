@@ -21,7 +21,6 @@ void rocsolver_orgbr_ungbr_getMemorySize(const rocblas_storev storev,
                                          const rocblas_int n,
                                          const rocblas_int k,
                                          const rocblas_int batch_count,
-                                         size_t* size_scalars,
                                          size_t* size_work,
                                          size_t* size_Abyx_tmptr,
                                          size_t* size_trfact,
@@ -30,7 +29,6 @@ void rocsolver_orgbr_ungbr_getMemorySize(const rocblas_storev storev,
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work = 0;
         *size_Abyx_tmptr = 0;
         *size_trfact = 0;
@@ -43,17 +41,17 @@ void rocsolver_orgbr_ungbr_getMemorySize(const rocblas_storev storev,
         // requirements for calling orgqr/ungqr
         if(m >= k)
         {
-            rocsolver_orgqr_ungqr_getMemorySize<T, BATCHED>(m, n, k, batch_count, size_scalars,
-                                                            size_work, size_Abyx_tmptr, size_trfact,
+            rocsolver_orgqr_ungqr_getMemorySize<T, BATCHED>(m, n, k, batch_count, size_work,
+                                                            size_Abyx_tmptr, size_trfact,
                                                             size_workArr);
         }
         else
         {
             size_t s1 = sizeof(T) * batch_count * (m - 1) * m / 2;
             size_t s2;
-            rocsolver_orgqr_ungqr_getMemorySize<T, BATCHED>(m - 1, m - 1, m - 1, batch_count,
-                                                            size_scalars, &s2, size_Abyx_tmptr,
-                                                            size_trfact, size_workArr);
+            rocsolver_orgqr_ungqr_getMemorySize<T, BATCHED>(m - 1, m - 1, m - 1, batch_count, &s2,
+                                                            size_Abyx_tmptr, size_trfact,
+                                                            size_workArr);
             *size_work = max(s1, s2);
         }
     }
@@ -63,17 +61,17 @@ void rocsolver_orgbr_ungbr_getMemorySize(const rocblas_storev storev,
         // requirements for calling orglq/unglq
         if(n > k)
         {
-            rocsolver_orglq_unglq_getMemorySize<T, BATCHED>(m, n, k, batch_count, size_scalars,
-                                                            size_work, size_Abyx_tmptr, size_trfact,
+            rocsolver_orglq_unglq_getMemorySize<T, BATCHED>(m, n, k, batch_count, size_work,
+                                                            size_Abyx_tmptr, size_trfact,
                                                             size_workArr);
         }
         else
         {
             size_t s1 = sizeof(T) * batch_count * (n - 1) * n / 2;
             size_t s2;
-            rocsolver_orglq_unglq_getMemorySize<T, BATCHED>(n - 1, n - 1, n - 1, batch_count,
-                                                            size_scalars, &s2, size_Abyx_tmptr,
-                                                            size_trfact, size_workArr);
+            rocsolver_orglq_unglq_getMemorySize<T, BATCHED>(n - 1, n - 1, n - 1, batch_count, &s2,
+                                                            size_Abyx_tmptr, size_trfact,
+                                                            size_workArr);
             *size_work = max(s1, s2);
         }
     }
@@ -129,6 +127,8 @@ rocblas_status rocsolver_orgbr_ungbr_template(rocblas_handle handle,
                                               T* trfact,
                                               T** workArr)
 {
+    rocsolver_stage stage(handle, is_complex<T> ? "ungbr" : "orgbr");
+
     // quick return
     if(!n || !m || !batch_count)
         return rocblas_status_success;
@@ -155,12 +155,14 @@ rocblas_status rocsolver_orgbr_ungbr_template(rocblas_handle handle,
             rocblas_int blocks = (m - 2) / BS + 1;
 
             // copy
-            hipLaunchKernelGGL(copyshift_right<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS), 0,
-                               stream, true, m - 1, A, shiftA, lda, strideA, work, 0, ldw, strideW);
+            ROCSOLVER_LAUNCH_KERNEL(copyshift_right<T>, dim3(blocks, blocks, batch_count),
+                                    dim3(BS, BS), 0, stream, true, m - 1, A, shiftA, lda, strideA,
+                                    work, 0, ldw, strideW);
 
             // shift
-            hipLaunchKernelGGL(copyshift_right<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS), 0,
-                               stream, false, m - 1, A, shiftA, lda, strideA, work, 0, ldw, strideW);
+            ROCSOLVER_LAUNCH_KERNEL(copyshift_right<T>, dim3(blocks, blocks, batch_count),
+                                    dim3(BS, BS), 0, stream, false, m - 1, A, shiftA, lda, strideA,
+                                    work, 0, ldw, strideW);
 
             // result
             rocsolver_orgqr_ungqr_template<BATCHED, STRIDED, T>(
@@ -188,12 +190,14 @@ rocblas_status rocsolver_orgbr_ungbr_template(rocblas_handle handle,
             rocblas_int blocks = (n - 2) / BS + 1;
 
             // copy
-            hipLaunchKernelGGL(copyshift_down<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS), 0,
-                               stream, true, n - 1, A, shiftA, lda, strideA, work, 0, ldw, strideW);
+            ROCSOLVER_LAUNCH_KERNEL(copyshift_down<T>, dim3(blocks, blocks, batch_count),
+                                    dim3(BS, BS), 0, stream, true, n - 1, A, shiftA, lda, strideA,
+                                    work, 0, ldw, strideW);
 
             // shift
-            hipLaunchKernelGGL(copyshift_down<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS), 0,
-                               stream, false, n - 1, A, shiftA, lda, strideA, work, 0, ldw, strideW);
+            ROCSOLVER_LAUNCH_KERNEL(copyshift_down<T>, dim3(blocks, blocks, batch_count),
+                                    dim3(BS, BS), 0, stream, false, n - 1, A, shiftA, lda, strideA,
+                                    work, 0, ldw, strideW);
 
             // result
             rocsolver_orglq_unglq_template<BATCHED, STRIDED, T>(
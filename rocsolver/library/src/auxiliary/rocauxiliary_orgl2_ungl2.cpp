@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_orgl2_ungl2.hpp"
+#include "logging.hpp"
 
 template <typename T>
 rocblas_status rocsolver_orgl2_ungl2_impl(rocblas_handle handle,
@@ -16,7 +17,8 @@ rocblas_status rocsolver_orgl2_ungl2_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, is_complex<T> ? "ungl2" : "orgl2", "-m", m, "-n", n, "-k", k, "A", A,
+                     "--lda", lda, "ipiv", ipiv);
 
     // argument checking
     rocblas_status st = rocsolver_orgl2_orglq_argCheck(m, n, k, lda, A, ipiv);
@@ -32,33 +34,31 @@ rocblas_status rocsolver_orgl2_ungl2_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of arrays of pointers (for batched cases)
     size_t size_workArr;
     // extra requirements for calling LARF
     size_t size_Abyx;
-    rocsolver_orgl2_ungl2_getMemorySize<T, false>(m, n, batch_count, &size_scalars, &size_Abyx,
-                                                  &size_workArr);
+    rocsolver_orgl2_ungl2_getMemorySize<T, false>(m, n, batch_count, &size_Abyx, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_Abyx, size_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_Abyx, size_workArr);
 
     // memory workspace allocation
-    void *scalars, *Abyx, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_Abyx, size_workArr);
+    void *Abyx, *workArr;
+    rocblas_device_malloc mem(handle, size_Abyx, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    Abyx = mem[1];
-    workArr = mem[2];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    Abyx = mem[0];
+    workArr = mem[1];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
-    return rocsolver_orgl2_ungl2_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv, strideP,
-                                             batch_count, (T*)scalars, (T*)Abyx, (T**)workArr);
+    return rocsolver_orgl2_ungl2_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv,
+                                             strideP, batch_count, scalars, (T*)Abyx, (T**)workArr);
 }
 
 /*
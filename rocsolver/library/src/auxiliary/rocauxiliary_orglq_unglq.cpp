@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_orglq_unglq.hpp"
+#include "logging.hpp"
 
 template <typename T>
 rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
@@ -16,7 +17,8 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, is_complex<T> ? "unglq" : "orglq", "-m", m, "-n", n, "-k", k, "A", A,
+                     "--lda", lda, "ipiv", ipiv);
 
     // argument checking
     rocblas_status st = rocsolver_orgl2_orglq_argCheck(m, n, k, lda, A, ipiv);
@@ -32,8 +34,6 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of arrays of pointers (for batched cases)
     size_t size_workArr;
     // size of re-usable workspace
@@ -42,31 +42,31 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
     size_t size_Abyx_tmptr;
     // size of temporary array for triangular factor
     size_t size_trfact;
-    rocsolver_orglq_unglq_getMemorySize<T, false>(m, n, k, batch_count, &size_scalars, &size_work,
+    rocsolver_orglq_unglq_getMemorySize<T, false>(m, n, k, batch_count, &size_work,
                                                   &size_Abyx_tmptr, &size_trfact, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work,
-                                                      size_Abyx_tmptr, size_trfact, size_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_Abyx_tmptr,
+                                                      size_trfact, size_workArr);
 
     // memory workspace allocation
-    void *scalars, *work, *Abyx_tmptr, *trfact, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_Abyx_tmptr, size_trfact,
-                              size_workArr);
+    void *work, *Abyx_tmptr, *trfact, *workArr;
+    rocblas_device_malloc mem(handle, size_work, size_Abyx_tmptr, size_trfact, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work = mem[1];
-    Abyx_tmptr = mem[2];
-    trfact = mem[3];
-    workArr = mem[4];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work = mem[0];
+    Abyx_tmptr = mem[1];
+    trfact = mem[2];
+    workArr = mem[3];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_orglq_unglq_template<false, false, T>(
-        handle, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, batch_count, (T*)scalars, (T*)work,
+        handle, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars, (T*)work,
         (T*)Abyx_tmptr, (T*)trfact, (T**)workArr);
 }
 
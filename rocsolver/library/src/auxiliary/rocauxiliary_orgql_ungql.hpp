@@ -21,7 +21,6 @@ void rocsolver_orgql_ungql_getMemorySize(const rocblas_int m,
                                          const rocblas_int n,
                                          const rocblas_int k,
                                          const rocblas_int batch_count,
-                                         size_t* size_scalars,
                                          size_t* size_work,
                                          size_t* size_Abyx_tmptr,
                                          size_t* size_trfact,
@@ -30,7 +29,6 @@ void rocsolver_orgql_ungql_getMemorySize(const rocblas_int m,
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work = 0;
         *size_Abyx_tmptr = 0;
         *size_trfact = 0;
@@ -38,11 +36,13 @@ void rocsolver_orgql_ungql_getMemorySize(const rocblas_int m,
         return;
     }
 
-    size_t s1, s2, s3, unused;
-    rocsolver_org2l_ung2l_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars,
-                                                    size_Abyx_tmptr, size_workArr);
+    size_t s1, s2, s3, a1, unused;
+    rocsolver_org2l_ung2l_getMemorySize<T, BATCHED>(m, n, batch_count, size_Abyx_tmptr,
+                                                    size_workArr);
 
-    if(k <= ORGxx_UNGxx_SWITCHSIZE)
+    rocblas_int nx = rocsolver_get_tuning<T>(rocsolver_tuning_orgxx_switchsize, k);
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_orgxx_blocksize, k);
+    if(k <= nx)
     {
         *size_work = 0;
         *size_trfact = 0;
@@ -50,19 +50,22 @@ void rocsolver_orgql_ungql_getMemorySize(const rocblas_int m,
 
     else
     {
-        rocblas_int jb = ORGxx_UNGxx_BLOCKSIZE;
-        rocblas_int j = ((k - ORGxx_UNGxx_SWITCHSIZE - 1) / jb) * jb;
+        rocblas_int jb = nb;
+        rocblas_int j = ((k - nx - 1) / jb) * jb;
         rocblas_int kk = min(k, j + jb);
 
         // size of workspace is maximum of what is needed by larft and larfb.
         // size of Abyx_tmptr is maximum of what is needed by org2r/ung2r and larfb.
-        rocsolver_larft_getMemorySize<T, BATCHED>(m, jb, batch_count, &unused, &s1, &unused);
+        rocsolver_larft_getMemorySize<T, BATCHED>(m, jb, batch_count, &s1, &unused);
         rocsolver_larfb_getMemorySize<T, BATCHED>(rocblas_side_left, m, n - jb, jb, batch_count,
-                                                  &s2, &s3, &unused);
+                                                  &s2, &s3, &a1);
 
         *size_work = max(s1, s2);
         *size_Abyx_tmptr = *size_Abyx_tmptr >= s3 ? *size_Abyx_tmptr : s3;
 
+        // size of workArr is the maximum of what is needed by org2l/ung2l and larfb
+        *size_workArr = max(*size_workArr, a1);
+
         // size of temporary array for triangular factor
         *size_trfact = sizeof(T) * jb * jb * batch_count;
     }
@@ -86,6 +89,8 @@ rocblas_status rocsolver_orgql_ungql_template(rocblas_handle handle,
                                               T* trfact,
                                               T** workArr)
 {
+    rocsolver_stage stage(handle, is_complex<T> ? "ungql" : "orgql");
+
     // quick return
     if(!n || !m || !batch_count)
         return rocblas_status_success;
@@ -94,16 +99,18 @@ rocblas_status rocsolver_orgql_ungql_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // if the matrix is small, use the unblocked variant of the algorithm
-    if(k <= ORGxx_UNGxx_SWITCHSIZE)
+    rocblas_int nx = rocsolver_get_tuning<T>(rocsolver_tuning_orgxx_switchsize, k);
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_orgxx_blocksize, k);
+    if(k <= nx)
         return rocsolver_org2l_ung2l_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv,
                                                  strideP, batch_count, scalars, Abyx_tmptr, workArr);
 
-    rocblas_int ldw = ORGxx_UNGxx_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
     // size of blocked part
-    rocblas_int jb = ORGxx_UNGxx_BLOCKSIZE;
-    rocblas_int kk = min(k, ((k - ORGxx_UNGxx_SWITCHSIZE + jb - 1) / jb) * jb);
+    rocblas_int jb = nb;
+    rocblas_int kk = min(k, ((k - nx + jb - 1) / jb) * jb);
 
     // start of first blocked block is j + n - k = n - kk
     rocblas_int j = k - kk;
@@ -116,8 +123,9 @@ rocblas_status rocsolver_orgql_ungql_template(rocblas_handle handle,
     {
         blocksx = (kk - 1) / 32 + 1;
         blocksy = (n - kk - 1) / 32 + 1;
-        hipLaunchKernelGGL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
-                           stream, kk, n - kk, A, shiftA + idx2D(m - kk, 0, lda), lda, strideA);
+        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                                stream, kk, n - kk, A, shiftA + idx2D(m - kk, 0, lda), lda,
+                                strideA);
 
         rocsolver_org2l_ung2l_template<T>(handle, m - kk, n - kk, k - kk, A, shiftA, lda, strideA,
                                           ipiv, strideP, batch_count, scalars, Abyx_tmptr, workArr);
@@ -148,9 +156,9 @@ rocblas_status rocsolver_orgql_ungql_template(rocblas_handle handle,
         {
             blocksx = (k - j - jb - 1) / 32 + 1;
             blocksy = (jb - 1) / 32 + 1;
-            hipLaunchKernelGGL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
-                               stream, k - j - jb, jb, A,
-                               shiftA + idx2D(m - k + j + jb, n - k + j, lda), lda, strideA);
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                                    0, stream, k - j - jb, jb, A,
+                                    shiftA + idx2D(m - k + j + jb, n - k + j, lda), lda, strideA);
         }
         rocsolver_org2l_ung2l_template<T>(handle, m - k + j + jb, jb, jb, A,
                                           shiftA + idx2D(0, n - k + j, lda), lda, strideA, (ipiv + j),
@@ -19,7 +19,6 @@ template <typename T, bool BATCHED>
 void rocsolver_orgtr_ungtr_getMemorySize(const rocblas_fill uplo,
                                          const rocblas_int n,
                                          const rocblas_int batch_count,
-                                         size_t* size_scalars,
                                          size_t* size_work,
                                          size_t* size_Abyx_tmptr,
                                          size_t* size_trfact,
@@ -28,7 +27,6 @@ void rocsolver_orgtr_ungtr_getMemorySize(const rocblas_fill uplo,
     // if quick return no workspace needed
     if(n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work = 0;
         *size_Abyx_tmptr = 0;
         *size_trfact = 0;
@@ -41,17 +39,15 @@ void rocsolver_orgtr_ungtr_getMemorySize(const rocblas_fill uplo,
     if(uplo == rocblas_fill_upper)
     {
         // requirements for calling orgql/ungql
-        rocsolver_orgql_ungql_getMemorySize<T, BATCHED>(n - 1, n - 1, n - 1, batch_count,
-                                                        size_scalars, &w2, size_Abyx_tmptr,
-                                                        size_trfact, size_workArr);
+        rocsolver_orgql_ungql_getMemorySize<T, BATCHED>(n - 1, n - 1, n - 1, batch_count, &w2,
+                                                        size_Abyx_tmptr, size_trfact, size_workArr);
     }
 
     else
     {
         // requirements for calling orgqr/ungqr
-        rocsolver_orgqr_ungqr_getMemorySize<T, BATCHED>(n - 1, n - 1, n - 1, batch_count,
-                                                        size_scalars, &w2, size_Abyx_tmptr,
-                                                        size_trfact, size_workArr);
+        rocsolver_orgqr_ungqr_getMemorySize<T, BATCHED>(n - 1, n - 1, n - 1, batch_count, &w2,
+                                                        size_Abyx_tmptr, size_trfact, size_workArr);
     }
     *size_work = max(w1, w2);
 }
@@ -97,6 +93,8 @@ rocblas_status rocsolver_orgtr_ungtr_template(rocblas_handle handle,
                                               T* trfact,
                                               T** workArr)
 {
+    rocsolver_stage stage(handle, is_complex<T> ? "ungtr" : "orgtr");
+
     // quick return
     if(!n || !batch_count)
         return rocblas_status_success;
@@ -114,12 +112,14 @@ rocblas_status rocsolver_orgtr_ungtr_template(rocblas_handle handle,
         // first superdiagonal and must be shifted left
 
         // copy
-        hipLaunchKernelGGL(copyshift_left<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS), 0,
-                           stream, true, n - 1, A, shiftA, lda, strideA, work, 0, ldw, strideW);
+        ROCSOLVER_LAUNCH_KERNEL(copyshift_left<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS),
+                                0, stream, true, n - 1, A, shiftA, lda, strideA, work, 0, ldw,
+                                strideW);
 
         // shift
-        hipLaunchKernelGGL(copyshift_left<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS), 0,
-                           stream, false, n - 1, A, shiftA, lda, strideA, work, 0, ldw, strideW);
+        ROCSOLVER_LAUNCH_KERNEL(copyshift_left<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS),
+                                0, stream, false, n - 1, A, shiftA, lda, strideA, work, 0, ldw,
+                                strideW);
 
         // result
         rocsolver_orgql_ungql_template<BATCHED, STRIDED, T>(
@@ -133,12 +133,14 @@ rocblas_status rocsolver_orgtr_ungtr_template(rocblas_handle handle,
         // first subdiagonal and must be shifted right
 
         // copy
-        hipLaunchKernelGGL(copyshift_right<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS), 0,
-                           stream, true, n - 1, A, shiftA, lda, strideA, work, 0, ldw, strideW);
+        ROCSOLVER_LAUNCH_KERNEL(copyshift_right<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS),
+                                0, stream, true, n - 1, A, shiftA, lda, strideA, work, 0, ldw,
+                                strideW);
 
         // shift
-        hipLaunchKernelGGL(copyshift_right<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS), 0,
-                           stream, false, n - 1, A, shiftA, lda, strideA, work, 0, ldw, strideW);
+        ROCSOLVER_LAUNCH_KERNEL(copyshift_right<T>, dim3(blocks, blocks, batch_count), dim3(BS, BS),
+                                0, stream, false, n - 1, A, shiftA, lda, strideA, work, 0, ldw,
+                                strideW);
 
         // result
         rocsolver_orgqr_ungqr_template<BATCHED, STRIDED, T>(
@@ -21,7 +21,6 @@ void rocsolver_orm2l_unm2l_getMemorySize(const rocblas_side side,
                                          const rocblas_int n,
                                          const rocblas_int k,
                                          const rocblas_int batch_count,
-                                         size_t* size_scalars,
                                          size_t* size_Abyx,
                                          size_t* size_diag,
                                          size_t* size_workArr)
@@ -29,7 +28,6 @@ void rocsolver_orm2l_unm2l_getMemorySize(const rocblas_side side,
     // if quick return no workspace needed
     if(m == 0 || n == 0 || k == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_Abyx = 0;
         *size_diag = 0;
         *size_workArr = 0;
@@ -40,8 +38,7 @@ void rocsolver_orm2l_unm2l_getMemorySize(const rocblas_side side,
     *size_diag = sizeof(T) * batch_count;
 
     // memory requirements to call larf
-    rocsolver_larf_getMemorySize<T, BATCHED>(side, m, n, batch_count, size_scalars, size_Abyx,
-                                             size_workArr);
+    rocsolver_larf_getMemorySize<T, BATCHED>(side, m, n, batch_count, size_Abyx, size_workArr);
 }
 
 template <bool COMPLEX, typename T, typename U>
@@ -107,6 +104,8 @@ rocblas_status rocsolver_orm2l_unm2l_template(rocblas_handle handle,
                                               T* diag,
                                               T** workArr)
 {
+    rocsolver_stage stage(handle, is_complex<T> ? "unm2l" : "orm2l");
+
     // quick return
     if(!n || !m || !k || !batch_count)
         return rocblas_status_success;
@@ -168,8 +167,9 @@ rocblas_status rocsolver_orm2l_unm2l_template(rocblas_handle handle,
 
         // insert one in A(nq-k+i,i), i.e. the i-th element of the (nq-k)-th
         // subdiagonal, to build/apply the householder matrix
-        hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, diag, 0,
-                           1, A, shiftA + idx2D(nq - k + i, i, lda), lda, strideA, 1, true);
+        ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(nq - k + i, i, lda), lda, strideA, 1,
+                                true);
 
         // Apply current Householder reflector
         rocsolver_larf_template(handle, side, nrow, ncol, A, shiftA + idx2D(0, i, lda), 1, strideA,
@@ -177,8 +177,8 @@ rocblas_status rocsolver_orm2l_unm2l_template(rocblas_handle handle,
                                 Abyx, workArr);
 
         // restore original value of A(nq-k+i,i)
-        hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, diag,
-                           0, 1, A, shiftA + idx2D(nq - k + i, i, lda), lda, strideA, 1);
+        ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(nq - k + i, i, lda), lda, strideA, 1);
     }
 
     // restore tau
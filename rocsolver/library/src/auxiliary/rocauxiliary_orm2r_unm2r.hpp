@@ -21,7 +21,6 @@ void rocsolver_orm2r_unm2r_getMemorySize(const rocblas_side side,
                                          const rocblas_int n,
                                          const rocblas_int k,
                                          const rocblas_int batch_count,
-                                         size_t* size_scalars,
                                          size_t* size_Abyx,
                                          size_t* size_diag,
                                          size_t* size_workArr)
@@ -29,7 +28,6 @@ void rocsolver_orm2r_unm2r_getMemorySize(const rocblas_side side,
     // if quick return no workspace needed
     if(m == 0 || n == 0 || k == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_Abyx = 0;
         *size_diag = 0;
         *size_workArr = 0;
@@ -40,8 +38,7 @@ void rocsolver_orm2r_unm2r_getMemorySize(const rocblas_side side,
     *size_diag = sizeof(T) * batch_count;
 
     // extra memory requirements for calling LARF
-    rocsolver_larf_getMemorySize<T, BATCHED>(side, m, n, batch_count, size_scalars, size_Abyx,
-                                             size_workArr);
+    rocsolver_larf_getMemorySize<T, BATCHED>(side, m, n, batch_count, size_Abyx, size_workArr);
 }
 
 template <bool COMPLEX, typename T, typename U>
@@ -107,6 +104,8 @@ rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle,
                                               T* diag,
                                               T** workArr)
 {
+    rocsolver_stage stage(handle, is_complex<T> ? "unm2r" : "orm2r");
+
     // quick return
     if(!n || !m || !k || !batch_count)
         return rocblas_status_success;
@@ -170,8 +169,8 @@ rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle,
 
         // insert one in A(i,i), i.e. the i-th element along the main diagonal,
         // to build/apply the householder matrix
-        hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, diag, 0,
-                           1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1, true);
+        ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1, true);
 
         // Apply current Householder reflector
         rocsolver_larf_template(handle, side, nrow, ncol, A, shiftA + idx2D(i, i, lda), 1, strideA,
@@ -179,8 +178,8 @@ rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle,
                                 batch_count, scalars, Abyx, workArr);
 
         // restore original value of A(i,i)
-        hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, diag,
-                           0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1);
+        ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1);
     }
 
     // restore tau
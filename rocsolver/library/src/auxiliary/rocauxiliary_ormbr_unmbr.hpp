@@ -22,7 +22,6 @@ void rocsolver_ormbr_unmbr_getMemorySize(const rocblas_storev storev,
                                          const rocblas_int n,
                                          const rocblas_int k,
                                          const rocblas_int batch_count,
-                                         size_t* size_scalars,
                                          size_t* size_AbyxORwork,
                                          size_t* size_diagORtmptr,
                                          size_t* size_trfact,
@@ -31,7 +30,6 @@ void rocsolver_ormbr_unmbr_getMemorySize(const rocblas_storev storev,
     // if quick return no workspace needed
     if(m == 0 || n == 0 || k == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_AbyxORwork = 0;
         *size_diagORtmptr = 0;
         *size_trfact = 0;
@@ -44,13 +42,13 @@ void rocsolver_ormbr_unmbr_getMemorySize(const rocblas_storev storev,
     // requirements for calling ORMQR/UNMQR or ORMLQ/UNMLQ
     if(storev == rocblas_column_wise)
         rocsolver_ormqr_unmqr_getMemorySize<T, BATCHED>(side, m, n, min(nq, k), batch_count,
-                                                        size_scalars, size_AbyxORwork,
-                                                        size_diagORtmptr, size_trfact, size_workArr);
+                                                        size_AbyxORwork, size_diagORtmptr,
+                                                        size_trfact, size_workArr);
 
     else
         rocsolver_ormlq_unmlq_getMemorySize<T, BATCHED>(side, m, n, min(nq, k), batch_count,
-                                                        size_scalars, size_AbyxORwork,
-                                                        size_diagORtmptr, size_trfact, size_workArr);
+                                                        size_AbyxORwork, size_diagORtmptr,
+                                                        size_trfact, size_workArr);
 }
 
 template <bool COMPLEX, typename T, typename U>
@@ -123,6 +121,8 @@ rocblas_status rocsolver_ormbr_unmbr_template(rocblas_handle handle,
                                               T* trfact,
                                               T** workArr)
 {
+    rocsolver_stage stage(handle, is_complex<T> ? "unmbr" : "ormbr");
+
     // quick return
     if(!n || !m || !k || !batch_count)
         return rocblas_status_success;
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_orml2_unml2.hpp"
+#include "logging.hpp"
 
 template <typename T, bool COMPLEX = is_complex<T>>
 rocblas_status rocsolver_orml2_unml2_impl(rocblas_handle handle,
@@ -20,7 +21,9 @@ rocblas_status rocsolver_orml2_unml2_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, is_complex<T> ? "unml2" : "orml2", "--side", side,
+                     "--transposeA", trans, "-m", m, "-n", n, "-k", k, "A", A, "--lda", lda,
+                     "ipiv", ipiv, "C", C, "--ldc", ldc);
 
     // argument checking
     rocblas_status st
@@ -39,38 +42,36 @@ rocblas_status rocsolver_orml2_unml2_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // extra requirements for calling LARF
     size_t size_Abyx;
     // size of temporary array for diagonal elements
     size_t size_diag;
     // size of arrays of pointers (for batched cases)
     size_t size_workArr;
-    rocsolver_orml2_unml2_getMemorySize<T, false>(side, m, n, k, batch_count, &size_scalars,
-                                                  &size_Abyx, &size_diag, &size_workArr);
+    rocsolver_orml2_unml2_getMemorySize<T, false>(side, m, n, k, batch_count, &size_Abyx,
+                                                  &size_diag, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_Abyx, size_diag,
-                                                      size_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_Abyx, size_diag, size_workArr);
 
     // memory workspace allocation
-    void *scalars, *Abyx, *diag, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_Abyx, size_diag, size_workArr);
+    void *Abyx, *diag, *workArr;
+    rocblas_device_malloc mem(handle, size_Abyx, size_diag, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    Abyx = mem[1];
-    diag = mem[2];
-    workArr = mem[3];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    Abyx = mem[0];
+    diag = mem[1];
+    workArr = mem[2];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_orml2_unml2_template<T>(handle, side, trans, m, n, k, A, shiftA, lda, strideA,
                                              ipiv, strideP, C, shiftC, ldc, strideC, batch_count,
-                                             (T*)scalars, (T*)Abyx, (T*)diag, (T**)workArr);
+                                             scalars, (T*)Abyx, (T*)diag, (T**)workArr);
 }
 
 /*
@@ -21,7 +21,6 @@ void rocsolver_orml2_unml2_getMemorySize(const rocblas_side side,
                                          const rocblas_int n,
                                          const rocblas_int k,
                                          const rocblas_int batch_count,
-                                         size_t* size_scalars,
                                          size_t* size_Abyx,
                                          size_t* size_diag,
                                          size_t* size_workArr)
@@ -29,7 +28,6 @@ void rocsolver_orml2_unml2_getMemorySize(const rocblas_side side,
     // if quick return no workspace needed
     if(m == 0 || n == 0 || k == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_Abyx = 0;
         *size_diag = 0;
         *size_workArr = 0;
@@ -40,8 +38,7 @@ void rocsolver_orml2_unml2_getMemorySize(const rocblas_side side,
     *size_diag = sizeof(T) * batch_count;
 
     // memory requirements to call larf
-    rocsolver_larf_getMemorySize<T, BATCHED>(side, m, n, batch_count, size_scalars, size_Abyx,
-                                             size_workArr);
+    rocsolver_larf_getMemorySize<T, BATCHED>(side, m, n, batch_count, size_Abyx, size_workArr);
 }
 
 template <bool COMPLEX, typename T, typename U>
@@ -107,6 +104,8 @@ rocblas_status rocsolver_orml2_unml2_template(rocblas_handle handle,
                                               T* diag,
                                               T** workArr)
 {
+    rocsolver_stage stage(handle, is_complex<T> ? "unml2" : "orml2");
+
     // quick return
     if(!n || !m || !k || !batch_count)
         return rocblas_status_success;
@@ -176,8 +175,8 @@ rocblas_status rocsolver_orml2_unml2_template(rocblas_handle handle,
 
         // insert one in A(i,i), i.e. the i-th element along the main diagonal,
         // to build/apply the householder matrix
-        hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, diag, 0,
-                           1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1, true);
+        ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1, true);
 
         // Apply current Householder reflector
         rocsolver_larf_template(handle, side, nrow, ncol, A, shiftA + idx2D(i, i, lda), lda,
@@ -185,8 +184,8 @@ rocblas_status rocsolver_orml2_unml2_template(rocblas_handle handle,
                                 strideC, batch_count, scalars, Abyx, workArr);
 
         // restore original value of A(i,i)
-        hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, diag,
-                           0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1);
+        ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1);
 
         if(COMPLEX && i < nq - 1)
             rocsolver_lacgv_template<T>(handle, nq - i - 1, A, shiftA + idx2D(i, i + 1, lda), lda,
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "rocauxiliary_ormlq_unmlq.hpp"
+#include "logging.hpp"
 
 template <typename T, bool COMPLEX = is_complex<T>>
 rocblas_status rocsolver_ormlq_unmlq_impl(rocblas_handle handle,
@@ -20,7 +21,9 @@ rocblas_status rocsolver_ormlq_unmlq_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, is_complex<T> ? "unmlq" : "ormlq", "--side", side,
+                     "--transposeA", trans, "-m", m, "-n", n, "-k", k, "A", A, "--lda", lda,
+                     "ipiv", ipiv, "C", C, "--ldc", ldc);
 
     // argument checking
     rocblas_status st
@@ -39,41 +42,38 @@ rocblas_status rocsolver_ormlq_unmlq_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // extra requirements for calling ORM2R/UNM2R or LARFT + LARFB
     size_t size_AbyxORwork, size_diagORtmptr;
     // size of temporary array for triangular factor
     size_t size_trfact;
     // size of arrays of pointers (for batched cases)
     size_t size_workArr;
-    rocsolver_ormlq_unmlq_getMemorySize<T, false>(side, m, n, k, batch_count, &size_scalars,
-                                                  &size_AbyxORwork, &size_diagORtmptr, &size_trfact,
-                                                  &size_workArr);
+    rocsolver_ormlq_unmlq_getMemorySize<T, false>(side, m, n, k, batch_count, &size_AbyxORwork,
+                                                  &size_diagORtmptr, &size_trfact, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_AbyxORwork,
-                                                      size_diagORtmptr, size_trfact, size_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_AbyxORwork, size_diagORtmptr,
+                                                      size_trfact, size_workArr);
 
     // memory workspace allocation
-    void *scalars, *AbyxORwork, *diagORtmptr, *trfact, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_AbyxORwork, size_diagORtmptr, size_trfact,
-                              size_workArr);
+    void *AbyxORwork, *diagORtmptr, *trfact, *workArr;
+    rocblas_device_malloc mem(handle, size_AbyxORwork, size_diagORtmptr, size_trfact, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    AbyxORwork = mem[1];
-    diagORtmptr = mem[2];
-    trfact = mem[3];
-    workArr = mem[4];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    AbyxORwork = mem[0];
+    diagORtmptr = mem[1];
+    trfact = mem[2];
+    workArr = mem[3];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_ormlq_unmlq_template<false, false, T>(
         handle, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc,
-        strideC, batch_count, (T*)scalars, (T*)AbyxORwork, (T*)diagORtmptr, (T*)trfact, (T**)workArr);
+        strideC, batch_count, scalars, (T*)AbyxORwork, (T*)diagORtmptr, (T*)trfact, (T**)workArr);
 }
 
 /*
@@ -22,7 +22,6 @@ void rocsolver_ormqr_unmqr_getMemorySize(const rocblas_side side,
                                          const rocblas_int n,
                                          const rocblas_int k,
                                          const rocblas_int batch_count,
-                                         size_t* size_scalars,
                                          size_t* size_AbyxORwork,
                                          size_t* size_diagORtmptr,
                                          size_t* size_trfact,
@@ -31,7 +30,6 @@ void rocsolver_ormqr_unmqr_getMemorySize(const rocblas_side side,
     // if quick return no workspace needed
     if(m == 0 || n == 0 || k == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_AbyxORwork = 0;
         *size_diagORtmptr = 0;
         *size_trfact = 0;
@@ -39,25 +37,28 @@ void rocsolver_ormqr_unmqr_getMemorySize(const rocblas_side side,
         return;
     }
 
-    size_t s1, s2, unused;
-    rocsolver_orm2r_unm2r_getMemorySize<T, BATCHED>(side, m, n, k, batch_count, size_scalars,
-                                                    size_AbyxORwork, size_diagORtmptr, size_workArr);
+    size_t s1, s2, a1, unused;
+    rocsolver_orm2r_unm2r_getMemorySize<T, BATCHED>(side, m, n, k, batch_count, size_AbyxORwork,
+                                                    size_diagORtmptr, size_workArr);
 
-    if(k > ORMxx_ORMxx_BLOCKSIZE)
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_ormxx_blocksize, k);
+    if(k > nb)
     {
-        rocblas_int jb = ORMxx_ORMxx_BLOCKSIZE;
+        rocblas_int jb = nb;
 
         // requirements for calling larft
-        rocsolver_larft_getMemorySize<T, BATCHED>(max(m, n), min(jb, k), batch_count, &unused, &s1,
-                                                  &unused);
+        rocsolver_larft_getMemorySize<T, BATCHED>(max(m, n), min(jb, k), batch_count, &s1, &unused);
 
         // requirements for calling larfb
         rocsolver_larfb_getMemorySize<T, BATCHED>(side, m, n, min(jb, k), batch_count, &s2,
-                                                  size_diagORtmptr, &unused);
+                                                  size_diagORtmptr, &a1);
 
         // size of workspace is maximum of what is needed by larft and larfb
         *size_AbyxORwork = max(s1, s2);
 
+        // size of workArr is the maximum of what is needed by orm2r/unm2r and larfb
+        *size_workArr = max(*size_workArr, a1);
+
         // size of temporary array for triangular factor
         *size_trfact = sizeof(T) * jb * jb * batch_count;
     }
@@ -89,6 +90,8 @@ rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle,
                                               T* trfact,
                                               T** workArr)
 {
+    rocsolver_stage stage(handle, is_complex<T> ? "unmqr" : "ormqr");
+
     // quick return
     if(!n || !m || !k || !batch_count)
         return rocblas_status_success;
@@ -97,12 +100,13 @@ rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // if the matrix is small, use the unblocked variant of the algorithm
-    if(k <= ORMxx_ORMxx_BLOCKSIZE)
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_ormxx_blocksize, k);
+    if(k <= nb)
         return rocsolver_orm2r_unm2r_template<T>(
             handle, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc,
             strideC, batch_count, scalars, AbyxORwork, diagORtmptr, workArr);
 
-    rocblas_int ldw = ORMxx_ORMxx_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
     // determine limits and indices
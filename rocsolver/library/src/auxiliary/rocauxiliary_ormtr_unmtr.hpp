@@ -21,7 +21,6 @@ void rocsolver_ormtr_unmtr_getMemorySize(const rocblas_side side,
                                          const rocblas_int m,
                                          const rocblas_int n,
                                          const rocblas_int batch_count,
-                                         size_t* size_scalars,
                                          size_t* size_AbyxORwork,
                                          size_t* size_diagORtmptr,
                                          size_t* size_trfact,
@@ -30,7 +29,6 @@ void rocsolver_ormtr_unmtr_getMemorySize(const rocblas_side side,
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_AbyxORwork = 0;
         *size_diagORtmptr = 0;
         *size_trfact = 0;
@@ -42,12 +40,12 @@ void rocsolver_ormtr_unmtr_getMemorySize(const rocblas_side side,
 
     // requirements for calling ORMQL/UNMQL or ORMQR/UNMQR
     if(uplo == rocblas_fill_upper)
-        rocsolver_ormql_unmql_getMemorySize<T, BATCHED>(side, m, n, nq, batch_count, size_scalars,
+        rocsolver_ormql_unmql_getMemorySize<T, BATCHED>(side, m, n, nq, batch_count,
                                                         size_AbyxORwork, size_diagORtmptr,
                                                         size_trfact, size_workArr);
 
     else
-        rocsolver_ormqr_unmqr_getMemorySize<T, BATCHED>(side, m, n, nq, batch_count, size_scalars,
+        rocsolver_ormqr_unmqr_getMemorySize<T, BATCHED>(side, m, n, nq, batch_count,
                                                         size_AbyxORwork, size_diagORtmptr,
                                                         size_trfact, size_workArr);
 }
@@ -115,6 +113,8 @@ rocblas_status rocsolver_ormtr_unmtr_template(rocblas_handle handle,
                                               T* trfact,
                                               T** workArr)
 {
+    rocsolver_stage stage(handle, is_complex<T> ? "unmtr" : "ormtr");
+
     // quick return
     if(!n || !m || !batch_count)
         return rocblas_status_success;
@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "device_constants.hpp"
+#include <hip/hip_runtime.h>
+#include <mutex>
+#include <unordered_map>
+
+// constants {-1, 0, 1} for every precision; they are set at load time,
+// so no copy is needed before using them
+__device__ float constants_s[3] = {-1.0f, 0.0f, 1.0f};
+__device__ double constants_d[3] = {-1.0, 0.0, 1.0};
+__device__ rocblas_float_complex constants_c[3] = {{-1.0f, 0.0f}, {0.0f, 0.0f}, {1.0f, 0.0f}};
+__device__ rocblas_double_complex constants_z[3] = {{-1.0, 0.0}, {0.0, 0.0}, {1.0, 0.0}};
+
+static hipError_t get_symbol(void** ptr, float*)
+{
+    return hipGetSymbolAddress(ptr, HIP_SYMBOL(constants_s));
+}
+static hipError_t get_symbol(void** ptr, double*)
+{
+    return hipGetSymbolAddress(ptr, HIP_SYMBOL(constants_d));
+}
+static hipError_t get_symbol(void** ptr, rocblas_float_complex*)
+{
+    return hipGetSymbolAddress(ptr, HIP_SYMBOL(constants_c));
+}
+static hipError_t get_symbol(void** ptr, rocblas_double_complex*)
+{
+    return hipGetSymbolAddress(ptr, HIP_SYMBOL(constants_z));
+}
+
+template <typename T>
+T* rocsolver_get_constants()
+{
+    // address of the table on each device, resolved on first use
+    static std::mutex mtx;
+    static std::unordered_map<int, T*> table;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = table.find(device);
+    if(it != table.end())
+        return it->second;
+
+    void* ptr;
+    if(get_symbol(&ptr, (T*)nullptr) != hipSuccess)
+        return nullptr;
+
+    table[device] = (T*)ptr;
+    return (T*)ptr;
+}
+
+template float* rocsolver_get_constants<float>();
+template double* rocsolver_get_constants<double>();
+template rocblas_float_complex* rocsolver_get_constants<rocblas_float_complex>();
+template rocblas_double_complex* rocsolver_get_constants<rocblas_double_complex>();
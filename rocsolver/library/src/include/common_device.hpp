@@ -203,6 +203,56 @@ __global__ void set_zero(const rocblas_int m,
     }
 }
 
+/** COPY_ARRAY copies the m-by-n array A into B **/
+template <typename T, typename U1, typename U2>
+__global__ void copy_array(const rocblas_int m,
+                           const rocblas_int n,
+                           U1 A,
+                           const rocblas_int shiftA,
+                           const rocblas_int lda,
+                           const rocblas_stride strideA,
+                           U2 B,
+                           const rocblas_int shiftB,
+                           const rocblas_int ldb,
+                           const rocblas_stride strideB)
+{
+    const auto blocksizex = hipBlockDim_x;
+    const auto blocksizey = hipBlockDim_y;
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * blocksizex + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * blocksizey + hipThreadIdx_y;
+
+    if(i < m && j < n)
+    {
+        T *Ap, *Bp;
+        Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
+
+        Bp[i + j * ldb] = Ap[i + j * lda];
+    }
+}
+
+/** INIT_IDENT sets the m-by-n array A to the identity **/
+template <typename T, typename U>
+__global__ void init_ident(const rocblas_int m,
+                           const rocblas_int n,
+                           U A,
+                           const rocblas_int shiftA,
+                           const rocblas_int lda,
+                           const rocblas_stride strideA)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < m && j < n)
+    {
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+
+        Ap[i + j * lda] = (i == j) ? 1.0 : 0.0;
+    }
+}
+
 template <typename T, typename U>
 __global__ void copyshift_right(const bool copy,
                                 const rocblas_int dim,
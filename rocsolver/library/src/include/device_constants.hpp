@@ -0,0 +1,19 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef DEVICE_CONSTANTS_HPP
+#define DEVICE_CONSTANTS_HPP
+
+#include <rocblas.h>
+
+/** ROCSOLVER_GET_CONSTANTS returns a device pointer to the constants {-1, 0, 1}
+    of type T, to be used as alpha/beta in rocBLAS calls with
+    rocblas_pointer_mode_device. The table lives in global memory of the
+    current device and its address is looked up only once per device,
+    so no host-to-device copy is issued when calling a rocSOLVER function.
+    Returns nullptr if the table cannot be located. **/
+template <typename T>
+T* rocsolver_get_constants();
+
+#endif
@@ -5,6 +5,7 @@
 #ifndef HELPERS_H
 #define HELPERS_H
 
+#include "logging.hpp"
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
@@ -95,6 +96,7 @@ void print_device_matrix(const std::string name,
                          const rocblas_int lda)
 {
     T hA[lda * n];
+    rocsolver_count_memcpy();
     hipMemcpy(hA, A, sizeof(T) * lda * n, hipMemcpyDeviceToHost);
 
     std::cerr << m << "-by-" << n << " matrix: " << name << '\n';
@@ -119,6 +121,7 @@ void print_device_matrix(const std::string name,
                          const rocblas_int lda)
 {
     T hA[lda * n];
+    rocsolver_count_memcpy();
     hipMemcpy(hA, A, sizeof(T) * lda * n, hipMemcpyDeviceToHost);
 
     std::cerr << m << "-by-" << n << " matrix: " << name << '\n';
@@ -5,6 +5,10 @@
 #ifndef IDEAL_SIZES_HPP
 #define IDEAL_SIZES_HPP
 
+// The crossover points and block sizes listed in rocsolver_tuning_param are the
+// compiled defaults of tuning parameters that can be changed at run time
+// (see tuning.cpp); use rocsolver_get_tuning to read them
+
 // general
 #define WAVESIZE 64 // size of wavefront
 
@@ -27,10 +31,20 @@
 #define GETRF_GETF2_SWITCHSIZE 64
 #define GETF2_MAX_THDS 256
 #define GETRF_GETF2_BLOCKSIZE 64
+#define GETRF_LOOKAHEAD_SWITCHSIZE 512
+#define GETRF_TSLU_SWITCHSIZE 0 // (disabled)
 #define GETF2_OPTIM_NGRP \
     16, 15, 8, 8, 8, 8, 8, 8, 6, 6, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
 #define GETF2_BATCH_OPTIM_MAX_SIZE 2048
 #define GETF2_OPTIM_MAX_SIZE 1024
+#define GETF2_RECURSIVE_SWITCHSIZE 16
+
+// getrs/gesv
+#define GETRS_NRHS_BLOCKSIZE 8
+// maximum number of workgroups among which the blocks of right-hand sides are
+// spread by the small-size kernel (each one solves every GETRS_NRHS_MAX_BLOCKS-th
+// block when there are more)
+#define GETRS_NRHS_MAX_BLOCKS 4096
 
 // getri
 #define GETRI_SWITCHSIZE_MID 64
@@ -39,6 +53,13 @@
 
 // potf2/potrf
 #define POTRF_POTF2_SWITCHSIZE 64
+// Matrices with n <= POTF2_OPTIM_MAX_SIZE are factorized by a single kernel that
+// keeps the instance in registers (only when built with OPTIMAL)
+#define POTF2_OPTIM_MAX_SIZE 64
+// Number of instances of the batch processed by each workgroup of the small-size
+// kernel when n <= 32 (so that n * ngrp <= WAVESIZE)
+#define POTF2_OPTIM_NGRP \
+    16, 15, 8, 8, 8, 8, 8, 8, 6, 6, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
 
 // geqx2/geqxf
 #define GEQxF_GEQx2_SWITCHSIZE 128
@@ -51,11 +72,24 @@
 // gebd2/gebrd
 #define GEBRD_GEBD2_SWITCHSIZE 32
 
+// bdsqr
+// Maximum number of threads of the workgroup that updates the singular vectors
+// of each instance of the batch
+#define BDSQR_MAX_THDS 256
+
+// bdsdc
+// Maximum number of threads of the workgroups that prepare the merges and
+// solve the secular equations of the divide and conquer algorithm
+#define BDSDC_MAX_THDS 256
+
 // gesvd
-// This value should be ~1.6 (to be tuned).
-// For now, it is set to a very high value until the thin-SVD algorithm is
-// implemented
-#define THIN_SVD_SWITCH 16000
+// The thin-SVD algorithm (QR or LQ factorization first) is used when
+// m >= THIN_SVD_SWITCH * n (or n >= THIN_SVD_SWITCH * m)
+#define THIN_SVD_SWITCH 1.6
+// When GESVD_BDSDC_SWITCHSIZE > 0, the singular vectors of the bidiagonal form are
+// computed with divide and conquer (bdsdc) instead of QR iterations (bdsqr) when
+// min(m,n) >= GESVD_BDSDC_SWITCHSIZE. (0 disables it: bdsqr is always used)
+#define GESVD_BDSDC_SWITCHSIZE 0
 
 // THESE FOLLOWING VALUES ARE TO MATCH ROCBLAS C++ INTERFACE
 // THEY ARE DEFINED/TUNNED IN ROCBLAS
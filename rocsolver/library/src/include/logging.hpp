@@ -0,0 +1,218 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef LOGGING_HPP
+#define LOGGING_HPP
+
+#include "../../../../rocblascommon/library/src/include/rocblas_ostream.hpp"
+#include "internal/rocblas_device_malloc.hpp"
+#include "libcommon.hpp"
+#include "rocsolver-extra-types.h"
+#include <rocblas.h>
+#include <string>
+
+/*******************************************************************************
+ * Logging layer
+ *
+ * The environment variable ROCSOLVER_LAYER is a bit mask of the logging modes:
+ *
+ *     1 (trace):   every call is logged with the values of its arguments
+ *     2 (bench):   every call is logged as the equivalent rocsolver-bench command
+ *     4 (profile): the calls of all the handles are counted per function and size
+ *                  arguments, and the counts are logged (and reset) when a handle
+ *                  is destroyed with rocsolver_destroy_handle, or at exit
+ *     8 (stages):  the stages of every call (see rocsolver_stage) are timed with
+ *                  hipEvents, and the call is logged as a tree of stages with
+ *                  their durations and number of launches (in JSON), or as the
+ *                  events of a Chrome trace if ROCSOLVER_LOG_STAGES_FORMAT=chrome.
+ *                  The host waits for the end of each call in this mode.
+ *
+ * The output of each mode goes to the file named by ROCSOLVER_LOG_TRACE_PATH,
+ * ROCSOLVER_LOG_BENCH_PATH, ROCSOLVER_LOG_PROFILE_PATH or ROCSOLVER_LOG_STAGES_PATH,
+ * or to stderr if the variable is not set. Workspace size queries are not logged.
+ ******************************************************************************/
+
+// logging mode of the stage timings (the others are the rocblas_layer_mode values)
+constexpr int rocsolver_layer_mode_log_stages = 8;
+
+/** ROCSOLVER_LOG_MODE returns the logging modes (a combination of
+    rocblas_layer_mode values) set in ROCSOLVER_LAYER; the environment is read
+    only once. **/
+int rocsolver_log_mode();
+
+/** ROCSOLVER_LOG_WRITE writes a line to the log of the given mode. **/
+void rocsolver_log_write(const int mode, const std::string& line);
+
+/** ROCSOLVER_LOG_PROFILE counts a call with the given description in the
+    profile. **/
+void rocsolver_log_profile(const std::string& call);
+
+/** ROCSOLVER_LOG_RELEASE writes and clears the profile, and
+    forgets the counters of the calling thread if its last call was made with
+    the handle (when the handle is destroyed). **/
+void rocsolver_log_release(const rocblas_handle handle);
+
+/** ROCSOLVER_LOG_STAGES_CALL sets the description of the call whose stages
+    are timed next by the calling thread. **/
+void rocsolver_log_stages_call(const std::string& func, const std::string& args);
+
+/** ROCSOLVER_CALL_BEGIN resets the counters of the calling thread for a new
+    call made with the handle (see rocsolver_get_call_counters). **/
+void rocsolver_call_begin(const rocblas_handle handle);
+
+/** ROCSOLVER_COUNT_KERNEL_LAUNCH and ROCSOLVER_COUNT_MEMCPY count a kernel
+    launch and a synchronous memory copy in the counters of the current call. **/
+void rocsolver_count_kernel_launch();
+void rocsolver_count_memcpy();
+
+// the kernels of rocSOLVER are launched with ROCSOLVER_LAUNCH_KERNEL so that
+// they are counted
+#define ROCSOLVER_LAUNCH_KERNEL(...)     \
+    do                                   \
+    {                                    \
+        rocsolver_count_kernel_launch(); \
+        hipLaunchKernelGGL(__VA_ARGS__); \
+    } while(0)
+
+void rocsolver_stage_begin(const rocblas_handle handle, const char* name);
+void rocsolver_stage_end();
+
+/** ROCSOLVER_STAGE marks the scope where it is declared as a stage of the
+    current call. The stages are the templates of the rocSOLVER routines and the
+    calls to rocBLAS (named rocblas_<function>, which are counted); the outermost
+    stage of a call is the template called by the API function, and when it ends
+    the counters of the call are kept by the calling thread. In stages mode, the
+    stages are also timed with hipEvents recorded in the stream of the handle. **/
+class rocsolver_stage
+{
+public:
+    rocsolver_stage(const rocblas_handle handle, const char* name)
+    {
+        rocsolver_stage_begin(handle, name);
+    }
+
+    ~rocsolver_stage()
+    {
+        rocsolver_stage_end();
+    }
+
+    rocsolver_stage(const rocsolver_stage&) = delete;
+    rocsolver_stage& operator=(const rocsolver_stage&) = delete;
+};
+
+// letter used by the function names and by rocsolver-bench for each precision
+template <typename T>
+constexpr char rocsolver_precision_letter = 's';
+template <>
+constexpr char rocsolver_precision_letter<double> = 'd';
+template <>
+constexpr char rocsolver_precision_letter<rocblas_float_complex> = 'c';
+template <>
+constexpr char rocsolver_precision_letter<rocblas_double_complex> = 'z';
+
+// the enums that rocsolver_ostream does not know are logged with the letters
+// used by rocsolver-bench
+template <typename V>
+inline V rocsolver_log_value(const V value)
+{
+    return value;
+}
+
+inline char rocsolver_log_value(const rocblas_direct direct)
+{
+    return direct == rocblas_forward_direction ? 'F' : 'B';
+}
+
+inline char rocsolver_log_value(const rocblas_storev storev)
+{
+    return storev == rocblas_column_wise ? 'C' : 'R';
+}
+
+inline char rocsolver_log_value(const rocblas_svect svect)
+{
+    switch(svect)
+    {
+    case rocblas_svect_all: return 'A';
+    case rocblas_svect_singular: return 'S';
+    case rocblas_svect_overwrite: return 'O';
+    default: return 'N';
+    }
+}
+
+inline char rocsolver_log_value(const rocblas_workmode workmode)
+{
+    return workmode == rocblas_outofplace ? 'O' : 'I';
+}
+
+inline void rocsolver_log_arguments(rocsolver_ostream& trace,
+                                    rocsolver_ostream& bench,
+                                    rocsolver_ostream& profile)
+{
+}
+
+template <typename V, typename... Ts>
+void rocsolver_log_arguments(rocsolver_ostream& trace,
+                             rocsolver_ostream& bench,
+                             rocsolver_ostream& profile,
+                             const char* name,
+                             const V value,
+                             const Ts... args)
+{
+    const char* arg = name;
+    while(*arg == '-')
+        ++arg;
+
+    trace << ", " << arg << "=" << rocsolver_log_value(value);
+    if(name[0] == '-')
+    {
+        bench << " " << name << " " << rocsolver_log_value(value);
+        profile << ", " << arg << ": " << rocsolver_log_value(value);
+    }
+
+    rocsolver_log_arguments(trace, bench, profile, args...);
+}
+
+/** ROCSOLVER_LOG logs a call to the function named rocsolver_<precision><name>
+    in the enabled logging modes, and starts the counters of the call.
+    The remaining arguments are pairs of argument names and values. The names
+    starting with '-' are the options of rocsolver-bench that take those values,
+    and the arguments are also used to group the calls in profile mode; the
+    other arguments (e.g. pointers) are only traced. **/
+template <typename T, typename... Ts>
+void rocsolver_log(const rocblas_handle handle, const char* name, const Ts... args)
+{
+    rocsolver_call_begin(handle);
+
+    int mode = rocsolver_log_mode();
+    if(!mode || rocblas_is_device_memory_size_query(handle))
+        return;
+
+    std::string func = std::string("rocsolver_") + rocsolver_precision_letter<T> + name;
+    rocsolver_ostream trace, bench, profile;
+    rocsolver_log_arguments(trace, bench, profile, args...);
+
+    if(mode & rocblas_layer_mode_log_trace)
+    {
+        // (skip the separator before the first argument)
+        std::string targs = trace.str();
+        rocsolver_log_write(rocblas_layer_mode_log_trace,
+                            func + "(" + targs.substr(std::min<size_t>(2, targs.size())) + ")");
+    }
+
+    if(mode & rocblas_layer_mode_log_bench)
+        rocsolver_log_write(rocblas_layer_mode_log_bench,
+                            std::string("./rocsolver-bench -f ") + name + " -r "
+                                + rocsolver_precision_letter<T> + bench.str());
+
+    if(mode & rocblas_layer_mode_log_profile)
+        rocsolver_log_profile("function: " + func + profile.str());
+
+    if(mode & rocsolver_layer_mode_log_stages)
+    {
+        std::string pargs = profile.str();
+        rocsolver_log_stages_call(func, pargs.substr(std::min<size_t>(2, pargs.size())));
+    }
+}
+
+#endif
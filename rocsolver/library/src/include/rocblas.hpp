@@ -9,9 +9,12 @@ template <typename T>
 struct rocblas_index_value_t;
 
 #include "common_device.hpp"
+#include "device_constants.hpp"
 #include "helpers.hpp"
 #include "internal/rocblas-exported-proto.hpp"
 #include "internal/rocblas_device_malloc.hpp"
+#include "logging.hpp"
+#include "tuning.hpp"
 #include <rocblas.h>
 
 // iamax
@@ -26,6 +29,8 @@ rocblas_status rocblasCall_iamax(rocblas_handle handle,
                                  rocblas_int* result,
                                  rocblas_index_value_t<S>* workspace)
 {
+    rocsolver_stage stage(handle, "rocblas_iamax");
+
     return rocblas_iamax_template<ROCBLAS_IAMAX_NB, ISBATCHED>(
         handle, n, cast2constType<T>(x), shiftx, incx, stridex, batch_count, result, workspace);
 }
@@ -42,6 +47,8 @@ rocblas_status rocblasCall_scal(rocblas_handle handle,
                                 rocblas_stride stridex,
                                 rocblas_int batch_count)
 {
+    rocsolver_stage stage(handle, "rocblas_scal");
+
     return rocblas_scal_template<ROCBLAS_SCAL_NB, T>(handle, n, alpha, stridea, x, offsetx, incx,
                                                      stridex, batch_count);
 }
@@ -62,6 +69,8 @@ rocblas_status rocblasCall_dot(rocblas_handle handle,
                                T* results,
                                T* workspace)
 {
+    rocsolver_stage stage(handle, "rocblas_dot");
+
     return rocblas_dot_template<ROCBLAS_DOT_NB, CONJ, T>(
         handle, n, cast2constType<T>(x), offsetx, incx, stridex, cast2constType<T>(y), offsety,
         incy, stridey, batch_count, results, workspace);
@@ -89,6 +98,8 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
                                rocblas_int batch_count,
                                T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_ger");
+
     return rocblas_ger_template<CONJ, T>(handle, m, n, alpha, stridea, cast2constType<T>(x),
                                          offsetx, incx, stridex, cast2constType<T>(y), offsety,
                                          incy, stridey, A, offsetA, lda, strideA, batch_count);
@@ -116,11 +127,14 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
                                rocblas_int batch_count,
                                T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_ger");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, y, stridey, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, y, stridey,
+                            batch_count);
 
     return rocblas_ger_template<CONJ, T>(handle, m, n, alpha, stridea, cast2constType<T>(x),
                                          offsetx, incx, stridex, cast2constType<T>(work), offsety,
@@ -149,11 +163,14 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
                                rocblas_int batch_count,
                                T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_ger");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, x, stridex, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, x, stridex,
+                            batch_count);
 
     return rocblas_ger_template<CONJ, T>(handle, m, n, alpha, stridea, cast2constType<T>(work),
                                          offsetx, incx, stridex, cast2constType<T>(y), offsety,
@@ -185,6 +202,8 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
                                 rocblas_int batch_count,
                                 T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_gemv");
+
     return rocblas_gemv_template<T>(handle, transA, m, n, alpha, stride_alpha, cast2constType<T>(A),
                                     offseta, lda, strideA, cast2constType<T>(x), offsetx, incx,
                                     stridex, beta, stride_beta, y, offsety, incy, stridey,
@@ -216,11 +235,14 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
                                 rocblas_int batch_count,
                                 T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_gemv");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, strideA, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, strideA,
+                            batch_count);
 
     return rocblas_gemv_template<T>(handle, transA, m, n, alpha, stride_alpha,
                                     cast2constType<T>(work), offseta, lda, strideA,
@@ -253,11 +275,14 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
                                 rocblas_int batch_count,
                                 T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_gemv");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, x, stridex, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, x, stridex,
+                            batch_count);
 
     return rocblas_gemv_template<T>(handle, transA, m, n, alpha, stride_alpha, cast2constType<T>(A),
                                     offseta, lda, strideA, cast2constType<T>(work), offsetx, incx,
@@ -290,11 +315,14 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
                                 rocblas_int batch_count,
                                 T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_gemv");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, y, stridey, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, y, stridey,
+                            batch_count);
 
     return rocblas_gemv_template<T>(handle, transA, m, n, alpha, stride_alpha, cast2constType<T>(A),
                                     offseta, lda, strideA, cast2constType<T>(x), offsetx, incx,
@@ -327,13 +355,16 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
                                 rocblas_int batch_count,
                                 T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_gemv");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, x, stridex, batch_count);
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, (work + batch_count), y,
-                       stridey, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, x, stridex,
+                            batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, (work + batch_count), y,
+                            stridey, batch_count);
 
     return rocblas_gemv_template<T>(
         handle, transA, m, n, alpha, stride_alpha, cast2constType<T>(A), offseta, lda, strideA,
@@ -366,13 +397,16 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
                                 rocblas_int batch_count,
                                 T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_gemv");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, strideA, batch_count);
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, (work + batch_count), y,
-                       stridey, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, strideA,
+                            batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, (work + batch_count), y,
+                            stridey, batch_count);
 
     return rocblas_gemv_template<T>(
         handle, transA, m, n, alpha, stride_alpha, cast2constType<T>(work), offseta, lda, strideA,
@@ -399,6 +433,8 @@ rocblas_status rocblasCall_trmv(rocblas_handle handle,
                                 rocblas_stride stridew,
                                 rocblas_int batch_count)
 {
+    rocsolver_stage stage(handle, "rocblas_trmv");
+
     return rocblas_trmv_template<ROCBLAS_TRMV_NB>(handle, uplo, transa, diag, m,
                                                   cast2constType<T>(a), offseta, lda, stridea, x,
                                                   offsetx, incx, stridex, w, stridew, batch_count);
@@ -429,6 +465,8 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
                                 rocblas_int batch_count,
                                 T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_gemm");
+
     return rocblas_gemm_template<BATCHED, T>(handle, trans_a, trans_b, m, n, k, alpha,
                                              cast2constType<T>(A), offset_a, ld_a, stride_a,
                                              cast2constType<T>(B), offset_b, ld_b, stride_b, beta,
@@ -460,11 +498,14 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
                                 rocblas_int batch_count,
                                 T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_gemm");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, stride_a, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, stride_a,
+                            batch_count);
 
     return rocblas_gemm_template<BATCHED, T>(handle, trans_a, trans_b, m, n, k, alpha,
                                              cast2constType<T>(work), offset_a, ld_a, stride_a,
@@ -497,11 +538,14 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
                                 rocblas_int batch_count,
                                 T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_gemm");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, B, stride_b, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, B, stride_b,
+                            batch_count);
 
     return rocblas_gemm_template<BATCHED, T>(handle, trans_a, trans_b, m, n, k, alpha,
                                              cast2constType<T>(A), offset_a, ld_a, stride_a,
@@ -534,11 +578,14 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
                                 rocblas_int batch_count,
                                 T** work)
 {
+    rocsolver_stage stage(handle, "rocblas_gemm");
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, work, C, stride_c, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, C, stride_c,
+                            batch_count);
 
     return rocblas_gemm_template<BATCHED, T>(
         handle, trans_a, trans_b, m, n, k, alpha, cast2constType<T>(A), offset_a, ld_a, stride_a,
@@ -546,6 +593,92 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
         ld_c, stride_c, batch_count);
 }
 
+// gemm overload
+// (work must have space for 2 * batch_count pointers)
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocblasCall_gemm(rocblas_handle handle,
+                                rocblas_operation trans_a,
+                                rocblas_operation trans_b,
+                                rocblas_int m,
+                                rocblas_int n,
+                                rocblas_int k,
+                                U alpha,
+                                T* A,
+                                rocblas_int offset_a,
+                                rocblas_int ld_a,
+                                rocblas_stride stride_a,
+                                T* const B[],
+                                rocblas_int offset_b,
+                                rocblas_int ld_b,
+                                rocblas_stride stride_b,
+                                U beta,
+                                T* C,
+                                rocblas_int offset_c,
+                                rocblas_int ld_c,
+                                rocblas_stride stride_c,
+                                rocblas_int batch_count,
+                                T** work)
+{
+    rocsolver_stage stage(handle, "rocblas_gemm");
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, stride_a,
+                            batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, C,
+                            stride_c, batch_count);
+
+    return rocblas_gemm_template<BATCHED, T>(
+        handle, trans_a, trans_b, m, n, k, alpha, cast2constType<T>(work), offset_a, ld_a, stride_a,
+        cast2constType<T>(B), offset_b, ld_b, stride_b, beta,
+        cast2constPointer(work + batch_count), offset_c, ld_c, stride_c, batch_count);
+}
+
+// gemm overload
+// (work must have space for 2 * batch_count pointers)
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocblasCall_gemm(rocblas_handle handle,
+                                rocblas_operation trans_a,
+                                rocblas_operation trans_b,
+                                rocblas_int m,
+                                rocblas_int n,
+                                rocblas_int k,
+                                U alpha,
+                                T* const A[],
+                                rocblas_int offset_a,
+                                rocblas_int ld_a,
+                                rocblas_stride stride_a,
+                                T* B,
+                                rocblas_int offset_b,
+                                rocblas_int ld_b,
+                                rocblas_stride stride_b,
+                                U beta,
+                                T* C,
+                                rocblas_int offset_c,
+                                rocblas_int ld_c,
+                                rocblas_stride stride_c,
+                                rocblas_int batch_count,
+                                T** work)
+{
+    rocsolver_stage stage(handle, "rocblas_gemm");
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, B, stride_b,
+                            batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, C,
+                            stride_c, batch_count);
+
+    return rocblas_gemm_template<BATCHED, T>(
+        handle, trans_a, trans_b, m, n, k, alpha, cast2constType<T>(A), offset_a, ld_a, stride_a,
+        cast2constType<T>(work), offset_b, ld_b, stride_b, beta,
+        cast2constPointer(work + batch_count), offset_c, ld_c, stride_c, batch_count);
+}
+
 // trmm
 template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocblasCall_trmm(rocblas_handle handle,
@@ -568,6 +701,8 @@ rocblas_status rocblasCall_trmm(rocblas_handle handle,
                                 T* work,
                                 T** workArr)
 {
+    rocsolver_stage stage(handle, "rocblas_trmm");
+
     constexpr rocblas_int nb = ROCBLAS_TRMM_NB;
     constexpr rocblas_stride strideW = 2 * ROCBLAS_TRMM_NB * ROCBLAS_TRMM_NB;
 
@@ -601,32 +736,31 @@ rocblas_status rocblasCall_trmm(rocblas_handle handle,
                                 T* work,
                                 T** workArr)
 {
+    rocsolver_stage stage(handle, "rocblas_trmm");
+
     constexpr rocblas_int nb = ROCBLAS_TRMM_NB;
     constexpr rocblas_stride strideW = 2 * ROCBLAS_TRMM_NB * ROCBLAS_TRMM_NB;
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, work, strideW,
-                       batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, work, strideW,
+                            batch_count);
 
     // until rocblas_trmm support offset arguments,
     // we need to manually offset A and B and store in temporary arrays AA and BB
-    T **AA, **BB;
-    hipMalloc(&AA, sizeof(T*) * batch_count);
-    hipMalloc(&BB, sizeof(T*) * batch_count);
-    hipLaunchKernelGGL(shift_array, dim3(blocks), dim3(256), 0, stream, AA, A, offsetA, batch_count);
-    hipLaunchKernelGGL(shift_array, dim3(blocks), dim3(256), 0, stream, BB, B, offsetB, batch_count);
+    // (workArr must have space for 3 * batch_count pointers)
+    T** AA = workArr + batch_count;
+    T** BB = workArr + 2 * batch_count;
+    ROCSOLVER_LAUNCH_KERNEL(shift_array, dim3(blocks), dim3(256), 0, stream, AA, A, offsetA,
+                            batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(shift_array, dim3(blocks), dim3(256), 0, stream, BB, B, offsetB,
+                            batch_count);
 
-    rocblas_status status = rocblas_trmm_template<BATCHED, nb, nb, T>(
+    return rocblas_trmm_template<BATCHED, nb, nb, T>(
         handle, side, uplo, transA, diag, m, n, cast2constType<T>(alpha),
         cast2constType<T>(cast2constPointer<T>(AA)), lda, strideA, cast2constPointer<T>(BB), ldb,
         strideB, batch_count, cast2constPointer<T>(workArr), strideW);
-
-    hipFree(AA);
-    hipFree(BB);
-
-    return status;
 }
 
 // trmm overload
@@ -651,6 +785,8 @@ rocblas_status rocblasCall_trmm(rocblas_handle handle,
                                 T* work,
                                 T** workArr)
 {
+    rocsolver_stage stage(handle, "rocblas_trmm");
+
     constexpr rocblas_int nb = ROCBLAS_TRMM_NB;
     constexpr rocblas_stride strideW = 2 * ROCBLAS_TRMM_NB * ROCBLAS_TRMM_NB;
 
@@ -660,25 +796,22 @@ rocblas_status rocblasCall_trmm(rocblas_handle handle,
 
     // adding offsets directly to the array B until rocblas_trmm
     // supports offset arguments
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, B + offsetB, strideB,
-                       batch_count);
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, workArr + batch_count, work,
-                       strideW, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, B + offsetB,
+                            strideB, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr + batch_count,
+                            work, strideW, batch_count);
 
     // until rocblas_trmm support offset arguments,
     // we need to manually offset A and store in temporary array AA
-    T** AA;
-    hipMalloc(&AA, sizeof(T*) * batch_count);
-    hipLaunchKernelGGL(shift_array, dim3(blocks), dim3(256), 0, stream, AA, A, offsetA, batch_count);
+    // (workArr must have space for 3 * batch_count pointers)
+    T** AA = workArr + 2 * batch_count;
+    ROCSOLVER_LAUNCH_KERNEL(shift_array, dim3(blocks), dim3(256), 0, stream, AA, A, offsetA,
+                            batch_count);
 
-    rocblas_status status = rocblas_trmm_template<BATCHED, nb, nb, T>(
+    return rocblas_trmm_template<BATCHED, nb, nb, T>(
         handle, side, uplo, transA, diag, m, n, cast2constType<T>(alpha),
         cast2constType<T>(cast2constPointer<T>(AA)), lda, strideA, cast2constPointer<T>(workArr),
         ldb, strideB, batch_count, cast2constPointer<T>(workArr + batch_count), strideW);
-
-    hipFree(AA);
-
-    return status;
 }
 
 // syrk
@@ -700,6 +833,8 @@ rocblas_status rocblasCall_syrk(rocblas_handle handle,
                                 rocblas_stride strideC,
                                 rocblas_int batch_count)
 {
+    rocsolver_stage stage(handle, "rocblas_syrk");
+
     return rocblas_syrk_template(handle, uplo, transA, n, k, cast2constType<T>(alpha),
                                  cast2constType<T>(A), offsetA, lda, strideA,
                                  cast2constType<T>(beta), C, offsetC, ldc, strideC, batch_count);
@@ -724,6 +859,8 @@ rocblas_status rocblasCall_herk(rocblas_handle handle,
                                 rocblas_stride strideC,
                                 rocblas_int batch_count)
 {
+    rocsolver_stage stage(handle, "rocblas_herk");
+
     return rocblas_syrk_template(handle, uplo, transA, n, k, cast2constType<S>(alpha),
                                  cast2constType<T>(A), offsetA, lda, strideA,
                                  cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
@@ -747,6 +884,8 @@ rocblas_status rocblasCall_herk(rocblas_handle handle,
                                 rocblas_stride strideC,
                                 rocblas_int batch_count)
 {
+    rocsolver_stage stage(handle, "rocblas_herk");
+
     return rocblas_herk_template(handle, uplo, transA, n, k, cast2constType<S>(alpha),
                                  cast2constType<T>(A), offsetA, lda, strideA,
                                  cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
@@ -844,6 +983,8 @@ rocblas_status rocblasCall_trsm(rocblas_handle handle,
                                 void* invA_arr,
                                 T** workArr = nullptr)
 {
+    rocsolver_stage stage(handle, "rocblas_trsm");
+
     U supplied_invA = nullptr;
     return rocblas_trsm_template<ROCBLAS_TRSM_BLOCK, BATCHED, T>(
         handle, side, uplo, transA, diag, m, n, alpha, cast2constType(A), offset_A, lda, stride_A,
@@ -877,14 +1018,16 @@ rocblas_status rocblasCall_trsm(rocblas_handle handle,
                                 void* invA_arr,
                                 T** workArr)
 {
+    rocsolver_stage stage(handle, "rocblas_trsm");
+
     using U = T* const*;
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, A, stride_A,
-                       batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, A, stride_A,
+                            batch_count);
 
     U supplied_invA = nullptr;
     return rocblas_trsm_template<ROCBLAS_TRSM_BLOCK, BATCHED, T>(
@@ -922,6 +1065,8 @@ rocblas_status rocblasCall_trtri(rocblas_handle handle,
                                  T** c_temp_arr,
                                  T** workArr)
 {
+    rocsolver_stage stage(handle, "rocblas_trtri");
+
     return rocblas_trtri_template<ROCBLAS_TRTRI_NB, BATCHED, STRIDED, T>(
         handle, uplo, diag, n, cast2constType(A), offset_A, lda, stride_A, 0, invA, offset_invA,
         ldinvA, stride_invA, 0, batch_count, 1, c_temp);
@@ -946,14 +1091,16 @@ rocblas_status rocblasCall_trtri(rocblas_handle handle,
                                  T** c_temp_arr,
                                  T** workArr)
 {
+    rocsolver_stage stage(handle, "rocblas_trtri");
+
     size_t c_temp_els = rocblas_trtri_temp_size<ROCBLAS_TRTRI_NB>(n, 1);
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, c_temp_arr, c_temp,
-                       c_temp_els, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, c_temp_arr, c_temp,
+                            c_temp_els, batch_count);
 
     return rocblas_trtri_template<ROCBLAS_TRTRI_NB, BATCHED, STRIDED, T>(
         handle, uplo, diag, n, cast2constType(A), offset_A, lda, stride_A, 0, invA, offset_invA,
@@ -979,16 +1126,18 @@ rocblas_status rocblasCall_trtri(rocblas_handle handle,
                                  T** c_temp_arr,
                                  T** workArr)
 {
+    rocsolver_stage stage(handle, "rocblas_trtri");
+
     size_t c_temp_els = rocblas_trtri_temp_size<ROCBLAS_TRTRI_NB>(n, 1);
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, invA, stride_invA,
-                       batch_count);
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, c_temp_arr, c_temp,
-                       c_temp_els, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, invA,
+                            stride_invA, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, c_temp_arr, c_temp,
+                            c_temp_els, batch_count);
 
     return rocblas_trtri_template<ROCBLAS_TRTRI_NB, BATCHED, STRIDED, T>(
         handle, uplo, diag, n, cast2constType(A), offset_A, lda, stride_A, 0,
@@ -0,0 +1,34 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef SIDE_STREAM_HPP
+#define SIDE_STREAM_HPP
+
+#include <rocblas.h>
+
+// number of events that come with a secondary stream
+#define ROCSOLVER_SIDE_EVENTS 2
+
+/** A secondary stream, on the given device, and ROCSOLVER_SIDE_EVENTS events
+    (created without timing) to order it with the stream of a handle. **/
+struct rocsolver_side_stream
+{
+    int device;
+    hipStream_t stream;
+    hipEvent_t events[ROCSOLVER_SIDE_EVENTS];
+};
+
+/** ROCSOLVER_ACQUIRE_SIDE_STREAM takes a secondary stream of the current device
+    from a pool shared by all the handles, or creates one if the pool is empty, so
+    that no stream is created (or destroyed, which would block the host) per call.
+    It must be given back with rocsolver_release_side_stream once all the work
+    that uses it has been enqueued. Returns false if it cannot be created. **/
+bool rocsolver_acquire_side_stream(rocsolver_side_stream* side);
+
+/** ROCSOLVER_RELEASE_SIDE_STREAM returns the secondary stream to the pool.
+    (The work enqueued on it does not need to be finished: whoever acquires it
+    next orders it with its own stream through the events.) **/
+void rocsolver_release_side_stream(const rocsolver_side_stream& side);
+
+#endif
@@ -0,0 +1,33 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef TUNING_HPP
+#define TUNING_HPP
+
+#include "libcommon.hpp"
+#include "rocsolver-extra-types.h"
+#include <rocblas.h>
+
+/** ROCSOLVER_GET_TUNING returns the value of the tuning parameter param for
+    the given precision and problem size on the current device.
+    The values are taken from the entries loaded from the file named by the
+    environment variable ROCSOLVER_TUNING_FILE, from the environment variable
+    ROCSOLVER_TUNING, or set with rocsolver_set_tuning_parameter; if no entry
+    matches, the compiled default in ideal_sizes.hpp is returned.
+    The environment is read the first time a parameter is queried. **/
+rocblas_int rocsolver_get_tuning(const rocsolver_tuning_param param,
+                                 const rocblas_datatype precision,
+                                 const rocblas_int size);
+
+/** ROCSOLVER_INIT_TUNING reads the tuning entries from the environment if that
+    has not been done yet. **/
+void rocsolver_init_tuning();
+
+template <typename T>
+inline rocblas_int rocsolver_get_tuning(const rocsolver_tuning_param param, const rocblas_int size)
+{
+    return rocsolver_get_tuning(param, rocblas_datatype_from_type<T>, size);
+}
+
+#endif
@@ -21,14 +21,12 @@ template <typename T, bool BATCHED>
 void rocsolver_gebd2_getMemorySize(const rocblas_int m,
                                    const rocblas_int n,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work_workArr,
                                    size_t* size_Abyx_norms)
 {
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work_workArr = 0;
         *size_Abyx_norms = 0;
         return;
@@ -37,8 +35,7 @@ void rocsolver_gebd2_getMemorySize(const rocblas_int m,
     // size of Abyx_norms is maximum of what is needed by larf and larfg
     // size_work_workArr is maximum of re-usable work space and array of pointers to workspace
     size_t s1, s2, w1, w2;
-    rocsolver_larf_getMemorySize<T, BATCHED>(rocblas_side_both, m, n, batch_count, size_scalars,
-                                             &s1, &w1);
+    rocsolver_larf_getMemorySize<T, BATCHED>(rocblas_side_both, m, n, batch_count, &s1, &w1);
     rocsolver_larfg_getMemorySize<T>(max(m, n), batch_count, &w2, &s2);
     *size_work_workArr = max(w1, w2);
     *size_Abyx_norms = max(s1, s2);
@@ -92,6 +89,8 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
                                         void* work_workArr,
                                         T* Abyx_norms)
 {
+    rocsolver_stage stage(handle, "gebd2");
+
     // quick return
     if(m == 0 || n == 0 || batch_count == 0)
         return rocblas_status_success;
@@ -112,8 +111,9 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
                                      (tauq + j), strideQ, batch_count, (T*)work_workArr, Abyx_norms);
 
             // copy A(j,j) to D and insert one to build/apply the householder matrix
-            hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, D, j,
-                               strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, 1, true);
+            ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                    D, j, strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, 1,
+                                    true);
 
             // Apply Householder reflector H(j)
             if(j < n - 1)
@@ -133,8 +133,9 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
             }
 
             // restore original value of A(j,j)
-            hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
-                               D, j, strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, 1);
+            ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                    stream, D, j, strideD, A, shiftA + idx2D(j, j, lda), lda,
+                                    strideA, 1);
 
             if(j < n - 1)
             {
@@ -150,9 +151,9 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
 
                 // copy A(j,j+1) to E and insert one to build/apply the householder
                 // matrix
-                hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
-                                   E, j, strideE, A, shiftA + idx2D(j, j + 1, lda), lda, strideA, 1,
-                                   true);
+                ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                        stream, E, j, strideE, A, shiftA + idx2D(j, j + 1, lda),
+                                        lda, strideA, 1, true);
 
                 // Apply Householder reflector G(j)
                 rocsolver_larf_template(handle, rocblas_side_right, m - j - 1, n - j - 1, A,
@@ -165,14 +166,15 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
                                                 lda, strideA, batch_count);
 
                 // restore original value of A(j,j+1)
-                hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
-                                   E, j, strideE, A, shiftA + idx2D(j, j + 1, lda), lda, strideA, 1);
+                ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                        stream, E, j, strideE, A, shiftA + idx2D(j, j + 1, lda),
+                                        lda, strideA, 1);
             }
             else
             {
                 // zero taup(j)
-                hipLaunchKernelGGL(reset_batch_info<T>, dim3(1, batch_count), dim3(1, 1), 0, stream,
-                                   taup + j, strideP, 1, 0);
+                ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>, dim3(1, batch_count), dim3(1, 1), 0,
+                                        stream, taup + j, strideP, 1, 0);
             }
         }
     }
@@ -191,8 +193,9 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
                                      (taup + j), strideP, batch_count, (T*)work_workArr, Abyx_norms);
 
             // copy A(j,j) to D and insert one to build/apply the householder matrix
-            hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, D, j,
-                               strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, 1, true);
+            ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                    D, j, strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, 1,
+                                    true);
 
             // Apply Householder reflector G(j)
             if(j < m - 1)
@@ -208,8 +211,9 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
                                             strideA, batch_count);
 
             // restore original value of A(j,j)
-            hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
-                               D, j, strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, 1);
+            ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                    stream, D, j, strideD, A, shiftA + idx2D(j, j, lda), lda,
+                                    strideA, 1);
 
             if(j < m - 1)
             {
@@ -221,9 +225,9 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
 
                 // copy A(j+1,j) to D and insert one to build/apply the householder
                 // matrix
-                hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
-                                   E, j, strideE, A, shiftA + idx2D(j + 1, j, lda), lda, strideA, 1,
-                                   true);
+                ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                        stream, E, j, strideE, A, shiftA + idx2D(j + 1, j, lda),
+                                        lda, strideA, 1, true);
 
                 // conjugate tauq
                 if(COMPLEX)
@@ -240,14 +244,15 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
                     rocsolver_lacgv_template<T>(handle, 1, tauq, j, 1, strideQ, batch_count);
 
                 // restore original value of A(j,j+1)
-                hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
-                                   E, j, strideE, A, shiftA + idx2D(j + 1, j, lda), lda, strideA, 1);
+                ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                        stream, E, j, strideE, A, shiftA + idx2D(j + 1, j, lda),
+                                        lda, strideA, 1);
             }
             else
             {
                 // zero tauq(j)
-                hipLaunchKernelGGL(reset_batch_info<T>, dim3(1, batch_count), dim3(1, 1), 0, stream,
-                                   tauq + j, strideQ, 1, 0);
+                ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>, dim3(1, batch_count), dim3(1, 1), 0,
+                                        stream, tauq + j, strideQ, 1, 0);
             }
         }
     }
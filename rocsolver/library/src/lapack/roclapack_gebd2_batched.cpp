@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_gebd2.hpp"
+#include "logging.hpp"
 
 template <typename S, typename T, typename U>
 rocblas_status rocsolver_gebd2_batched_impl(rocblas_handle handle,
@@ -23,7 +24,9 @@ rocblas_status rocsolver_gebd2_batched_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "gebd2_batched", "-m", m, "-n", n, "A", A, "--lda", lda, "D", D,
+                     "strideD", strideD, "E", E, "strideE", strideE, "tauq", tauq,
+                     "strideQ", strideQ, "taup", taup, "--bsp", strideP, "--batch", batch_count);
 
     // argument checking
     rocblas_status st = rocsolver_gebd2_gebrd_argCheck(m, n, lda, A, D, E, tauq, taup, batch_count);
@@ -37,36 +40,33 @@ rocblas_status rocsolver_gebd2_batched_impl(rocblas_handle handle,
     rocblas_stride strideA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of arrays of pointers (for batched cases) and re-usable workspace
     size_t size_work_workArr;
     // extra requirements for calling larf and larfg
     size_t size_Abyx_norms;
-    rocsolver_gebd2_getMemorySize<T, true>(m, n, batch_count, &size_scalars, &size_work_workArr,
-                                           &size_Abyx_norms);
+    rocsolver_gebd2_getMemorySize<T, true>(m, n, batch_count, &size_work_workArr, &size_Abyx_norms);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
-                                                      size_Abyx_norms);
+        return rocblas_set_optimal_device_memory_size(handle, size_work_workArr, size_Abyx_norms);
 
     // memory workspace allocation
-    void *scalars, *work_workArr, *Abyx_norms;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms);
+    void *work_workArr, *Abyx_norms;
+    rocblas_device_malloc mem(handle, size_work_workArr, size_Abyx_norms);
 
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work_workArr = mem[1];
-    Abyx_norms = mem[2];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work_workArr = mem[0];
+    Abyx_norms = mem[1];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_gebd2_template<S, T>(handle, m, n, A, shiftA, lda, strideA, D, strideD, E,
                                           strideE, tauq, strideQ, taup, strideP, batch_count,
-                                          (T*)scalars, work_workArr, (T*)Abyx_norms);
+                                          scalars, work_workArr, (T*)Abyx_norms);
 }
 
 /*
@@ -20,7 +20,6 @@ template <typename T, bool BATCHED>
 void rocsolver_gebrd_getMemorySize(const rocblas_int m,
                                    const rocblas_int n,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work_workArr,
                                    size_t* size_Abyx_norms,
                                    size_t* size_X,
@@ -29,7 +28,6 @@ void rocsolver_gebrd_getMemorySize(const rocblas_int m,
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work_workArr = 0;
         *size_Abyx_norms = 0;
         *size_X = 0;
@@ -37,25 +35,25 @@ void rocsolver_gebrd_getMemorySize(const rocblas_int m,
         return;
     }
 
-    if(m <= GEBRD_GEBD2_SWITCHSIZE || n <= GEBRD_GEBD2_SWITCHSIZE)
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_gebrd_switchsize, min(m, n));
+    if(m <= nb || n <= nb)
     {
         // requirements for calling a single GEBD2
-        rocsolver_gebd2_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars,
-                                                  size_work_workArr, size_Abyx_norms);
+        rocsolver_gebd2_getMemorySize<T, BATCHED>(m, n, batch_count, size_work_workArr,
+                                                  size_Abyx_norms);
         *size_X = 0;
         *size_Y = 0;
     }
 
     else
     {
-        size_t s1, s2, w1, w2, unused;
-        rocblas_int k = GEBRD_GEBD2_SWITCHSIZE;
+        size_t s1, s2, w1, w2;
+        rocblas_int k = nb;
         rocblas_int d = min(m / k, n / k);
 
         // sizes are maximum of what is required by GEBD2 and LABRD
-        rocsolver_gebd2_getMemorySize<T, BATCHED>(m - d * k, n - d * k, batch_count, &unused, &w1,
-                                                  &s1);
-        rocsolver_labrd_getMemorySize<T, BATCHED>(m, n, k, batch_count, size_scalars, &w2, &s2);
+        rocsolver_gebd2_getMemorySize<T, BATCHED>(m - d * k, n - d * k, batch_count, &w1, &s1);
+        rocsolver_labrd_getMemorySize<T, BATCHED>(m, n, k, batch_count, &w2, &s2);
         *size_work_workArr = max(w1, w2);
         *size_Abyx_norms = max(s1, s2);
 
@@ -98,6 +96,8 @@ rocblas_status rocsolver_gebrd_template(rocblas_handle handle,
                                         void* work_workArr,
                                         T* Abyx_norms)
 {
+    rocsolver_stage stage(handle, "gebrd");
+
     // quick return
     if(m == 0 || n == 0 || batch_count == 0)
         return rocblas_status_success;
@@ -107,7 +107,7 @@ rocblas_status rocsolver_gebrd_template(rocblas_handle handle,
 
     T minone = -1;
     T one = 1;
-    rocblas_int k = GEBRD_GEBD2_SWITCHSIZE;
+    rocblas_int k = rocsolver_get_tuning<T>(rocsolver_tuning_gebrd_switchsize, min(m, n));
     rocblas_int dim = min(m, n); // total number of pivots
     rocblas_int jb, j = 0;
     rocblas_int blocks;
@@ -125,11 +125,11 @@ rocblas_status rocsolver_gebrd_template(rocblas_handle handle,
 
     // zero X and Y
     blocks = (ldx * k - 1) / 64 + 1;
-    hipLaunchKernelGGL(reset_batch_info<T>, dim3(blocks, batch_count, 1), dim3(64, 1, 1), 0, stream,
-                       X + shiftX, strideX, ldx * k, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>, dim3(blocks, batch_count, 1), dim3(64, 1, 1), 0,
+                            stream, X + shiftX, strideX, ldx * k, 0);
     blocks = (ldy * k - 1) / 64 + 1;
-    hipLaunchKernelGGL(reset_batch_info<T>, dim3(blocks, batch_count, 1), dim3(64, 1, 1), 0, stream,
-                       Y + shiftY, strideY, ldy * k, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>, dim3(blocks, batch_count, 1), dim3(64, 1, 1), 0,
+                            stream, Y + shiftY, strideY, ldy * k, 0);
 
     while(j < dim - k)
     {
@@ -156,22 +156,24 @@ rocblas_status rocsolver_gebrd_template(rocblas_handle handle,
         blocks = (jb - 1) / 64 + 1;
         if(m >= n)
         {
-            hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, blocks, 1), dim3(1, 64, 1), 0,
-                               stream, D, j, strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, jb);
-            hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, blocks, 1), dim3(1, 64, 1), 0,
-                               stream, E, j, strideE, A, shiftA + idx2D(j, j + 1, lda), lda,
-                               strideA, jb);
+            ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, blocks, 1), dim3(1, 64, 1),
+                                    0, stream, D, j, strideD, A, shiftA + idx2D(j, j, lda), lda,
+                                    strideA, jb);
+            ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, blocks, 1), dim3(1, 64, 1),
+                                    0, stream, E, j, strideE, A, shiftA + idx2D(j, j + 1, lda), lda,
+                                    strideA, jb);
         }
         else
         {
-            hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, blocks, 1), dim3(1, 64, 1), 0,
-                               stream, D, j, strideD, A, shiftA + idx2D(j, j, lda), lda, strideA, jb);
-            hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, blocks, 1), dim3(1, 64, 1), 0,
-                               stream, E, j, strideE, A, shiftA + idx2D(j + 1, j, lda), lda,
-                               strideA, jb);
+            ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, blocks, 1), dim3(1, 64, 1),
+                                    0, stream, D, j, strideD, A, shiftA + idx2D(j, j, lda), lda,
+                                    strideA, jb);
+            ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, blocks, 1), dim3(1, 64, 1),
+                                    0, stream, E, j, strideE, A, shiftA + idx2D(j + 1, j, lda), lda,
+                                    strideA, jb);
         }
 
-        j += GEBRD_GEBD2_SWITCHSIZE;
+        j += k;
     }
 
     // factor last block
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_gelqf.hpp"
+#include "logging.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_gelqf_impl(rocblas_handle handle,
@@ -15,7 +16,7 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "gelqf", "-m", m, "-n", n, "A", A, "--lda", lda, "ipiv", ipiv);
 
     // argument checking
     rocblas_status st = rocsolver_gelq2_gelqf_argCheck(m, n, lda, A, ipiv);
@@ -31,42 +32,42 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of arrays of pointers (for batched cases) and re-usable workspace
     size_t size_work_workArr, size_workArr;
     // extra requirements for calling GEQR2 and to store temporary triangular factor
     size_t size_Abyx_norms_trfact;
     // extra requirements for calling GEQR2 and LARFB
     size_t size_diag_tmptr;
-    rocsolver_gelqf_getMemorySize<T, false>(m, n, batch_count, &size_scalars, &size_work_workArr,
-                                            &size_Abyx_norms_trfact, &size_diag_tmptr, &size_workArr);
+    rocsolver_gelqf_getMemorySize<T, false>(m, n, batch_count, &size_work_workArr,
+                                            &size_Abyx_norms_trfact, &size_diag_tmptr,
+                                            &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+        return rocblas_set_optimal_device_memory_size(handle, size_work_workArr,
                                                       size_Abyx_norms_trfact, size_diag_tmptr,
                                                       size_workArr);
 
     // memory workspace allocation
-    void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
-                              size_diag_tmptr, size_workArr);
+    void *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
+    rocblas_device_malloc mem(handle, size_work_workArr, size_Abyx_norms_trfact, size_diag_tmptr,
+                              size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work_workArr = mem[1];
-    Abyx_norms_trfact = mem[2];
-    diag_tmptr = mem[3];
-    workArr = mem[4];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work_workArr = mem[0];
+    Abyx_norms_trfact = mem[1];
+    diag_tmptr = mem[2];
+    workArr = mem[3];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_gelqf_template<false, false, T>(
-        handle, m, n, A, shiftA, lda, strideA, ipiv, stridep, batch_count, (T*)scalars,
-        work_workArr, (T*)Abyx_norms_trfact, (T*)diag_tmptr, (T**)workArr);
+        handle, m, n, A, shiftA, lda, strideA, ipiv, stridep, batch_count, scalars, work_workArr,
+        (T*)Abyx_norms_trfact, (T*)diag_tmptr, (T**)workArr);
 }
 
 /*
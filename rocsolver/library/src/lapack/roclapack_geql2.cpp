@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_geql2.hpp"
+#include "logging.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_geql2_impl(rocblas_handle handle,
@@ -15,7 +16,7 @@ rocblas_status rocsolver_geql2_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "geql2", "-m", m, "-n", n, "A", A, "--lda", lda, "ipiv", ipiv);
 
     // argument checking
     rocblas_status st = rocsolver_geql2_geqlf_argCheck(m, n, lda, A, ipiv);
@@ -31,38 +32,37 @@ rocblas_status rocsolver_geql2_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of arrays of pointers (for batched cases) and re-usable workspace
     size_t size_work_workArr;
     // extra requirements for calling LARF and LARFG
     size_t size_Abyx_norms;
     // size of temporary array to store diagonal elements
     size_t size_diag;
-    rocsolver_geql2_getMemorySize<T, false>(m, n, batch_count, &size_scalars, &size_work_workArr,
-                                            &size_Abyx_norms, &size_diag);
+    rocsolver_geql2_getMemorySize<T, false>(m, n, batch_count, &size_work_workArr, &size_Abyx_norms,
+                                            &size_diag);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
-                                                      size_Abyx_norms, size_diag);
+        return rocblas_set_optimal_device_memory_size(handle, size_work_workArr, size_Abyx_norms,
+                                                      size_diag);
 
     // memory workspace allocation
-    void *scalars, *work_workArr, *Abyx_norms, *diag;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms, size_diag);
+    void *work_workArr, *Abyx_norms, *diag;
+    rocblas_device_malloc mem(handle, size_work_workArr, size_Abyx_norms, size_diag);
 
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work_workArr = mem[1];
-    Abyx_norms = mem[2];
-    diag = mem[3];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work_workArr = mem[0];
+    Abyx_norms = mem[1];
+    diag = mem[2];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_geql2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, stridep,
-                                       batch_count, (T*)scalars, work_workArr, (T*)Abyx_norms,
+                                       batch_count, scalars, work_workArr, (T*)Abyx_norms,
                                        (T*)diag);
 }
 
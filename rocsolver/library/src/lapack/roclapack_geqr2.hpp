@@ -20,7 +20,6 @@ template <typename T, bool BATCHED>
 void rocsolver_geqr2_getMemorySize(const rocblas_int m,
                                    const rocblas_int n,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work_workArr,
                                    size_t* size_Abyx_norms,
                                    size_t* size_diag)
@@ -28,7 +27,6 @@ void rocsolver_geqr2_getMemorySize(const rocblas_int m,
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work_workArr = 0;
         *size_Abyx_norms = 0;
         *size_diag = 0;
@@ -38,8 +36,7 @@ void rocsolver_geqr2_getMemorySize(const rocblas_int m,
     // size of Abyx_norms is maximum of what is needed by larf and larfg
     // size_work_workArr is maximum of re-usable work space and array of pointers to workspace
     size_t s1, s2, w1, w2;
-    rocsolver_larf_getMemorySize<T, BATCHED>(rocblas_side_left, m, n, batch_count, size_scalars,
-                                             &s1, &w1);
+    rocsolver_larf_getMemorySize<T, BATCHED>(rocblas_side_left, m, n, batch_count, &s1, &w1);
     rocsolver_larfg_getMemorySize<T>(m, batch_count, &w2, &s2);
     *size_work_workArr = max(w1, w2);
     *size_Abyx_norms = max(s1, s2);
@@ -88,6 +85,8 @@ rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
                                         T* Abyx_norms,
                                         T* diag)
 {
+    rocsolver_stage stage(handle, "geqr2");
+
     // quick return
     if(m == 0 || n == 0 || batch_count == 0)
         return rocblas_status_success;
@@ -105,8 +104,8 @@ rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
                                  strideP, batch_count, (T*)work_workArr, Abyx_norms);
 
         // insert one in A(j,j) tobuild/apply the householder matrix
-        hipLaunchKernelGGL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, diag, 0,
-                           1, A, shiftA + idx2D(j, j, lda), lda, strideA, 1, true);
+        ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(j, j, lda), lda, strideA, 1, true);
 
         // conjugate tau
         if(COMPLEX)
@@ -122,8 +121,8 @@ rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
         }
 
         // restore original value of A(j,j)
-        hipLaunchKernelGGL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, diag,
-                           0, 1, A, shiftA + idx2D(j, j, lda), lda, strideA, 1);
+        ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(j, j, lda), lda, strideA, 1);
 
         // restore tau
         if(COMPLEX)
@@ -20,7 +20,6 @@ template <typename T, bool BATCHED>
 void rocsolver_geqrf_getMemorySize(const rocblas_int m,
                                    const rocblas_int n,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work_workArr,
                                    size_t* size_Abyx_norms_trfact,
                                    size_t* size_diag_tmptr,
@@ -29,7 +28,6 @@ void rocsolver_geqrf_getMemorySize(const rocblas_int m,
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work_workArr = 0;
         *size_Abyx_norms_trfact = 0;
         *size_diag_tmptr = 0;
@@ -37,39 +35,39 @@ void rocsolver_geqrf_getMemorySize(const rocblas_int m,
         return;
     }
 
-    if(m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE)
+    rocblas_int nx = rocsolver_get_tuning<T>(rocsolver_tuning_geqxf_switchsize, min(m, n));
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_geqxf_blocksize, min(m, n));
+    if(m <= nx || n <= nx)
     {
         // requirements for a single GEQR2 call
-        rocsolver_geqr2_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars, size_work_workArr,
+        rocsolver_geqr2_getMemorySize<T, BATCHED>(m, n, batch_count, size_work_workArr,
                                                   size_Abyx_norms_trfact, size_diag_tmptr);
         *size_workArr = 0;
     }
     else
     {
-        size_t w1, w2, w3, unused, s1, s2;
-        rocblas_int jb = GEQxF_GEQx2_BLOCKSIZE;
+        size_t w1, w2, w3, s1, s2, a1;
+        rocblas_int jb = nb;
 
         // size to store the temporary triangular factor
         *size_Abyx_norms_trfact = sizeof(T) * jb * jb * batch_count;
 
         // requirements for calling GEQR2 with sub blocks
-        rocsolver_geqr2_getMemorySize<T, BATCHED>(m, jb, batch_count, size_scalars, &w1, &s2, &s1);
+        rocsolver_geqr2_getMemorySize<T, BATCHED>(m, jb, batch_count, &w1, &s2, &s1);
         *size_Abyx_norms_trfact = max(s2, *size_Abyx_norms_trfact);
 
         // requirements for calling LARFT
-        rocsolver_larft_getMemorySize<T, BATCHED>(m, jb, batch_count, &unused, &w2, size_workArr);
+        rocsolver_larft_getMemorySize<T, BATCHED>(m, jb, batch_count, &w2, size_workArr);
 
         // requirements for calling LARFB
         rocsolver_larfb_getMemorySize<T, BATCHED>(rocblas_side_left, m, n - jb, jb, batch_count,
-                                                  &w3, &s2, &unused);
+                                                  &w3, &s2, &a1);
 
         *size_work_workArr = max(w1, max(w2, w3));
         *size_diag_tmptr = max(s1, s2);
 
-        // size of workArr is double to accomodate
-        // LARFB's TRMM calls in the batched case
-        if(BATCHED)
-            *size_workArr *= 2;
+        // size of workArr is the maximum of what is needed by larft and larfb
+        *size_workArr = max(*size_workArr, a1);
     }
 }
 
@@ -90,6 +88,8 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
                                         T* diag_tmptr,
                                         T** workArr)
 {
+    rocsolver_stage stage(handle, "geqrf");
+
     // quick return
     if(m == 0 || n == 0 || batch_count == 0)
         return rocblas_status_success;
@@ -99,7 +99,9 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
 
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the
     // algorithm
-    if(m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE)
+    rocblas_int nx = rocsolver_get_tuning<T>(rocsolver_tuning_geqxf_switchsize, min(m, n));
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_geqxf_blocksize, min(m, n));
+    if(m <= nx || n <= nx)
         return rocsolver_geqr2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP,
                                            batch_count, scalars, work_workArr, Abyx_norms_trfact,
                                            diag_tmptr);
@@ -107,13 +109,13 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
     rocblas_int dim = min(m, n); // total number of pivots
     rocblas_int jb, j = 0;
 
-    rocblas_int ldw = GEQxF_GEQx2_BLOCKSIZE;
+    rocblas_int ldw = nb;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
-    while(j < dim - GEQxF_GEQx2_SWITCHSIZE)
+    while(j < dim - nx)
     {
         // Factor diagonal and subdiagonal blocks
-        jb = min(dim - j, GEQxF_GEQx2_BLOCKSIZE); // number of columns in the block
+        jb = min(dim - j, nb); // number of columns in the block
         rocsolver_geqr2_template<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
                                     (ipiv + j), strideP, batch_count, scalars, work_workArr,
                                     Abyx_norms_trfact, diag_tmptr);
@@ -135,7 +137,7 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
                 shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, (T*)work_workArr,
                 diag_tmptr, workArr);
         }
-        j += GEQxF_GEQx2_BLOCKSIZE;
+        j += nb;
     }
 
     // factor last block
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_geqrf.hpp"
+#include "logging.hpp"
 
 /*
  * ===========================================================================
@@ -34,7 +35,8 @@ rocblas_status rocsolver_geqrf_ptr_batched_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "geqrf_ptr_batched", "-m", m, "-n", n, "A", A, "--lda", lda,
+                     "tau", tau, "--batch", batch_count);
 
     // argument checking
     rocblas_status st = rocsolver_geqr2_geqrf_argCheck(m, n, lda, A, tau, batch_count);
@@ -49,45 +51,45 @@ rocblas_status rocsolver_geqrf_ptr_batched_impl(rocblas_handle handle,
     rocblas_stride strideP = min(m, n);
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of arrays of pointers (for batched cases) and re-usable workspace
     size_t size_work_workArr, size_workArr;
     // extra requirements for calling GEQR2 and to store temporary triangular factor
     size_t size_Abyx_norms_trfact;
     // extra requirements for calling GEQR2 and LARFB
     size_t size_diag_tmptr;
-    rocsolver_geqrf_getMemorySize<T, true>(m, n, batch_count, &size_scalars, &size_work_workArr,
-                                           &size_Abyx_norms_trfact, &size_diag_tmptr, &size_workArr);
+    rocsolver_geqrf_getMemorySize<T, true>(m, n, batch_count, &size_work_workArr,
+                                           &size_Abyx_norms_trfact, &size_diag_tmptr,
+                                           &size_workArr);
 
     // this is to mamange tau as a simple array ipiv
     size_t size_ipiv = sizeof(T) * strideP * batch_count;
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+        return rocblas_set_optimal_device_memory_size(handle, size_work_workArr,
                                                       size_Abyx_norms_trfact, size_diag_tmptr,
                                                       size_workArr, size_ipiv);
 
     // memory workspace allocation
-    void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr, *ipiv;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
-                              size_diag_tmptr, size_workArr, size_ipiv);
+    void *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr, *ipiv;
+    rocblas_device_malloc mem(handle, size_work_workArr, size_Abyx_norms_trfact, size_diag_tmptr,
+                              size_workArr, size_ipiv);
 
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work_workArr = mem[1];
-    Abyx_norms_trfact = mem[2];
-    diag_tmptr = mem[3];
-    workArr = mem[4];
-    ipiv = mem[5];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work_workArr = mem[0];
+    Abyx_norms_trfact = mem[1];
+    diag_tmptr = mem[2];
+    workArr = mem[3];
+    ipiv = mem[4];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     rocblas_status status = rocsolver_geqrf_template<true, false, T>(
-        handle, m, n, A, shiftA, lda, strideA, (T*)ipiv, strideP, batch_count, (T*)scalars,
+        handle, m, n, A, shiftA, lda, strideA, (T*)ipiv, strideP, batch_count, scalars,
         work_workArr, (T*)Abyx_norms_trfact, (T*)diag_tmptr, (T**)workArr);
 
     // copy ipiv into tau
@@ -97,8 +99,8 @@ rocblas_status rocsolver_geqrf_ptr_batched_impl(rocblas_handle handle,
         rocblas_get_stream(handle, &stream);
 
         rocblas_int blocks = (strideP - 1) / 32 + 1;
-        hipLaunchKernelGGL(copy_array_to_ptrs, dim3(blocks, batch_count), dim3(32, 1), 0, stream,
-                           strideP, tau, (T*)ipiv);
+        ROCSOLVER_LAUNCH_KERNEL(copy_array_to_ptrs, dim3(blocks, batch_count), dim3(32, 1), 0,
+                                stream, strideP, tau, (T*)ipiv);
     }
 
     return status;
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesv.hpp"
+#include "logging.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gesv_impl(rocblas_handle handle,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   U A,
+                                   const rocblas_int lda,
+                                   rocblas_int* ipiv,
+                                   U B,
+                                   const rocblas_int ldb,
+                                   rocblas_int* info)
+{
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_log<T>(handle, "gesv", "-m", n, "-n", nrhs, "A", A, "--lda", lda, "ipiv", ipiv, "B",
+                     B, "--ldb", ldb, "info", info);
+
+    // argument checking
+    rocblas_status st = rocsolver_gesv_argCheck(n, nrhs, lda, ldb, A, B, ipiv, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of reusable workspace (and for calling TRSM)
+    size_t size_work, size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size to store info about singularity of each subblock
+    size_t size_iinfo;
+    rocsolver_gesv_getMemorySize<false, false, T, S>(
+        n, nrhs, batch_count, &size_work, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivotval, &size_pivotidx, &size_iinfo);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivotval,
+                                                      size_pivotidx, size_iinfo);
+
+    // always allocate all required memory for TRSM optimal performance
+    bool optim_mem = true;
+
+    // memory workspace allocation
+    void *work, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo;
+    rocblas_device_malloc mem(handle, size_work, size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_iinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    iinfo = mem[7];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
+
+    // execution
+    return rocsolver_gesv_template<false, false, T, S>(
+        handle, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, info,
+        batch_count, scalars, (rocblas_index_value_t<S>*)work, work1, work2, work3, work4,
+        (T*)pivotval, (rocblas_int*)pivotidx, (rocblas_int*)iinfo, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_sgesv(rocblas_handle handle,
+                                          const rocblas_int n,
+                                          const rocblas_int nrhs,
+                                          float* A,
+                                          const rocblas_int lda,
+                                          rocblas_int* ipiv,
+                                          float* B,
+                                          const rocblas_int ldb,
+                                          rocblas_int* info)
+{
+    return rocsolver_gesv_impl<float>(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+extern "C" rocblas_status rocsolver_dgesv(rocblas_handle handle,
+                                          const rocblas_int n,
+                                          const rocblas_int nrhs,
+                                          double* A,
+                                          const rocblas_int lda,
+                                          rocblas_int* ipiv,
+                                          double* B,
+                                          const rocblas_int ldb,
+                                          rocblas_int* info)
+{
+    return rocsolver_gesv_impl<double>(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+extern "C" rocblas_status rocsolver_cgesv(rocblas_handle handle,
+                                          const rocblas_int n,
+                                          const rocblas_int nrhs,
+                                          rocblas_float_complex* A,
+                                          const rocblas_int lda,
+                                          rocblas_int* ipiv,
+                                          rocblas_float_complex* B,
+                                          const rocblas_int ldb,
+                                          rocblas_int* info)
+{
+    return rocsolver_gesv_impl<rocblas_float_complex>(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+extern "C" rocblas_status rocsolver_zgesv(rocblas_handle handle,
+                                          const rocblas_int n,
+                                          const rocblas_int nrhs,
+                                          rocblas_double_complex* A,
+                                          const rocblas_int lda,
+                                          rocblas_int* ipiv,
+                                          rocblas_double_complex* B,
+                                          const rocblas_int ldb,
+                                          rocblas_int* info)
+{
+    return rocsolver_gesv_impl<rocblas_double_complex>(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
@@ -0,0 +1,470 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GESV_HPP
+#define ROCLAPACK_GESV_HPP
+
+#include "rocblas.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver.h"
+
+#ifdef OPTIMAL
+/*************************************************************************
+    gesv_small_kernel factorizes and solves the systems with n <= WAVESIZE
+    in a single kernel: as in LUfact_small_kernel, each thread keeps a row
+    of A in registers, and then the right-hand sides are solved in blocks of
+    GETRS_NRHS_BLOCKSIZE columns. The rows of B are read permuted by the
+    pivots, so that no interchanges are applied in global memory.
+*************************************************************************/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(WAVESIZE) gesv_small_kernel(const rocblas_int nrhs,
+                                                              U AA,
+                                                              const rocblas_int shiftA,
+                                                              const rocblas_int lda,
+                                                              const rocblas_stride strideA,
+                                                              rocblas_int* ipivA,
+                                                              const rocblas_stride strideP,
+                                                              U BB,
+                                                              const rocblas_int shiftB,
+                                                              const rocblas_int ldb,
+                                                              const rocblas_stride strideB,
+                                                              rocblas_int* infoA,
+                                                              const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    int myrow = hipThreadIdx_x;
+    const int inrow = myrow; // row of B taken by this thread
+    const int ty = hipThreadIdx_y;
+    const int id = hipBlockIdx_x * hipBlockDim_y + ty;
+
+    if(id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, id, shiftB, strideB);
+    rocblas_int* ipiv = ipivA + id * strideP;
+    rocblas_int* info = infoA + id;
+
+    // shared memory (for communication between threads in group)
+    extern __shared__ double lmem[];
+    T* common = (T*)lmem;
+    common += ty * WAVESIZE;
+
+    // local variables
+    T pivot_value;
+    T test_value;
+    int pivot_index;
+    int mypiv = myrow + 1; // to build ipiv
+    int myinfo = 0; // to build info
+    T rA[DIM]; // to store this-row values
+    T rB[GETRS_NRHS_BLOCKSIZE]; // to store this-row values of the right-hand sides
+
+// read corresponding row from global memory into local array
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+        rA[j] = A[myrow + j * lda];
+
+// LU factorization (main loop)
+#pragma unroll DIM
+    for(int k = 0; k < DIM; ++k)
+    {
+        // share current column
+        common[myrow] = rA[k];
+        __syncthreads();
+
+        // search pivot index
+        pivot_index = k;
+        pivot_value = common[k];
+        for(int i = k + 1; i < DIM; ++i)
+        {
+            test_value = common[i];
+            if(std::abs(pivot_value) < std::abs(test_value))
+            {
+                pivot_value = test_value;
+                pivot_index = i;
+            }
+        }
+
+        // check singularity and scale value for current column
+        if(pivot_value != T(0))
+            pivot_value = S(1) / pivot_value;
+        else if(myinfo == 0)
+            myinfo = k + 1;
+
+        // swap rows (lazy swaping)
+        if(myrow == pivot_index)
+        {
+            myrow = k;
+            // share pivot row
+            for(int j = k + 1; j < DIM; ++j)
+                common[j] = rA[j];
+        }
+        else if(myrow == k)
+        {
+            myrow = pivot_index;
+            mypiv = pivot_index + 1;
+        }
+        __syncthreads();
+
+        // scale current column and update trailing matrix
+        if(myrow > k)
+        {
+            rA[k] *= pivot_value;
+            for(int j = k + 1; j < DIM; ++j)
+                rA[j] -= rA[k] * common[j];
+        }
+        __syncthreads();
+    }
+
+    // write factorization to global memory
+    ipiv[myrow] = mypiv;
+    if(myrow == 0)
+        *info = myinfo;
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+        A[myrow + j * lda] = rA[j];
+
+    // (as in LAPACK, the solution is not computed if A is singular)
+    if(myinfo > 0)
+        return;
+
+    // for each block of right-hand sides
+    for(int c0 = 0; c0 < nrhs; c0 += GETRS_NRHS_BLOCKSIZE)
+    {
+        int nc = min(GETRS_NRHS_BLOCKSIZE, nrhs - c0);
+
+        // read the row of P*B that corresponds to this thread
+#pragma unroll GETRS_NRHS_BLOCKSIZE
+        for(int c = 0; c < GETRS_NRHS_BLOCKSIZE; ++c)
+            rB[c] = (c < nc) ? B[inrow + (c0 + c) * ldb] : T(0);
+
+        // solve L*Y = P*B, and then U*X = Y
+        getrs_small_trsv<DIM, true, true>(myrow, rA, rB, common);
+        getrs_small_trsv<DIM, false, false>(myrow, rA, rB, common);
+
+        // write solution to global memory
+#pragma unroll GETRS_NRHS_BLOCKSIZE
+        for(int c = 0; c < GETRS_NRHS_BLOCKSIZE; ++c)
+        {
+            if(c < nc)
+                B[myrow + (c0 + c) * ldb] = rB[c];
+        }
+    }
+}
+
+/*************************************************************
+    Launcher of gesv_small kernels
+*************************************************************/
+template <typename T, typename U>
+rocblas_status gesv_small(rocblas_handle handle,
+                          const rocblas_int n,
+                          const rocblas_int nrhs,
+                          U A,
+                          const rocblas_int shiftA,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          rocblas_int* ipiv,
+                          const rocblas_stride strideP,
+                          U B,
+                          const rocblas_int shiftB,
+                          const rocblas_int ldb,
+                          const rocblas_stride strideB,
+                          rocblas_int* info,
+                          const rocblas_int batch_count)
+{
+#define RUN_GESV_SMALL(DIM)                                                                       \
+    ROCSOLVER_LAUNCH_KERNEL((gesv_small_kernel<DIM, T>), grid, block, lmemsize, stream, nrhs, A, \
+                            shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, info,  \
+                            batch_count)
+
+    // determine sizes
+    // (as in LUfact_small, with at most one wavefront per workgroup)
+    rocblas_int ngrp = 1;
+    if(batch_count > 1)
+    {
+        ngrp = rocsolver_get_tuning<T>(rocsolver_tuning_getf2_optim_ngrp, n);
+        ngrp = min(ngrp, max(WAVESIZE / n, 1));
+    }
+    rocblas_int blocks = (batch_count - 1) / ngrp + 1;
+    rocblas_int nthds = n;
+
+    // prepare kernel launch
+    dim3 grid(blocks, 1, 1);
+    dim3 block(nthds, ngrp, 1);
+    size_t lmemsize = WAVESIZE * ngrp * sizeof(T);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make the size n known at compile time
+    // kernel launch
+    switch(n)
+    {
+    case 1: RUN_GESV_SMALL(1); break;
+    case 2: RUN_GESV_SMALL(2); break;
+    case 3: RUN_GESV_SMALL(3); break;
+    case 4: RUN_GESV_SMALL(4); break;
+    case 5: RUN_GESV_SMALL(5); break;
+    case 6: RUN_GESV_SMALL(6); break;
+    case 7: RUN_GESV_SMALL(7); break;
+    case 8: RUN_GESV_SMALL(8); break;
+    case 9: RUN_GESV_SMALL(9); break;
+    case 10: RUN_GESV_SMALL(10); break;
+    case 11: RUN_GESV_SMALL(11); break;
+    case 12: RUN_GESV_SMALL(12); break;
+    case 13: RUN_GESV_SMALL(13); break;
+    case 14: RUN_GESV_SMALL(14); break;
+    case 15: RUN_GESV_SMALL(15); break;
+    case 16: RUN_GESV_SMALL(16); break;
+    case 17: RUN_GESV_SMALL(17); break;
+    case 18: RUN_GESV_SMALL(18); break;
+    case 19: RUN_GESV_SMALL(19); break;
+    case 20: RUN_GESV_SMALL(20); break;
+    case 21: RUN_GESV_SMALL(21); break;
+    case 22: RUN_GESV_SMALL(22); break;
+    case 23: RUN_GESV_SMALL(23); break;
+    case 24: RUN_GESV_SMALL(24); break;
+    case 25: RUN_GESV_SMALL(25); break;
+    case 26: RUN_GESV_SMALL(26); break;
+    case 27: RUN_GESV_SMALL(27); break;
+    case 28: RUN_GESV_SMALL(28); break;
+    case 29: RUN_GESV_SMALL(29); break;
+    case 30: RUN_GESV_SMALL(30); break;
+    case 31: RUN_GESV_SMALL(31); break;
+    case 32: RUN_GESV_SMALL(32); break;
+    case 33: RUN_GESV_SMALL(33); break;
+    case 34: RUN_GESV_SMALL(34); break;
+    case 35: RUN_GESV_SMALL(35); break;
+    case 36: RUN_GESV_SMALL(36); break;
+    case 37: RUN_GESV_SMALL(37); break;
+    case 38: RUN_GESV_SMALL(38); break;
+    case 39: RUN_GESV_SMALL(39); break;
+    case 40: RUN_GESV_SMALL(40); break;
+    case 41: RUN_GESV_SMALL(41); break;
+    case 42: RUN_GESV_SMALL(42); break;
+    case 43: RUN_GESV_SMALL(43); break;
+    case 44: RUN_GESV_SMALL(44); break;
+    case 45: RUN_GESV_SMALL(45); break;
+    case 46: RUN_GESV_SMALL(46); break;
+    case 47: RUN_GESV_SMALL(47); break;
+    case 48: RUN_GESV_SMALL(48); break;
+    case 49: RUN_GESV_SMALL(49); break;
+    case 50: RUN_GESV_SMALL(50); break;
+    case 51: RUN_GESV_SMALL(51); break;
+    case 52: RUN_GESV_SMALL(52); break;
+    case 53: RUN_GESV_SMALL(53); break;
+    case 54: RUN_GESV_SMALL(54); break;
+    case 55: RUN_GESV_SMALL(55); break;
+    case 56: RUN_GESV_SMALL(56); break;
+    case 57: RUN_GESV_SMALL(57); break;
+    case 58: RUN_GESV_SMALL(58); break;
+    case 59: RUN_GESV_SMALL(59); break;
+    case 60: RUN_GESV_SMALL(60); break;
+    case 61: RUN_GESV_SMALL(61); break;
+    case 62: RUN_GESV_SMALL(62); break;
+    case 63: RUN_GESV_SMALL(63); break;
+    case 64: RUN_GESV_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+#endif // OPTIMAL
+
+/** GESV_COPY_SINGULAR copies the right-hand sides in B of the instances with
+    info > 0 to W (save = true), or back from W to B (save = false) **/
+template <typename T, typename U>
+__global__ void gesv_copy_singular(const bool save,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   U BB,
+                                   const rocblas_int shiftB,
+                                   const rocblas_int ldb,
+                                   const rocblas_stride strideB,
+                                   T* W,
+                                   const rocblas_int* info)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(info[b] > 0 && i < n && j < nrhs)
+    {
+        T* B = load_ptr_batch<T>(BB, b, shiftB, strideB);
+        T* Wp = W + b * size_t(n) * nrhs;
+
+        if(save)
+            Wp[i + j * n] = B[i + j * ldb];
+        else
+            B[i + j * ldb] = Wp[i + j * n];
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_gesv_argCheck(const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       const rocblas_int lda,
+                                       const rocblas_int ldb,
+                                       T A,
+                                       T B,
+                                       const rocblas_int* ipiv,
+                                       const rocblas_int* info,
+                                       const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (nrhs * n && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_gesv_getMemorySize(const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  const rocblas_int batch_count,
+                                  size_t* size_work,
+                                  size_t* size_work1,
+                                  size_t* size_work2,
+                                  size_t* size_work3,
+                                  size_t* size_work4,
+                                  size_t* size_pivotval,
+                                  size_t* size_pivotidx,
+                                  size_t* size_iinfo)
+{
+    // if quick return, no workspace is needed
+    // (and neither is it for the optimized kernels of small sizes)
+    bool fused = false;
+#ifdef OPTIMAL
+    fused = (n <= WAVESIZE);
+#endif
+    if(n == 0 || batch_count == 0 || fused)
+    {
+        *size_work = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iinfo = 0;
+        return;
+    }
+
+    // requirements for calling GETRF
+    rocsolver_getrf_getMemorySize<BATCHED, STRIDED, T, S>(n, n, batch_count, size_work, size_work1,
+                                                          size_work2, size_work3, size_work4,
+                                                          size_pivotval, size_pivotidx, size_iinfo);
+
+    // requirements for calling GETRS (the workspace is reused)
+    size_t w1, w2, w3, w4;
+    rocsolver_getrs_getMemorySize<BATCHED, T>(n, nrhs, batch_count, &w1, &w2, &w3, &w4);
+    *size_work1 = max(*size_work1, w1);
+    *size_work2 = max(*size_work2, w2);
+    *size_work3 = max(*size_work3, w3);
+    *size_work4 = max(*size_work4, w4);
+
+    // to save the right-hand sides of the singular instances while GETRS runs
+    // (GETRS does not use the workspace of GETF2)
+    *size_work = max(*size_work, sizeof(T) * n * nrhs * batch_count);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gesv_template(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       rocblas_int* ipiv,
+                                       const rocblas_stride strideP,
+                                       U B,
+                                       const rocblas_int shiftB,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count,
+                                       T* scalars,
+                                       rocblas_index_value_t<S>* work,
+                                       void* work1,
+                                       void* work2,
+                                       void* work3,
+                                       void* work4,
+                                       T* pivotval,
+                                       rocblas_int* pivotidx,
+                                       rocblas_int* iinfo,
+                                       bool optim_mem)
+{
+    rocsolver_stage stage(handle, "gesv");
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // info=0 (starting with a nonsingular matrix)
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocksReset, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream,
+                            info, batch_count, 0);
+
+    // quick return if no dimensions
+    if(n == 0)
+        return rocblas_status_success;
+
+#ifdef OPTIMAL
+    // factorize and solve small systems in a single kernel
+    if(n <= WAVESIZE)
+        return gesv_small<T>(handle, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB,
+                             ldb, strideB, info, batch_count);
+#endif
+
+    // compute LU factorization of A
+    rocsolver_getrf_template<BATCHED, STRIDED, T>(handle, n, n, A, shiftA, lda, strideA, ipiv, 0,
+                                                  strideP, info, batch_count, 1, scalars, work,
+                                                  work1, work2, work3, work4, pivotval, pivotidx,
+                                                  iinfo, optim_mem);
+
+    if(nrhs == 0)
+        return rocblas_status_success;
+
+    // (as in LAPACK, and as in the fused kernel, the solution is not computed
+    // if A is singular: the right-hand sides of the singular instances are
+    // restored after solving all the systems)
+    rocblas_int blocks_n = (n - 1) / BS + 1;
+    rocblas_int blocks_nrhs = (nrhs - 1) / BS + 1;
+    dim3 grid(blocks_n, blocks_nrhs, batch_count);
+    dim3 threads(BS, BS, 1);
+    ROCSOLVER_LAUNCH_KERNEL(gesv_copy_singular<T>, grid, threads, 0, stream, true, n, nrhs, B,
+                            shiftB, ldb, strideB, (T*)work, info);
+
+    // solve the system with the factors
+    rocsolver_getrs_template<BATCHED, T>(handle, rocblas_operation_none, n, nrhs, A, shiftA, lda,
+                                         strideA, ipiv, strideP, B, shiftB, ldb, strideB,
+                                         batch_count, work1, work2, work3, work4, optim_mem);
+
+    ROCSOLVER_LAUNCH_KERNEL(gesv_copy_singular<T>, grid, threads, 0, stream, false, n, nrhs, B,
+                            shiftB, ldb, strideB, (T*)work, info);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GESV_HPP */
@@ -0,0 +1,158 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesv.hpp"
+#include "logging.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gesv_batched_impl(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           U A,
+                                           const rocblas_int lda,
+                                           rocblas_int* ipiv,
+                                           const rocblas_stride strideP,
+                                           U B,
+                                           const rocblas_int ldb,
+                                           rocblas_int* info,
+                                           const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_log<T>(handle, "gesv_batched", "-m", n, "-n", nrhs, "A", A, "--lda", lda, "ipiv",
+                     ipiv, "--bsp", strideP, "B", B, "--ldb", ldb, "info", info, "--batch",
+                     batch_count);
+
+    // argument checking
+    rocblas_status st = rocsolver_gesv_argCheck(n, nrhs, lda, ldb, A, B, ipiv, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+
+    // memory workspace sizes:
+    // size of reusable workspace (and for calling TRSM)
+    size_t size_work, size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size to store info about singularity of each subblock
+    size_t size_iinfo;
+    rocsolver_gesv_getMemorySize<true, false, T, S>(
+        n, nrhs, batch_count, &size_work, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivotval, &size_pivotidx, &size_iinfo);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivotval,
+                                                      size_pivotidx, size_iinfo);
+
+    // always allocate all required memory for TRSM optimal performance
+    bool optim_mem = true;
+
+    // memory workspace allocation
+    void *work, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo;
+    rocblas_device_malloc mem(handle, size_work, size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_iinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    iinfo = mem[7];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
+
+    // execution
+    return rocsolver_gesv_template<true, false, T, S>(
+        handle, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, info,
+        batch_count, scalars, (rocblas_index_value_t<S>*)work, work1, work2, work3, work4,
+        (T*)pivotval, (rocblas_int*)pivotidx, (rocblas_int*)iinfo, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_sgesv_batched(rocblas_handle handle,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  float* const A[],
+                                                  const rocblas_int lda,
+                                                  rocblas_int* ipiv,
+                                                  const rocblas_stride strideP,
+                                                  float* const B[],
+                                                  const rocblas_int ldb,
+                                                  rocblas_int* info,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver_gesv_batched_impl<float>(handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, info,
+                                              batch_count);
+}
+
+extern "C" rocblas_status rocsolver_dgesv_batched(rocblas_handle handle,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  double* const A[],
+                                                  const rocblas_int lda,
+                                                  rocblas_int* ipiv,
+                                                  const rocblas_stride strideP,
+                                                  double* const B[],
+                                                  const rocblas_int ldb,
+                                                  rocblas_int* info,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver_gesv_batched_impl<double>(handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, info,
+                                               batch_count);
+}
+
+extern "C" rocblas_status rocsolver_cgesv_batched(rocblas_handle handle,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  rocblas_float_complex* const A[],
+                                                  const rocblas_int lda,
+                                                  rocblas_int* ipiv,
+                                                  const rocblas_stride strideP,
+                                                  rocblas_float_complex* const B[],
+                                                  const rocblas_int ldb,
+                                                  rocblas_int* info,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver_gesv_batched_impl<rocblas_float_complex>(handle, n, nrhs, A, lda, ipiv,
+                                                              strideP, B, ldb, info, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_zgesv_batched(rocblas_handle handle,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  rocblas_double_complex* const A[],
+                                                  const rocblas_int lda,
+                                                  rocblas_int* ipiv,
+                                                  const rocblas_stride strideP,
+                                                  rocblas_double_complex* const B[],
+                                                  const rocblas_int ldb,
+                                                  rocblas_int* info,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver_gesv_batched_impl<rocblas_double_complex>(handle, n, nrhs, A, lda, ipiv,
+                                                               strideP, B, ldb, info, batch_count);
+}
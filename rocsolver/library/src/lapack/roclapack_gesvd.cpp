@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_gesvd.hpp"
+#include "logging.hpp"
 
 template <typename T, typename TT, typename W>
 rocblas_status rocsolver_gesvd_impl(rocblas_handle handle,
@@ -24,7 +25,9 @@ rocblas_status rocsolver_gesvd_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "gesvd", "--leftsv", left_svect, "--rightsv", right_svect, "-m", m,
+                     "-n", n, "A", A, "--lda", lda, "S", S, "U", U, "--ldb", ldu, "V", V,
+                     "--ldv", ldv, "E", E, "--workmode", fast_alg, "info", info);
 
     // argument checking
     rocblas_status st = rocsolver_gesvd_argCheck(left_svect, right_svect, m, n, A, lda, S, U, ldu,
@@ -44,8 +47,6 @@ rocblas_status rocsolver_gesvd_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of reusable workspace and array of pointers (batched case)
     size_t size_work_workArr;
     // size of array of pointers (only for batched case)
@@ -54,38 +55,43 @@ rocblas_status rocsolver_gesvd_impl(rocblas_handle handle,
     size_t size_Abyx_norms_tmptr, size_X_trfact, size_Y;
     //size of array tau to store householder scalars
     size_t size_tau;
-    rocsolver_gesvd_getMemorySize<false, T, TT>(
-        left_svect, right_svect, m, n, batch_count, &size_scalars, &size_work_workArr,
-        &size_Abyx_norms_tmptr, &size_X_trfact, &size_Y, &size_tau, &size_workArr);
+    // extra requirements for the fast thin-SVD algorithm
+    size_t size_work_fast;
+    rocsolver_gesvd_getMemorySize<false, T, TT>(left_svect, right_svect, m, n, fast_alg,
+                                                batch_count, &size_work_workArr,
+                                                &size_Abyx_norms_tmptr, &size_X_trfact, &size_Y,
+                                                &size_tau, &size_work_fast, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+        return rocblas_set_optimal_device_memory_size(handle, size_work_workArr,
                                                       size_Abyx_norms_tmptr, size_X_trfact, size_Y,
-                                                      size_tau, size_workArr);
+                                                      size_tau, size_work_fast, size_workArr);
 
     // memory workspace allocation
-    void *scalars, *work_workArr, *Abyx_norms_tmptr, *X_trfact, *Y, *tau, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_tmptr,
-                              size_X_trfact, size_Y, size_tau, size_workArr);
+    void *work_workArr, *Abyx_norms_tmptr, *X_trfact, *Y, *tau, *work_fast, *workArr;
+    rocblas_device_malloc mem(handle, size_work_workArr, size_Abyx_norms_tmptr, size_X_trfact,
+                              size_Y, size_tau, size_work_fast, size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work_workArr = mem[1];
-    Abyx_norms_tmptr = mem[2];
-    X_trfact = mem[3];
-    Y = mem[4];
-    tau = mem[5];
+    work_workArr = mem[0];
+    Abyx_norms_tmptr = mem[1];
+    X_trfact = mem[2];
+    Y = mem[3];
+    tau = mem[4];
+    work_fast = mem[5];
     workArr = mem[6];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_gesvd_template<false, false, T>(
         handle, left_svect, right_svect, m, n, A, shiftA, lda, strideA, S, strideS, U, ldu, strideU,
-        V, ldv, strideV, E, strideE, fast_alg, info, batch_count, (T*)scalars, work_workArr,
-        (T*)Abyx_norms_tmptr, (T*)X_trfact, (T*)Y, (T*)tau, (T**)workArr);
+        V, ldv, strideV, E, strideE, fast_alg, info, batch_count, scalars, work_workArr,
+        (T*)Abyx_norms_tmptr, (T*)X_trfact, (T*)Y, (T*)tau, (T*)work_fast, (T**)workArr);
 }
 
 /*
@@ -10,25 +10,31 @@
 #ifndef ROCLAPACK_GESVD_H
 #define ROCLAPACK_GESVD_H
 
+#include "../auxiliary/rocauxiliary_bdsdc.hpp"
 #include "../auxiliary/rocauxiliary_bdsqr.hpp"
 #include "../auxiliary/rocauxiliary_orgbr_ungbr.hpp"
+#include "../auxiliary/rocauxiliary_ormbr_unmbr.hpp"
 #include "common_device.hpp"
 #include "rocblas.hpp"
 #include "roclapack_gebrd.hpp"
+#include "roclapack_gelqf.hpp"
+#include "roclapack_geqrf.hpp"
 #include "rocsolver.h"
 
-/** COPY_ARRAY copies the m-by-n array A into B **/
+/** COPY_TRIANGULAR copies the upper or lower triangular part of the n-by-n
+    array A into B, and sets the rest of B to zero. A and B could be the same
+    array, in which case the opposite triangular part of A is zeroed out **/
 template <typename T, typename U1, typename U2>
-__global__ void copy_array(const rocblas_int m,
-                           const rocblas_int n,
-                           U1 A,
-                           const rocblas_int shiftA,
-                           const rocblas_int lda,
-                           const rocblas_stride strideA,
-                           U2 B,
-                           const rocblas_int shiftB,
-                           const rocblas_int ldb,
-                           const rocblas_stride strideB)
+__global__ void copy_triangular(const rocblas_fill uplo,
+                                const rocblas_int n,
+                                U1 A,
+                                const rocblas_int shiftA,
+                                const rocblas_int lda,
+                                const rocblas_stride strideA,
+                                U2 B,
+                                const rocblas_int shiftB,
+                                const rocblas_int ldb,
+                                const rocblas_stride strideB)
 {
     const auto blocksizex = hipBlockDim_x;
     const auto blocksizey = hipBlockDim_y;
@@ -36,17 +42,32 @@ __global__ void copy_array(const rocblas_int m,
     const auto i = hipBlockIdx_x * blocksizex + hipThreadIdx_x;
     const auto j = hipBlockIdx_y * blocksizey + hipThreadIdx_y;
 
-    if(i < m && j < n)
+    if(i < n && j < n)
     {
         T *Ap, *Bp;
         Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
         Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
 
-        Bp[i + j * ldb] = Ap[i + j * lda];
+        if((uplo == rocblas_fill_upper && i <= j) || (uplo == rocblas_fill_lower && i >= j))
+            Bp[i + j * ldb] = Ap[i + j * lda];
+        else
+            Bp[i + j * ldb] = 0;
     }
 }
 
-/** wrapper to BDSQR_TEMPLATE **/
+/** GESVD_USE_BDSDC determines if the singular vectors of the n-by-n bidiagonal
+    form are computed with BDSDC instead of BDSQR (only when enabled by tuning) **/
+template <typename T>
+inline bool gesvd_use_bdsdc(const rocblas_int n, const rocblas_int nv, const rocblas_int nu)
+{
+    if(!nv && !nu)
+        return false;
+
+    rocblas_int bdsdc = rocsolver_get_tuning<T>(rocsolver_tuning_gesvd_bdsdc_switchsize, n);
+    return bdsdc > 0 && n >= bdsdc;
+}
+
+/** wrapper to BDSQR_TEMPLATE (or BDSDC_TEMPLATE) **/
 template <typename T, typename TT>
 void local_bdsqr_template(rocblas_handle handle,
                           const rocblas_fill uplo,
@@ -68,15 +89,22 @@ void local_bdsqr_template(rocblas_handle handle,
                           const rocblas_stride strideU,
                           rocblas_int* info,
                           const rocblas_int batch_count,
+                          T* scalars,
                           TT* work,
                           T** workArr)
 {
-    rocsolver_bdsqr_template<T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE, V, shiftV, ldv,
-                                strideV, U, shiftU, ldu, strideU, (T*)nullptr, 0, 1, 1, info,
-                                batch_count, work);
+    if(gesvd_use_bdsdc<T>(n, nv, nu))
+        rocsolver_bdsdc_template<false, T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE, V,
+                                           shiftV, ldv, strideV, U, shiftU, ldu, strideU,
+                                           (T*)nullptr, 0, 1, 1, info, batch_count, scalars, work,
+                                           workArr);
+    else
+        rocsolver_bdsqr_template<T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE, V, shiftV,
+                                    ldv, strideV, U, shiftU, ldu, strideU, (T*)nullptr, 0, 1, 1,
+                                    info, batch_count, work);
 }
 
-/** wrapper to BDSQR_TEMPLATE
+/** wrapper to BDSQR_TEMPLATE (or BDSDC_TEMPLATE)
     adapts U and V to be of the same type **/
 template <typename T, typename TT>
 void local_bdsqr_template(rocblas_handle handle,
@@ -99,6 +127,7 @@ void local_bdsqr_template(rocblas_handle handle,
                           const rocblas_stride strideU,
                           rocblas_int* info,
                           const rocblas_int batch_count,
+                          T* scalars,
                           TT* work,
                           T** workArr)
 {
@@ -106,15 +135,21 @@ void local_bdsqr_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, U, strideU,
-                       batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, U, strideU,
+                            batch_count);
 
-    rocsolver_bdsqr_template<T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE, V, shiftV, ldv,
-                                strideV, (T* const*)workArr, shiftU, ldu, strideU,
-                                (T* const*)nullptr, 0, 1, 1, info, batch_count, work);
+    if(gesvd_use_bdsdc<T>(n, nv, nu))
+        rocsolver_bdsdc_template<true, T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE, V,
+                                          shiftV, ldv, strideV, (T* const*)workArr, shiftU, ldu,
+                                          strideU, (T* const*)nullptr, 0, 1, 1, info, batch_count,
+                                          scalars, work, (workArr + batch_count));
+    else
+        rocsolver_bdsqr_template<T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE, V, shiftV,
+                                    ldv, strideV, (T* const*)workArr, shiftU, ldu, strideU,
+                                    (T* const*)nullptr, 0, 1, 1, info, batch_count, work);
 }
 
-/** wrapper to BDSQR_TEMPLATE
+/** wrapper to BDSQR_TEMPLATE (or BDSDC_TEMPLATE)
     adapts U and V to be of the same type **/
 template <typename T, typename TT>
 void local_bdsqr_template(rocblas_handle handle,
@@ -137,6 +172,7 @@ void local_bdsqr_template(rocblas_handle handle,
                           const rocblas_stride strideU,
                           rocblas_int* info,
                           const rocblas_int batch_count,
+                          T* scalars,
                           TT* work,
                           T** workArr)
 {
@@ -144,12 +180,129 @@ void local_bdsqr_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    hipLaunchKernelGGL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, V, strideV,
-                       batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, V, strideV,
+                            batch_count);
+
+    if(gesvd_use_bdsdc<T>(n, nv, nu))
+        rocsolver_bdsdc_template<true, T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE,
+                                          (T* const*)workArr, shiftV, ldv, strideV, U, shiftU, ldu,
+                                          strideU, (T* const*)nullptr, 0, 1, 1, info, batch_count,
+                                          scalars, work, (workArr + batch_count));
+    else
+        rocsolver_bdsqr_template<T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE,
+                                    (T* const*)workArr, shiftV, ldv, strideV, U, shiftU, ldu,
+                                    strideU, (T* const*)nullptr, 0, 1, 1, info, batch_count, work);
+}
 
-    rocsolver_bdsqr_template<T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE,
-                                (T* const*)workArr, shiftV, ldv, strideV, U, shiftU, ldu, strideU,
-                                (T* const*)nullptr, 0, 1, 1, info, batch_count, work);
+/** wrapper to ORMBR_UNMBR_TEMPLATE **/
+template <bool STRIDED, typename T>
+void local_ormbr_template(rocblas_handle handle,
+                          const rocblas_storev storev,
+                          const rocblas_side side,
+                          const rocblas_operation trans,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          const rocblas_int k,
+                          T* A,
+                          const rocblas_int shiftA,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          T* ipiv,
+                          const rocblas_stride strideP,
+                          T* C,
+                          const rocblas_int shiftC,
+                          const rocblas_int ldc,
+                          const rocblas_stride strideC,
+                          const rocblas_int batch_count,
+                          T* scalars,
+                          T* AbyxORwork,
+                          T* diagORtmptr,
+                          T* trfact,
+                          T** workArr)
+{
+    rocsolver_ormbr_unmbr_template<false, STRIDED>(
+        handle, storev, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC,
+        ldc, strideC, batch_count, scalars, AbyxORwork, diagORtmptr, trfact, workArr);
+}
+
+/** wrapper to ORMBR_UNMBR_TEMPLATE
+    adapts A and C to be of the same type **/
+template <bool STRIDED, typename T>
+void local_ormbr_template(rocblas_handle handle,
+                          const rocblas_storev storev,
+                          const rocblas_side side,
+                          const rocblas_operation trans,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          const rocblas_int k,
+                          T* const A[],
+                          const rocblas_int shiftA,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          T* ipiv,
+                          const rocblas_stride strideP,
+                          T* C,
+                          const rocblas_int shiftC,
+                          const rocblas_int ldc,
+                          const rocblas_stride strideC,
+                          const rocblas_int batch_count,
+                          T* scalars,
+                          T* AbyxORwork,
+                          T* diagORtmptr,
+                          T* trfact,
+                          T** workArr)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, C, strideC,
+                            batch_count);
+
+    rocsolver_ormbr_unmbr_template<true, STRIDED>(
+        handle, storev, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP,
+        (T* const*)workArr, shiftC, ldc, strideC, batch_count, scalars, AbyxORwork, diagORtmptr,
+        trfact, workArr + batch_count);
+}
+
+/** wrapper to ORMBR_UNMBR_TEMPLATE
+    adapts A and C to be of the same type **/
+template <bool STRIDED, typename T>
+void local_ormbr_template(rocblas_handle handle,
+                          const rocblas_storev storev,
+                          const rocblas_side side,
+                          const rocblas_operation trans,
+                          const rocblas_int m,
+                          const rocblas_int n,
+                          const rocblas_int k,
+                          T* A,
+                          const rocblas_int shiftA,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          T* ipiv,
+                          const rocblas_stride strideP,
+                          T* const C[],
+                          const rocblas_int shiftC,
+                          const rocblas_int ldc,
+                          const rocblas_stride strideC,
+                          const rocblas_int batch_count,
+                          T* scalars,
+                          T* AbyxORwork,
+                          T* diagORtmptr,
+                          T* trfact,
+                          T** workArr)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, A, strideA,
+                            batch_count);
+
+    rocsolver_ormbr_unmbr_template<true, STRIDED>(
+        handle, storev, side, trans, m, n, k, (T* const*)workArr, shiftA, lda, strideA, ipiv,
+        strideP, C, shiftC, ldc, strideC, batch_count, scalars, AbyxORwork, diagORtmptr, trfact,
+        workArr + batch_count);
 }
 
 /** Argument checking **/
@@ -206,24 +359,25 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
                                    const rocblas_svect right_svect,
                                    const rocblas_int m,
                                    const rocblas_int n,
+                                   const rocblas_workmode fast_alg,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work_workArr,
                                    size_t* size_Abyx_norms_tmptr,
                                    size_t* size_X_trfact,
                                    size_t* size_Y,
                                    size_t* size_tau,
+                                   size_t* size_work_fast,
                                    size_t* size_workArr)
 {
     // if quick return, set workspace to zero
     if(n == 0 || m == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work_workArr = 0;
         *size_Abyx_norms_tmptr = 0;
         *size_X_trfact = 0;
         *size_Y = 0;
         *size_tau = 0;
+        *size_work_fast = 0;
         *size_workArr = 0;
         return;
     }
@@ -238,64 +392,195 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
     const bool rightvA = (right_svect == rocblas_svect_all);
     const bool rightvN = (right_svect == rocblas_svect_none);
 
-    size_t w, s, t, unused;
+    size_t w, s, t, a;
     rocblas_int k = min(m, n);
     rocblas_int nu = leftvN ? 0 : m;
     rocblas_int nv = rightvN ? 0 : n;
 
+    // the fast thin SVD is used (if requested) when the singular vectors
+    // of the larger dimension are required
+    const bool thinSVD = (m >= THIN_SVD_SWITCH * n || n >= THIN_SVD_SWITCH * m);
+    const bool fast_thinSVD = thinSVD && fast_alg == rocblas_outofplace
+        && (m >= n ? !leftvN : !rightvN);
+
+    // the in-place thin SVD keeps the triangular factor in U or V when A is overwritten
+    // with the singular vectors; if U or V are not referenced, the normal SVD is used
+    const bool inplace_thinSVD
+        = thinSVD && !fast_thinSVD && !(m >= n ? leftvO && rightvN : rightvO && leftvN);
+
     // size of array of pointers to workspace
     if(BATCHED)
         *size_workArr = sizeof(T*) * batch_count;
     else
         *size_workArr = 0;
 
-    // workspace required for the bidiagonalization
-    rocsolver_gebrd_getMemorySize<T, BATCHED>(m, n, batch_count, size_scalars, size_work_workArr,
-                                              size_Abyx_norms_tmptr, size_X_trfact, size_Y);
+    *size_work_fast = 0;
 
-    // worksapce required for the SVD of the bidiagonal form
-    rocsolver_bdsqr_getMemorySize<S>(k, nv, nu, 0, batch_count, &w);
-    if(w > *size_work_workArr)
-        *size_work_workArr = w;
-
-    // workspace required to compute the left singular vectors
-    if(!leftvN)
+    if(fast_thinSVD || inplace_thinSVD)
     {
-        if(m >= n && (leftvS || leftvO))
-            k = n;
+        // workspace required for the QR (or LQ) factorization
+        if(m >= n)
+            rocsolver_geqrf_getMemorySize<T, BATCHED>(m, n, batch_count, &w, &s, &t, &a);
         else
-            k = m;
-        rocsolver_orgbr_ungbr_getMemorySize<T, BATCHED>(rocblas_column_wise, m, k, n, batch_count,
-                                                        &unused, &w, &s, &t, &unused);
-        if(w > *size_work_workArr)
-            *size_work_workArr = w;
-        if(s > *size_Abyx_norms_tmptr)
-            *size_Abyx_norms_tmptr = s;
-        if(t > *size_X_trfact)
-            *size_X_trfact = t;
+            rocsolver_gelqf_getMemorySize<T, BATCHED>(m, n, batch_count, &w, &s, &t, &a);
+        *size_work_workArr = w;
+        *size_Abyx_norms_tmptr = s;
+        *size_X_trfact = t;
+        *size_workArr = max(*size_workArr, a);
+
+        // workspace required for the bidiagonalization of the triangular factor
+        rocsolver_gebrd_getMemorySize<T, BATCHED>(k, k, batch_count, &w, &s, &t, size_Y);
+        *size_work_workArr = max(*size_work_workArr, w);
+        *size_Abyx_norms_tmptr = max(*size_Abyx_norms_tmptr, s);
+        *size_X_trfact = max(*size_X_trfact, t);
+
+        // workspace required to generate the orthonormal/unitary matrix of the
+        // QR (or LQ) factorization, and to update it with the bidiagonalization.
+        // (ormbr may also need an array of pointers to U or V in the batched case)
+        if(m >= n && !leftvN)
+        {
+            rocsolver_orgqr_ungqr_getMemorySize<T, BATCHED>(m, leftvA ? m : n, n, batch_count, &w,
+                                                            &s, &t, &a);
+            *size_work_workArr = max(*size_work_workArr, w);
+            *size_Abyx_norms_tmptr = max(*size_Abyx_norms_tmptr, s);
+            *size_X_trfact = max(*size_X_trfact, t);
+            *size_workArr = max(*size_workArr, a);
+        }
+        if(m >= n && !leftvN && inplace_thinSVD)
+        {
+            rocsolver_ormbr_unmbr_getMemorySize<T, BATCHED>(
+                rocblas_column_wise, rocblas_side_right, m, n, n, batch_count, &w, &s, &t, &a);
+            if(BATCHED)
+                a += sizeof(T*) * batch_count;
+            *size_work_workArr = max(*size_work_workArr, w);
+            *size_Abyx_norms_tmptr = max(*size_Abyx_norms_tmptr, s);
+            *size_X_trfact = max(*size_X_trfact, t);
+            *size_workArr = max(*size_workArr, a);
+        }
+        if(n > m && !rightvN)
+        {
+            rocsolver_orglq_unglq_getMemorySize<T, BATCHED>(rightvA ? n : m, n, m, batch_count, &w,
+                                                            &s, &t, &a);
+            *size_work_workArr = max(*size_work_workArr, w);
+            *size_Abyx_norms_tmptr = max(*size_Abyx_norms_tmptr, s);
+            *size_X_trfact = max(*size_X_trfact, t);
+            *size_workArr = max(*size_workArr, a);
+        }
+        if(n > m && !rightvN && inplace_thinSVD)
+        {
+            rocsolver_ormbr_unmbr_getMemorySize<T, BATCHED>(rocblas_row_wise, rocblas_side_left, m,
+                                                            n, m, batch_count, &w, &s, &t, &a);
+            if(BATCHED)
+                a += sizeof(T*) * batch_count;
+            *size_work_workArr = max(*size_work_workArr, w);
+            *size_Abyx_norms_tmptr = max(*size_Abyx_norms_tmptr, s);
+            *size_X_trfact = max(*size_X_trfact, t);
+            *size_workArr = max(*size_workArr, a);
+        }
+
+        // workspace required to compute the remaining singular vectors
+        // from the bidiagonal form of the triangular factor
+        if((m >= n && !rightvN) || (n > m && !leftvN))
+        {
+            rocsolver_orgbr_ungbr_getMemorySize<T, BATCHED>(
+                m >= n ? rocblas_row_wise : rocblas_column_wise, k, k, k, batch_count, &w, &s, &t,
+                &a);
+            *size_work_workArr = max(*size_work_workArr, w);
+            *size_Abyx_norms_tmptr = max(*size_Abyx_norms_tmptr, s);
+            *size_X_trfact = max(*size_X_trfact, t);
+            *size_workArr = max(*size_workArr, a);
+        }
+
+        if(fast_thinSVD)
+        {
+            // workspace required to compute the singular vectors of the triangular factor
+            rocsolver_orgbr_ungbr_getMemorySize<T, BATCHED>(
+                m >= n ? rocblas_column_wise : rocblas_row_wise, k, k, k, batch_count, &w, &s, &t,
+                &a);
+            *size_work_workArr = max(*size_work_workArr, w);
+            *size_Abyx_norms_tmptr = max(*size_Abyx_norms_tmptr, s);
+            *size_X_trfact = max(*size_X_trfact, t);
+            *size_workArr = max(*size_workArr, a);
+
+            // size of the arrays of pointers required by the final GEMM
+            if(BATCHED)
+                *size_workArr = max(*size_workArr, 2 * sizeof(T*) * batch_count);
+
+            // size of the copy of the triangular factor, of the singular vectors
+            // of the shorter dimension when A is overwritten, and of the result
+            // of the final GEMM when A (or all the vectors) are overwritten
+            *size_work_fast = k * k;
+            if(m >= n ? rightvO : leftvO)
+                *size_work_fast += k * k;
+            if(m >= n ? leftvO || leftvA : rightvO || rightvA)
+                *size_work_fast += m * n;
+            *size_work_fast *= sizeof(T) * batch_count;
+        }
     }
 
-    // workspace required to compute the right singular vectors
-    if(!rightvN)
+    else
     {
-        if(n > m && (rightvS || rightvO))
-            k = m;
-        else
-            k = n;
-        rocsolver_orgbr_ungbr_getMemorySize<T, BATCHED>(rocblas_row_wise, k, n, m, batch_count,
-                                                        &unused, &w, &s, &t, &unused);
-
-        if(w > *size_work_workArr)
-            *size_work_workArr = w;
-        if(s > *size_Abyx_norms_tmptr)
-            *size_Abyx_norms_tmptr = s;
-        if(t > *size_X_trfact)
-            *size_X_trfact = t;
+        // workspace required for the bidiagonalization
+        rocsolver_gebrd_getMemorySize<T, BATCHED>(m, n, batch_count, size_work_workArr,
+                                                  size_Abyx_norms_tmptr, size_X_trfact, size_Y);
+
+        // workspace required to compute the left singular vectors
+        if(!leftvN)
+        {
+            if(m >= n && (leftvS || leftvO))
+                k = n;
+            else
+                k = m;
+            rocsolver_orgbr_ungbr_getMemorySize<T, BATCHED>(rocblas_column_wise, m, k, n,
+                                                            batch_count, &w, &s, &t, &a);
+            if(w > *size_work_workArr)
+                *size_work_workArr = w;
+            if(s > *size_Abyx_norms_tmptr)
+                *size_Abyx_norms_tmptr = s;
+            if(t > *size_X_trfact)
+                *size_X_trfact = t;
+            if(a > *size_workArr)
+                *size_workArr = a;
+        }
+
+        // workspace required to compute the right singular vectors
+        if(!rightvN)
+        {
+            if(n > m && (rightvS || rightvO))
+                k = m;
+            else
+                k = n;
+            rocsolver_orgbr_ungbr_getMemorySize<T, BATCHED>(rocblas_row_wise, k, n, m, batch_count,
+                                                            &w, &s, &t, &a);
+
+            if(w > *size_work_workArr)
+                *size_work_workArr = w;
+            if(s > *size_Abyx_norms_tmptr)
+                *size_Abyx_norms_tmptr = s;
+            if(t > *size_X_trfact)
+                *size_X_trfact = t;
+            if(a > *size_workArr)
+                *size_workArr = a;
+        }
     }
 
+    // worksapce required for the SVD of the bidiagonal form
+    // (none if only the singular values are required)
+    if(gesvd_use_bdsdc<T>(min(m, n), nv, nu))
+        rocsolver_bdsdc_getMemorySize<T, S>(min(m, n), nv, nu, 0, batch_count, &w);
+    else
+        rocsolver_bdsqr_getMemorySize<S>(min(m, n), nv, nu, 0, batch_count, &w);
+    if(w > *size_work_workArr)
+        *size_work_workArr = w;
+
+    // (the divide and conquer algorithm needs more pointers to U and V in the
+    // batched case)
+    if(BATCHED && gesvd_use_bdsdc<T>(min(m, n), nv, nu))
+        *size_workArr = max(*size_workArr, 3 * sizeof(T*) * batch_count);
+
     // size of array tau to store householder scalars on intermediate
-    // orthonormal/unitary matrices
-    *size_tau = 2 * sizeof(T) * min(m, n) * batch_count;
+    // orthonormal/unitary matrices (and of the QR or LQ factorization for the thin SVD)
+    *size_tau = (fast_thinSVD || inplace_thinSVD ? 3 : 2) * sizeof(T) * min(m, n) * batch_count;
 }
 
 template <bool BATCHED, bool STRIDED, typename T, typename TT, typename W>
@@ -327,8 +612,11 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
                                         T* X_trfact,
                                         T* Y,
                                         T* tau,
+                                        T* work_fast,
                                         T** workArr)
 {
+    rocsolver_stage stage(handle, "gesvd");
+
     constexpr bool COMPLEX = is_complex<T>;
 
     // quick return
@@ -347,13 +635,13 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
     const bool rightvO = (right_svect == rocblas_svect_overwrite);
     const bool rightvA = (right_svect == rocblas_svect_all);
     const bool rightvN = (right_svect == rocblas_svect_none);
-    const bool fast_thinSVD = (fast_alg == rocblas_outofplace);
 
     rocblas_int mn, nu, nv;
     rocblas_fill uplo;
     const rocblas_int k = min(m, n);
-    rocblas_stride strideX = m * GEBRD_GEBD2_SWITCHSIZE;
-    rocblas_stride strideY = n * GEBRD_GEBD2_SWITCHSIZE;
+    const rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_gebrd_switchsize, k);
+    rocblas_stride strideX = m * nb;
+    rocblas_stride strideY = n * nb;
     rocblas_int shiftX = 0;
     rocblas_int shiftY = 0;
     rocblas_int ldx = m;
@@ -365,33 +653,440 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
     const rocblas_int blocks_n = (n - 1) / thread_count + 1;
     const rocblas_int blocks_k = (k - 1) / thread_count + 1;
 
-    // A thin SVD could be computed for matrices with sufficiently more rows than
+    // A thin SVD is computed for matrices with sufficiently more rows than
     // columns (or columns that rows) by starting with a QR factorization (or LQ
-    // factorization) and working with the triangular factor afterwards. When
-    // computing a thin SVD, a fast algorithm could be executed by doing some
-    // computations out-of-place.
+    // factorization) and working with the triangular factor afterwards.
+    // When the singular vectors of the larger dimension are required, a fast
+    // algorithm can be executed by copying the triangular factor to the
+    // workspace and forming the singular vectors with a final GEMM.
+    // Otherwise, the triangular factor is kept in U (or V) when the singular
+    // vectors overwrite A, thus, if U (or V) is not referenced, the normal SVD
+    // is used instead.
+    const bool thinSVD = (m >= THIN_SVD_SWITCH * n || n >= THIN_SVD_SWITCH * m);
+    const bool fast_thinSVD = thinSVD && fast_alg == rocblas_outofplace
+        && (m >= n ? !leftvN : !rightvN);
+    const bool inplace_thinSVD
+        = thinSVD && !fast_thinSVD && !(m >= n ? leftvO && rightvN : rightvO && leftvN);
 
     // choose Thin-SVD
-    if(m >= THIN_SVD_SWITCH * n || n >= THIN_SVD_SWITCH * m)
+    if(fast_thinSVD || inplace_thinSVD)
     {
-        // (TODO: IMPLEMENT THIN_SVD AND FAST THIN_SVD ALGORITHMS)
+        // householder scalars of the QR (or LQ) factorization
+        T* tauf = tau + 2 * k * batch_count;
+        const rocblas_operation transP
+            = COMPLEX ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
 
-        // use fast thin-svd algorithm (this may require larger memory worksapce)
+        // the bidiagonalization is performed on the k-by-k triangular factor
+        strideX = k * nb;
+        strideY = k * nb;
+        ldx = k;
+        ldy = k;
+
+        // use fast thin-svd algorithm (this requires a larger memory workspace)
         if(fast_thinSVD)
         {
-            return rocblas_status_not_implemented;
+            // workspace to store the triangular factor (and later its singular
+            // vectors), the singular vectors of the shorter dimension when A is
+            // overwritten, and the result of the final GEMM
+            const rocblas_int ldr = k;
+            const rocblas_stride strideR = k * k;
+            const rocblas_stride strideT = m * n;
+            T* tmpR = work_fast;
+            T* tmpVU = tmpR + strideR * batch_count;
+            T* tmpA = (m >= n ? rightvO : leftvO) ? tmpVU + strideR * batch_count : tmpVU;
+
+            if(m >= n)
+            {
+                // 1. Compute the QR factorization of A, and copy R to the workspace.
+                rocsolver_geqrf_template<BATCHED, STRIDED>(
+                    handle, m, n, A, shiftA, lda, strideA, tauf, k, batch_count, scalars,
+                    work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+                ROCSOLVER_LAUNCH_KERNEL(copy_triangular<T>, dim3(blocks_k, blocks_k, batch_count),
+                                        dim3(thread_count, thread_count, 1), 0, stream,
+                                        rocblas_fill_upper, n, A, shiftA, lda, strideA, tmpR, 0,
+                                        ldr, strideR);
+
+                // 2. Generate Q in U (if all the vectors are required) or in A.
+                if(leftvA)
+                {
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_m, blocks_n, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, n, A,
+                                            shiftA, lda, strideA, U, 0, ldu, strideU);
+                    rocsolver_orgqr_ungqr_template<false, STRIDED>(
+                        handle, m, m, n, U, 0, ldu, strideU, tauf, k, batch_count, scalars,
+                        (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+                }
+                else
+                    rocsolver_orgqr_ungqr_template<BATCHED, STRIDED>(
+                        handle, m, n, n, A, shiftA, lda, strideA, tauf, k, batch_count, scalars,
+                        (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+
+                // 3. Bidiagonalize R.
+                rocsolver_gebrd_template<false, STRIDED>(
+                    handle, n, n, tmpR, 0, ldr, strideR, S, strideS, E, strideE, tau, k,
+                    (tau + k * batch_count), k, X_trfact, shiftX, ldx, strideX, Y, shiftY, ldy,
+                    strideY, batch_count, scalars, work_workArr, Abyx_norms_tmptr);
+
+                // 4. Generate the right singular vectors when required, and the left
+                // singular vectors of R.
+                if(rightvS || rightvA || rightvO)
+                {
+                    T* VV = rightvO ? tmpVU : V;
+                    rocblas_int ldvv = rightvO ? ldr : ldv;
+                    rocblas_stride strideVV = rightvO ? strideR : strideV;
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_k, blocks_k, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, n, n,
+                                            tmpR, 0, ldr, strideR, VV, 0, ldvv, strideVV);
+                    rocsolver_orgbr_ungbr_template<false, STRIDED>(
+                        handle, rocblas_row_wise, n, n, n, VV, 0, ldvv, strideVV,
+                        (tau + k * batch_count), k, batch_count, scalars, (T*)work_workArr,
+                        Abyx_norms_tmptr, X_trfact, workArr);
+                }
+                rocsolver_orgbr_ungbr_template<false, STRIDED>(
+                    handle, rocblas_column_wise, n, n, n, tmpR, 0, ldr, strideR, tau, k,
+                    batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+
+                // 5. Compute the singular values (and vectors) of the bidiagonal form.
+                nv = rightvN ? 0 : n;
+                if(rightvO)
+                    local_bdsqr_template<T>(handle, rocblas_fill_upper, k, nv, n, 0, S, strideS, E,
+                                            strideE, tmpVU, 0, ldr, strideR, tmpR, 0, ldr, strideR,
+                                            info, batch_count, scalars, (TT*)work_workArr, workArr);
+                else
+                    local_bdsqr_template<T>(handle, rocblas_fill_upper, k, nv, n, 0, S, strideS, E,
+                                            strideE, V, 0, ldv, strideV, tmpR, 0, ldr, strideR,
+                                            info, batch_count, scalars, (TT*)work_workArr, workArr);
+
+                // 6. Multiply Q by the left singular vectors of R.
+                rocblas_pointer_mode old_mode;
+                rocblas_get_pointer_mode(handle, &old_mode);
+                rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+
+                if(leftvS)
+                    rocblasCall_gemm<BATCHED, STRIDED, T>(
+                        handle, rocblas_operation_none, rocblas_operation_none, m, n, n,
+                        (scalars + 2), A, shiftA, lda, strideA, tmpR, 0, ldr, strideR,
+                        (scalars + 1), U, 0, ldu, strideU, batch_count, workArr);
+
+                else if(leftvO)
+                {
+                    rocblasCall_gemm<BATCHED, STRIDED, T>(
+                        handle, rocblas_operation_none, rocblas_operation_none, m, n, n,
+                        (scalars + 2), A, shiftA, lda, strideA, tmpR, 0, ldr, strideR,
+                        (scalars + 1), tmpA, 0, m, strideT, batch_count, workArr);
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_m, blocks_n, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, n,
+                                            tmpA, 0, m, strideT, A, shiftA, lda, strideA);
+                }
+
+                else
+                {
+                    rocblasCall_gemm<false, STRIDED, T>(
+                        handle, rocblas_operation_none, rocblas_operation_none, m, n, n,
+                        (scalars + 2), U, 0, ldu, strideU, tmpR, 0, ldr, strideR, (scalars + 1),
+                        tmpA, 0, m, strideT, batch_count, workArr);
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_m, blocks_n, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, n,
+                                            tmpA, 0, m, strideT, U, 0, ldu, strideU);
+                }
+
+                rocblas_set_pointer_mode(handle, old_mode);
+
+                // 7. Copy the right singular vectors to A when required.
+                if(rightvO)
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_k, blocks_k, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, n, n,
+                                            tmpVU, 0, ldr, strideR, A, shiftA, lda, strideA);
+            }
+
+            else
+            {
+                // 1. Compute the LQ factorization of A, and copy L to the workspace.
+                rocsolver_gelqf_template<BATCHED, STRIDED>(
+                    handle, m, n, A, shiftA, lda, strideA, tauf, k, batch_count, scalars,
+                    work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+                ROCSOLVER_LAUNCH_KERNEL(copy_triangular<T>, dim3(blocks_k, blocks_k, batch_count),
+                                        dim3(thread_count, thread_count, 1), 0, stream,
+                                        rocblas_fill_lower, m, A, shiftA, lda, strideA, tmpR, 0,
+                                        ldr, strideR);
+
+                // 2. Generate Q in V (if all the vectors are required) or in A.
+                if(rightvA)
+                {
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_m, blocks_n, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, n, A,
+                                            shiftA, lda, strideA, V, 0, ldv, strideV);
+                    rocsolver_orglq_unglq_template<false, STRIDED>(
+                        handle, n, n, m, V, 0, ldv, strideV, tauf, k, batch_count, scalars,
+                        (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+                }
+                else
+                    rocsolver_orglq_unglq_template<BATCHED, STRIDED>(
+                        handle, m, n, m, A, shiftA, lda, strideA, tauf, k, batch_count, scalars,
+                        (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+
+                // 3. Bidiagonalize L.
+                rocsolver_gebrd_template<false, STRIDED>(
+                    handle, m, m, tmpR, 0, ldr, strideR, S, strideS, E, strideE, tau, k,
+                    (tau + k * batch_count), k, X_trfact, shiftX, ldx, strideX, Y, shiftY, ldy,
+                    strideY, batch_count, scalars, work_workArr, Abyx_norms_tmptr);
+
+                // 4. Generate the left singular vectors when required, and the right
+                // singular vectors of L.
+                if(leftvS || leftvA || leftvO)
+                {
+                    T* UU = leftvO ? tmpVU : U;
+                    rocblas_int lduu = leftvO ? ldr : ldu;
+                    rocblas_stride strideUU = leftvO ? strideR : strideU;
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_k, blocks_k, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, m,
+                                            tmpR, 0, ldr, strideR, UU, 0, lduu, strideUU);
+                    rocsolver_orgbr_ungbr_template<false, STRIDED>(
+                        handle, rocblas_column_wise, m, m, m, UU, 0, lduu, strideUU, tau, k,
+                        batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact,
+                        workArr);
+                }
+                rocsolver_orgbr_ungbr_template<false, STRIDED>(
+                    handle, rocblas_row_wise, m, m, m, tmpR, 0, ldr, strideR,
+                    (tau + k * batch_count), k, batch_count, scalars, (T*)work_workArr,
+                    Abyx_norms_tmptr, X_trfact, workArr);
+
+                // 5. Compute the singular values (and vectors) of the bidiagonal form.
+                nu = leftvN ? 0 : m;
+                if(leftvO)
+                    local_bdsqr_template<T>(handle, rocblas_fill_upper, k, m, nu, 0, S, strideS, E,
+                                            strideE, tmpR, 0, ldr, strideR, tmpVU, 0, ldr, strideR,
+                                            info, batch_count, scalars, (TT*)work_workArr, workArr);
+                else
+                    local_bdsqr_template<T>(handle, rocblas_fill_upper, k, m, nu, 0, S, strideS, E,
+                                            strideE, tmpR, 0, ldr, strideR, U, 0, ldu, strideU,
+                                            info, batch_count, scalars, (TT*)work_workArr, workArr);
+
+                // 6. Multiply the right singular vectors of L by Q.
+                rocblas_pointer_mode old_mode;
+                rocblas_get_pointer_mode(handle, &old_mode);
+                rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+
+                if(rightvS)
+                    rocblasCall_gemm<BATCHED, STRIDED, T>(
+                        handle, rocblas_operation_none, rocblas_operation_none, m, n, m,
+                        (scalars + 2), tmpR, 0, ldr, strideR, A, shiftA, lda, strideA,
+                        (scalars + 1), V, 0, ldv, strideV, batch_count, workArr);
+
+                else if(rightvO)
+                {
+                    rocblasCall_gemm<BATCHED, STRIDED, T>(
+                        handle, rocblas_operation_none, rocblas_operation_none, m, n, m,
+                        (scalars + 2), tmpR, 0, ldr, strideR, A, shiftA, lda, strideA,
+                        (scalars + 1), tmpA, 0, m, strideT, batch_count, workArr);
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_m, blocks_n, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, n,
+                                            tmpA, 0, m, strideT, A, shiftA, lda, strideA);
+                }
+
+                else
+                {
+                    rocblasCall_gemm<false, STRIDED, T>(
+                        handle, rocblas_operation_none, rocblas_operation_none, m, n, m,
+                        (scalars + 2), tmpR, 0, ldr, strideR, V, 0, ldv, strideV, (scalars + 1),
+                        tmpA, 0, m, strideT, batch_count, workArr);
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_m, blocks_n, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, n,
+                                            tmpA, 0, m, strideT, V, 0, ldv, strideV);
+                }
+
+                rocblas_set_pointer_mode(handle, old_mode);
+
+                // 7. Copy the left singular vectors to A when required.
+                if(leftvO)
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_k, blocks_k, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, m,
+                                            tmpVU, 0, ldr, strideR, A, shiftA, lda, strideA);
+            }
+
+            return rocblas_status_success;
         }
 
         // use normal thin-svd
+        if(m >= n)
+        {
+            // 1. Compute the QR factorization of A.
+            rocsolver_geqrf_template<BATCHED, STRIDED>(handle, m, n, A, shiftA, lda, strideA, tauf,
+                                                       k, batch_count, scalars, work_workArr,
+                                                       Abyx_norms_tmptr, X_trfact, workArr);
+
+            if(leftvO)
+            {
+                // 2. Copy R to V and generate Q in A.
+                ROCSOLVER_LAUNCH_KERNEL(copy_triangular<T>, dim3(blocks_n, blocks_n, batch_count),
+                                        dim3(thread_count, thread_count, 1), 0, stream,
+                                        rocblas_fill_upper, n, A, shiftA, lda, strideA, V, 0, ldv,
+                                        strideV);
+                rocsolver_orgqr_ungqr_template<BATCHED, STRIDED>(
+                    handle, m, n, n, A, shiftA, lda, strideA, tauf, k, batch_count, scalars,
+                    (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+
+                // 3. Bidiagonalize R.
+                rocsolver_gebrd_template<false, STRIDED>(
+                    handle, n, n, V, 0, ldv, strideV, S, strideS, E, strideE, tau, k,
+                    (tau + k * batch_count), k, X_trfact, shiftX, ldx, strideX, Y, shiftY, ldy,
+                    strideY, batch_count, scalars, work_workArr, Abyx_norms_tmptr);
+
+                // 4. Apply the left bidiagonal reflectors to Q, and generate the
+                // right singular vectors in V.
+                local_ormbr_template<STRIDED>(
+                    handle, rocblas_column_wise, rocblas_side_right, rocblas_operation_none, m, n,
+                    n, V, 0, ldv, strideV, tau, k, A, shiftA, lda, strideA, batch_count, scalars,
+                    (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+                rocsolver_orgbr_ungbr_template<false, STRIDED>(
+                    handle, rocblas_row_wise, n, n, n, V, 0, ldv, strideV, (tau + k * batch_count),
+                    k, batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+            }
+
+            else
+            {
+                // 2. Generate Q in U when required.
+                if(leftvS || leftvA)
+                {
+                    mn = leftvA ? m : n;
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_m, blocks_n, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, n, A,
+                                            shiftA, lda, strideA, U, 0, ldu, strideU);
+                    rocsolver_orgqr_ungqr_template<false, STRIDED>(
+                        handle, m, mn, n, U, 0, ldu, strideU, tauf, k, batch_count, scalars,
+                        (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+                }
+
+                // 3. Bidiagonalize R.
+                ROCSOLVER_LAUNCH_KERNEL(copy_triangular<T>, dim3(blocks_n, blocks_n, batch_count),
+                                        dim3(thread_count, thread_count, 1), 0, stream,
+                                        rocblas_fill_upper, n, A, shiftA, lda, strideA, A, shiftA,
+                                        lda, strideA);
+                rocsolver_gebrd_template<BATCHED, STRIDED>(
+                    handle, n, n, A, shiftA, lda, strideA, S, strideS, E, strideE, tau, k,
+                    (tau + k * batch_count), k, X_trfact, shiftX, ldx, strideX, Y, shiftY, ldy,
+                    strideY, batch_count, scalars, work_workArr, Abyx_norms_tmptr);
+
+                // 4. Apply the left bidiagonal reflectors to Q, and generate the
+                // right singular vectors when required.
+                if(leftvS || leftvA)
+                    local_ormbr_template<STRIDED>(
+                        handle, rocblas_column_wise, rocblas_side_right, rocblas_operation_none, m,
+                        n, n, A, shiftA, lda, strideA, tau, k, U, 0, ldu, strideU, batch_count,
+                        scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+
+                if(rightvS || rightvA)
+                {
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_n, blocks_n, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, n, n, A,
+                                            shiftA, lda, strideA, V, 0, ldv, strideV);
+                    rocsolver_orgbr_ungbr_template<false, STRIDED>(
+                        handle, rocblas_row_wise, n, n, n, V, 0, ldv, strideV,
+                        (tau + k * batch_count), k, batch_count, scalars, (T*)work_workArr,
+                        Abyx_norms_tmptr, X_trfact, workArr);
+                }
+
+                if(rightvO)
+                    rocsolver_orgbr_ungbr_template<BATCHED, STRIDED>(
+                        handle, rocblas_row_wise, n, n, n, A, shiftA, lda, strideA,
+                        (tau + k * batch_count), k, batch_count, scalars, (T*)work_workArr,
+                        Abyx_norms_tmptr, X_trfact, workArr);
+            }
+        }
+
         else
-        { //(!fast_thinSVD)
-            return rocblas_status_not_implemented;
+        {
+            // 1. Compute the LQ factorization of A.
+            rocsolver_gelqf_template<BATCHED, STRIDED>(handle, m, n, A, shiftA, lda, strideA, tauf,
+                                                       k, batch_count, scalars, work_workArr,
+                                                       Abyx_norms_tmptr, X_trfact, workArr);
+
+            if(rightvO)
+            {
+                // 2. Copy L to U and generate Q in A.
+                ROCSOLVER_LAUNCH_KERNEL(copy_triangular<T>, dim3(blocks_m, blocks_m, batch_count),
+                                        dim3(thread_count, thread_count, 1), 0, stream,
+                                        rocblas_fill_lower, m, A, shiftA, lda, strideA, U, 0, ldu,
+                                        strideU);
+                rocsolver_orglq_unglq_template<BATCHED, STRIDED>(
+                    handle, m, n, m, A, shiftA, lda, strideA, tauf, k, batch_count, scalars,
+                    (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+
+                // 3. Bidiagonalize L.
+                rocsolver_gebrd_template<false, STRIDED>(
+                    handle, m, m, U, 0, ldu, strideU, S, strideS, E, strideE, tau, k,
+                    (tau + k * batch_count), k, X_trfact, shiftX, ldx, strideX, Y, shiftY, ldy,
+                    strideY, batch_count, scalars, work_workArr, Abyx_norms_tmptr);
+
+                // 4. Apply the right bidiagonal reflectors to Q, and generate the
+                // left singular vectors in U.
+                local_ormbr_template<STRIDED>(
+                    handle, rocblas_row_wise, rocblas_side_left, transP, m, n, m, U, 0, ldu,
+                    strideU, (tau + k * batch_count), k, A, shiftA, lda, strideA, batch_count,
+                    scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+                rocsolver_orgbr_ungbr_template<false, STRIDED>(
+                    handle, rocblas_column_wise, m, m, m, U, 0, ldu, strideU, tau, k, batch_count,
+                    scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+            }
+
+            else
+            {
+                // 2. Generate Q in V when required.
+                if(rightvS || rightvA)
+                {
+                    mn = rightvA ? n : m;
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_m, blocks_n, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, n, A,
+                                            shiftA, lda, strideA, V, 0, ldv, strideV);
+                    rocsolver_orglq_unglq_template<false, STRIDED>(
+                        handle, mn, n, m, V, 0, ldv, strideV, tauf, k, batch_count, scalars,
+                        (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+                }
+
+                // 3. Bidiagonalize L.
+                ROCSOLVER_LAUNCH_KERNEL(copy_triangular<T>, dim3(blocks_m, blocks_m, batch_count),
+                                        dim3(thread_count, thread_count, 1), 0, stream,
+                                        rocblas_fill_lower, m, A, shiftA, lda, strideA, A, shiftA,
+                                        lda, strideA);
+                rocsolver_gebrd_template<BATCHED, STRIDED>(
+                    handle, m, m, A, shiftA, lda, strideA, S, strideS, E, strideE, tau, k,
+                    (tau + k * batch_count), k, X_trfact, shiftX, ldx, strideX, Y, shiftY, ldy,
+                    strideY, batch_count, scalars, work_workArr, Abyx_norms_tmptr);
+
+                // 4. Apply the right bidiagonal reflectors to Q, and generate the
+                // left singular vectors when required.
+                if(rightvS || rightvA)
+                    local_ormbr_template<STRIDED>(
+                        handle, rocblas_row_wise, rocblas_side_left, transP, m, n, m, A, shiftA,
+                        lda, strideA, (tau + k * batch_count), k, V, 0, ldv, strideV, batch_count,
+                        scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
+
+                if(leftvS || leftvA)
+                {
+                    ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_m, blocks_m, batch_count),
+                                            dim3(thread_count, thread_count, 1), 0, stream, m, m, A,
+                                            shiftA, lda, strideA, U, 0, ldu, strideU);
+                    rocsolver_orgbr_ungbr_template<false, STRIDED>(
+                        handle, rocblas_column_wise, m, m, m, U, 0, ldu, strideU, tau, k,
+                        batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact,
+                        workArr);
+                }
+
+                if(leftvO)
+                    rocsolver_orgbr_ungbr_template<BATCHED, STRIDED>(
+                        handle, rocblas_column_wise, m, m, m, A, shiftA, lda, strideA, tau, k,
+                        batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact,
+                        workArr);
+            }
         }
+
+        // the triangular factor is square, thus its bidiagonal form is upper
+        uplo = rocblas_fill_upper;
     }
 
     // choose normal SVD
     else
-    { // (m < THIN_SVD_SWITCH*n && n < THIN_SVD_SWITCH*m)
+    { // (!thinSVD)
 
         // 1. Bidiagonalize A.
         rocsolver_gebrd_template<BATCHED, STRIDED>(
@@ -403,9 +1098,9 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
         if(leftvS || leftvA)
         {
             mn = (m >= n && leftvS) ? n : m;
-            hipLaunchKernelGGL(copy_array<T>, dim3(blocks_m, blocks_k, batch_count),
-                               dim3(thread_count, thread_count, 1), 0, stream, m, k, A, shiftA, lda,
-                               strideA, U, 0, ldu, strideU);
+            ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_m, blocks_k, batch_count),
+                                    dim3(thread_count, thread_count, 1), 0, stream, m, k, A, shiftA,
+                                    lda, strideA, U, 0, ldu, strideU);
             rocsolver_orgbr_ungbr_template<false, STRIDED>(
                 handle, rocblas_column_wise, m, mn, n, U, 0, ldu, strideU, tau, k, batch_count,
                 scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
@@ -414,9 +1109,9 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
         if(rightvS || rightvA)
         {
             mn = (n > m && rightvS) ? m : n;
-            hipLaunchKernelGGL(copy_array<T>, dim3(blocks_k, blocks_n, batch_count),
-                               dim3(thread_count, thread_count, 1), 0, stream, k, n, A, shiftA, lda,
-                               strideA, V, 0, ldv, strideV);
+            ROCSOLVER_LAUNCH_KERNEL(copy_array<T>, dim3(blocks_k, blocks_n, batch_count),
+                                    dim3(thread_count, thread_count, 1), 0, stream, k, n, A, shiftA,
+                                    lda, strideA, V, 0, ldv, strideV);
             rocsolver_orgbr_ungbr_template<false, STRIDED>(
                 handle, rocblas_row_wise, mn, n, m, V, 0, ldv, strideV, (tau + k * batch_count), k,
                 batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
@@ -436,32 +1131,33 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
                 k, batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact, workArr);
         }
 
-        // 3. compute singular values (and vectors if required) using the
-        // bidiagonal form
         uplo = (m >= n) ? rocblas_fill_upper : rocblas_fill_lower;
-        nu = leftvN ? 0 : m;
-        nv = rightvN ? 0 : n;
+    }
 
-        if(!leftvO && !rightvO)
-        {
-            local_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V, 0, ldv,
-                                    strideV, U, 0, ldu, strideU, info, batch_count,
-                                    (TT*)work_workArr, workArr);
-        }
+    // 3. compute singular values (and vectors if required) using the
+    // bidiagonal form
+    nu = leftvN ? 0 : m;
+    nv = rightvN ? 0 : n;
 
-        else if(leftvO && !rightvO)
-        {
-            local_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V, 0, ldv,
-                                    strideV, A, shiftA, lda, strideA, info, batch_count,
-                                    (TT*)work_workArr, workArr);
-        }
+    if(!leftvO && !rightvO)
+    {
+        local_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V, 0, ldv,
+                                strideV, U, 0, ldu, strideU, info, batch_count, scalars,
+                                (TT*)work_workArr, workArr);
+    }
 
-        else
-        {
-            local_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, A, shiftA,
-                                    lda, strideA, U, 0, ldu, strideU, info, batch_count,
-                                    (TT*)work_workArr, workArr);
-        }
+    else if(leftvO && !rightvO)
+    {
+        local_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V, 0, ldv,
+                                strideV, A, shiftA, lda, strideA, info, batch_count, scalars,
+                                (TT*)work_workArr, workArr);
+    }
+
+    else
+    {
+        local_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, A, shiftA, lda,
+                                strideA, U, 0, ldu, strideU, info, batch_count, scalars,
+                                (TT*)work_workArr, workArr);
     }
 
     return rocblas_status_success;
@@ -331,13 +331,15 @@ rocblas_status LUfact_panel(rocblas_handle handle,
                             const rocblas_int batch_count,
                             const rocblas_int pivot)
 {
-#define RUN_LUFACT_PANEL(DIM)                                                                      \
-    if(n == 64)                                                                                    \
-        hipLaunchKernelGGL((LUfact_panel_kernel_blk<DIM, T>), grid, block, lmemsize, stream, m, A, \
-                           shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, pivot); \
-    else                                                                                           \
-        hipLaunchKernelGGL((LUfact_panel_kernel<DIM, T>), grid, block, lmemsize, stream, m, n, A,  \
-                           shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, pivot)
+#define RUN_LUFACT_PANEL(DIM)                                                                     \
+    if(n == 64)                                                                                   \
+        ROCSOLVER_LAUNCH_KERNEL((LUfact_panel_kernel_blk<DIM, T>), grid, block, lmemsize, stream, \
+                                m, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,          \
+                                batch_count, pivot);                                              \
+    else                                                                                          \
+        ROCSOLVER_LAUNCH_KERNEL((LUfact_panel_kernel<DIM, T>), grid, block, lmemsize, stream, m,  \
+                                n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,          \
+                                batch_count, pivot)
 
     // determine sizes
     rocblas_int blocks = batch_count;
@@ -505,13 +507,18 @@ rocblas_status LUfact_small(rocblas_handle handle,
                             const rocblas_int batch_count,
                             const rocblas_int pivot)
 {
-#define RUN_LUFACT_SMALL(DIM)                                                                      \
-    hipLaunchKernelGGL((LUfact_small_kernel<DIM, T>), grid, block, lmemsize, stream, m, A, shiftA, \
-                       lda, strideA, ipiv, shiftP, strideP, info, batch_count, pivot)
+#define RUN_LUFACT_SMALL(DIM)                                                                   \
+    ROCSOLVER_LAUNCH_KERNEL((LUfact_small_kernel<DIM, T>), grid, block, lmemsize, stream, m, A, \
+                            shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, pivot)
 
     // determine sizes
-    std::vector<int> opval{GETF2_OPTIM_NGRP};
-    rocblas_int ngrp = (batch_count < 2 || m > 32) ? 1 : opval[m - 1];
+    rocblas_int ngrp = 1;
+    if(batch_count > 1)
+    {
+        // (at most one wavefront per workgroup)
+        ngrp = rocsolver_get_tuning<T>(rocsolver_tuning_getf2_optim_ngrp, m);
+        ngrp = min(ngrp, max(WAVESIZE / m, 1));
+    }
     rocblas_int blocks = (batch_count - 1) / ngrp + 1;
     rocblas_int nthds = m;
     rocblas_int msize = (m <= 32) ? WAVESIZE : max(m, n);
@@ -644,22 +651,71 @@ __global__ void getf2_check_singularity(U AA,
         pivot_val[id] = S(1) / A[idx];
 }
 
-template <bool ISBATCHED, typename T, typename S>
+template <typename U>
+__global__ void getrf_check_singularity(const rocblas_int n,
+                                        const rocblas_int j,
+                                        rocblas_int* ipivA,
+                                        const rocblas_int shiftP,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int* iinfo,
+                                        rocblas_int* info,
+                                        const int pivot)
+{
+    int id = hipBlockIdx_y;
+    rocblas_int* ipiv;
+
+    if(info[id] == 0 && iinfo[id] > 0)
+        info[id] = iinfo[id] + j;
+
+    int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(tid < n && pivot)
+    {
+        ipiv = ipivA + id * strideP + shiftP;
+        ipiv[tid] += j;
+    }
+}
+
+// number of nested levels of the recursive algorithm, each of which needs
+// its own array to store info about singularity (an upper bound, as the
+// optimized kernels may end the recursion earlier)
+inline rocblas_int getf2_recursive_levels(const rocblas_int m, const rocblas_int n)
+{
+    rocblas_int dim = min(m, n);
+    if(dim <= GETF2_RECURSIVE_SWITCHSIZE)
+        return 0;
+
+    rocblas_int n1 = dim / 2;
+    return max(getf2_recursive_levels(m, n1), 1 + getf2_recursive_levels(m - n1, n - n1));
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
 void rocsolver_getf2_getMemorySize(const rocblas_int m,
                                    const rocblas_int n,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
                                    size_t* size_pivotval,
-                                   size_t* size_pivotidx)
+                                   size_t* size_pivotidx,
+                                   size_t* size_iinfo)
 {
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
         *size_pivotval = 0;
         *size_pivotidx = 0;
+        *size_iinfo = 0;
+        return;
     }
 
 #ifdef OPTIMAL
@@ -669,17 +725,19 @@ void rocsolver_getf2_getMemorySize(const rocblas_int m,
         if(m <= GETF2_MAX_THDS || (m <= GETF2_OPTIM_MAX_SIZE && !ISBATCHED)
            || (m <= GETF2_BATCH_OPTIM_MAX_SIZE && ISBATCHED))
         {
-            *size_scalars = 0;
             *size_work = 0;
+            *size_work1 = 0;
+            *size_work2 = 0;
+            *size_work3 = 0;
+            *size_work4 = 0;
             *size_pivotval = 0;
             *size_pivotidx = 0;
+            *size_iinfo = 0;
+            return;
         }
     }
 #endif
 
-    // for scalars
-    *size_scalars = sizeof(T) * 3;
-
     // for pivot values
     *size_pivotval = sizeof(T) * batch_count;
 
@@ -688,6 +746,27 @@ void rocsolver_getf2_getMemorySize(const rocblas_int m,
 
     // for workspace
     *size_work = sizeof(rocblas_index_value_t<S>) * ((m - 1) / ROCBLAS_IAMAX_NB + 2) * batch_count;
+
+    rocblas_int levels = getf2_recursive_levels(m, n);
+    if(levels > 0)
+    {
+        // to store info about singularity of the right halves
+        *size_iinfo = sizeof(rocblas_int) * batch_count * levels;
+
+        // extra workspace (for calling TRSM)
+        // (the first split needs the largest one)
+        rocblas_int n1 = min(m, n) / 2;
+        rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, n1, n - n1, batch_count, size_work1,
+                                         size_work2, size_work3, size_work4);
+    }
+    else
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_iinfo = 0;
+    }
 }
 
 template <typename T>
@@ -716,7 +795,125 @@ rocblas_status rocsolver_getf2_getrf_argCheck(const rocblas_int m,
     return rocblas_status_continue;
 }
 
-template <bool ISBATCHED, typename T, typename S, typename U>
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_getf2_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* ipiv,
+                                        const rocblas_int shiftP,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        const rocblas_int pivot,
+                                        T* scalars,
+                                        rocblas_index_value_t<S>* work,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* pivotval,
+                                        rocblas_int* pivotidx,
+                                        rocblas_int* iinfo,
+                                        bool optim_mem);
+
+/** GETF2_RECURSIVE factorizes the matrix splitting its columns in two halves:
+    the left half is factorized (recursively), the right half is updated with
+    TRSM and GEMM, and the trailing (m-n1)-by-(n-n1) matrix is factorized
+    (recursively). Most of the work is then done by level-3 BLAS, and the
+    recursion ends with the optimized kernels or the unblocked algorithm.
+    (Info about singularity of the trailing matrix is stored in iinfo, and the
+    rest of iinfo is used by the nested levels.) **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+void rocsolver_getf2_recursive(rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               U A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               rocblas_int* ipiv,
+                               const rocblas_int shiftP,
+                               const rocblas_stride strideP,
+                               rocblas_int* info,
+                               const rocblas_int batch_count,
+                               const rocblas_int pivot,
+                               T* scalars,
+                               rocblas_index_value_t<S>* work,
+                               void* work1,
+                               void* work2,
+                               void* work3,
+                               void* work4,
+                               T* pivotval,
+                               rocblas_int* pivotidx,
+                               rocblas_int* iinfo,
+                               bool optim_mem)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int dim = min(m, n); // total number of pivots
+    rocblas_int n1 = dim / 2; // columns of the left half
+    rocblas_int n2 = n - n1; // columns of the right half
+
+    // factorize the left half
+    rocsolver_getf2_template<BATCHED, STRIDED, T>(handle, m, n1, A, shiftA, lda, strideA, ipiv,
+                                                  shiftP, strideP, info, batch_count, pivot,
+                                                  scalars, work, work1, work2, work3, work4,
+                                                  pivotval, pivotidx, iinfo, optim_mem);
+
+    // trsm and gemm are executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants to use when calling rocablas functions
+    T one = 1; // constant 1 in host
+    T minone = -1; // constant -1 in host
+
+    // apply interchanges to the right half
+    if(pivot)
+        rocsolver_laswp_template<T>(handle, n2, A, shiftA + idx2D(0, n1, lda), lda, strideA, 1, n1,
+                                    ipiv, shiftP, strideP, 1, batch_count);
+
+    // compute block row of U
+    rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_lower,
+                                 rocblas_operation_none, rocblas_diagonal_unit, n1, n2, &one, A,
+                                 shiftA, lda, strideA, A, shiftA + idx2D(0, n1, lda), lda, strideA,
+                                 batch_count, optim_mem, work1, work2, work3, work4);
+
+    // update trailing submatrix
+    rocblasCall_gemm<BATCHED, STRIDED, T>(
+        handle, rocblas_operation_none, rocblas_operation_none, m - n1, n2, n1, &minone, A,
+        shiftA + idx2D(n1, 0, lda), lda, strideA, A, shiftA + idx2D(0, n1, lda), lda, strideA, &one,
+        A, shiftA + idx2D(n1, n1, lda), lda, strideA, batch_count, nullptr);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+
+    // factorize the trailing submatrix
+    rocsolver_getf2_template<BATCHED, STRIDED, T>(
+        handle, m - n1, n2, A, shiftA + idx2D(n1, n1, lda), lda, strideA, ipiv, shiftP + n1,
+        strideP, iinfo, batch_count, pivot, scalars, work, work1, work2, work3, work4, pivotval,
+        pivotidx, iinfo + batch_count, optim_mem);
+
+    // adjust pivot indices and check singularity
+    rocblas_int sizePivot = min(m - n1, n2); // number of pivots in the trailing submatrix
+    rocblas_int blocksPivot = (sizePivot - 1) / BLOCKSIZE + 1;
+    dim3 gridPivot(blocksPivot, batch_count, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+    ROCSOLVER_LAUNCH_KERNEL(getrf_check_singularity<U>, gridPivot, threads, 0, stream, sizePivot,
+                            n1, ipiv, shiftP + n1, strideP, iinfo, info, pivot);
+
+    // apply interchanges to the left half
+    if(pivot)
+        rocsolver_laswp_template<T>(handle, n1, A, shiftA, lda, strideA, n1 + 1, dim, ipiv, shiftP,
+                                    strideP, 1, batch_count);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
 rocblas_status rocsolver_getf2_template(rocblas_handle handle,
                                         const rocblas_int m,
                                         const rocblas_int n,
@@ -732,9 +929,17 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle,
                                         const rocblas_int pivot,
                                         T* scalars,
                                         rocblas_index_value_t<S>* work,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
                                         T* pivotval,
-                                        rocblas_int* pivotidx)
+                                        rocblas_int* pivotidx,
+                                        rocblas_int* iinfo,
+                                        bool optim_mem)
 {
+    rocsolver_stage stage(handle, "getf2");
+
     // quick return if zero instances in batch
     if(batch_count == 0)
         return rocblas_status_success;
@@ -748,12 +953,14 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle,
     rocblas_int dim = min(m, n); // total number of pivots
 
     // info=0 (starting with a nonsingular matrix)
-    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
 
     // quick return if no dimensions
     if(m == 0 || n == 0)
         return rocblas_status_success;
 
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+
 #ifdef OPTIMAL
     // Use optimized LU factorization for the right sizes
     if(n <= WAVESIZE)
@@ -768,6 +975,15 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle,
     }
 #endif
 
+    // with wider (or taller) matrices, use the recursive algorithm
+    if(dim > GETF2_RECURSIVE_SWITCHSIZE)
+    {
+        rocsolver_getf2_recursive<BATCHED, STRIDED, T>(
+            handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, pivot,
+            scalars, work, work1, work2, work3, work4, pivotval, pivotidx, iinfo, optim_mem);
+        return rocblas_status_success;
+    }
+
     // everything must be executed with scalars on the device
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
@@ -782,9 +998,9 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle,
                                                strideA, batch_count, pivotidx, work);
 
         // adjust pivot indices and check singularity
-        hipLaunchKernelGGL(getf2_check_singularity<T>, dim3(batch_count), dim3(1), 0, stream, A,
-                           shiftA, strideA, ipiv, shiftP, strideP, j, lda, pivotval, pivotidx, info,
-                           pivot);
+        ROCSOLVER_LAUNCH_KERNEL(getf2_check_singularity<T>, dim3(batch_count), dim3(1), 0, stream,
+                                A, shiftA, strideA, ipiv, shiftP, strideP, j, lda, pivotval,
+                                pivotidx, info, pivot);
 
         if(pivot)
             // Swap pivot row and j-th row
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_getrf.hpp"
+#include "logging.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_getrf_impl(rocblas_handle handle,
@@ -19,7 +20,8 @@ rocblas_status rocsolver_getrf_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, pivot ? "getrf" : "getrf_npvt", "-m", m, "-n", n, "A", A, "--lda", lda,
+                     "ipiv", ipiv, "info", info);
 
     // argument checking
     rocblas_status st = rocsolver_getf2_getrf_argCheck(m, n, lda, A, ipiv, info, pivot);
@@ -36,50 +38,49 @@ rocblas_status rocsolver_getrf_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of reusable workspace (and for calling TRSM)
     size_t size_work, size_work1, size_work2, size_work3, size_work4;
     // extra requirements for calling GETF2
     size_t size_pivotval, size_pivotidx;
     // size to store info about singularity of each subblock
     size_t size_iinfo;
-    rocsolver_getrf_getMemorySize<false, false, T, S>(
-        m, n, batch_count, &size_scalars, &size_work, &size_work1, &size_work2, &size_work3,
-        &size_work4, &size_pivotval, &size_pivotidx, &size_iinfo);
+    rocsolver_getrf_getMemorySize<false, false, T, S>(m, n, batch_count, &size_work, &size_work1,
+                                                      &size_work2, &size_work3, &size_work4,
+                                                      &size_pivotval, &size_pivotidx, &size_iinfo);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_work1,
-                                                      size_work2, size_work3, size_work4,
-                                                      size_pivotval, size_pivotidx, size_iinfo);
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivotval,
+                                                      size_pivotidx, size_iinfo);
 
     // always allocate all required memory for TRSM optimal performance
     bool optim_mem = true;
 
     // memory workspace allocation
-    void *scalars, *work, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_work1, size_work2, size_work3,
-                              size_work4, size_pivotval, size_pivotidx, size_iinfo);
+    void *work, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo;
+    rocblas_device_malloc mem(handle, size_work, size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_iinfo);
 
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work = mem[1];
-    work1 = mem[2];
-    work2 = mem[3];
-    work3 = mem[4];
-    work4 = mem[5];
-    pivotval = mem[6];
-    pivotidx = mem[7];
-    iinfo = mem[8];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    iinfo = mem[7];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_getrf_template<false, false, T, S>(
         handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, pivot,
-        (T*)scalars, (rocblas_index_value_t<S>*)work, work1, work2, work3, work4, (T*)pivotval,
+        scalars, (rocblas_index_value_t<S>*)work, work1, work2, work3, work4, (T*)pivotval,
         (rocblas_int*)pivotidx, (rocblas_int*)iinfo, optim_mem);
 }
 
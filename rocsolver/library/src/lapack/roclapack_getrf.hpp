@@ -14,37 +14,257 @@
 #include "rocblas.hpp"
 #include "roclapack_getf2.hpp"
 #include "rocsolver.h"
+#include "side_stream.hpp"
 
-template <typename U>
-__global__ void getrf_check_singularity(const rocblas_int n,
-                                        const rocblas_int j,
-                                        rocblas_int* ipivA,
-                                        const rocblas_int shiftP,
-                                        const rocblas_stride strideP,
-                                        const rocblas_int* iinfo,
-                                        rocblas_int* info,
-                                        const int pivot)
+/*************************************************************************
+    Tournament pivoting (TSLU) for tall panels: the rows of the panel are
+    split in blocks of GETF2_MAX_THDS rows, and Gaussian elimination with
+    partial pivoting selects n candidate rows of each block. The sets of
+    candidates are then reduced in a tree, selecting n rows of the original
+    rows of every group of sets, until n rows remain; the panel is permuted to
+    bring them to the top, in the order of selection, and factorized without
+    pivoting. (Reference: Grigori, Demmel and Xiang, "CALU: a communication
+    optimal LU factorization algorithm", SIAM J. Matrix Anal. Appl. 2011.)
+*************************************************************************/
+
+/** GETRF_TSLU_SELECT selects n rows of the given rows of A (every thread
+    takes one row) by Gaussian elimination with partial pivoting. The rows
+    are the first nrows rows of A (cand = nullptr), or the rows listed in
+    cand; unused entries of cand are -1. **/
+template <typename T, typename U>
+__global__ void __launch_bounds__(GETF2_MAX_THDS) getrf_tslu_select(const rocblas_int n,
+                                                                    U AA,
+                                                                    const rocblas_int shiftA,
+                                                                    const rocblas_int lda,
+                                                                    const rocblas_stride strideA,
+                                                                    const rocblas_int* candA,
+                                                                    const rocblas_int nrows,
+                                                                    rocblas_int* selA,
+                                                                    const rocblas_stride strideC)
+{
+    using S = decltype(std::real(T{}));
+
+    const int tid = hipThreadIdx_x;
+    const int nthds = hipBlockDim_x;
+    const int grp = hipBlockIdx_x;
+    const int id = hipBlockIdx_y;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    rocblas_int* sel = selA + id * strideC + grp * n;
+
+    // shared memory (pivot row and absolute values of the current column)
+    extern __shared__ double lmem[];
+    T* prow = (T*)lmem;
+    S* vals = (S*)(prow + WAVESIZE);
+
+    // row taken by this thread
+    int pos = grp * nthds + tid;
+    rocblas_int myrow = -1;
+    if(pos < nrows)
+        myrow = candA ? candA[id * strideC + pos] : pos;
+    bool active = (myrow >= 0);
+
+    T rA[WAVESIZE];
+    if(active)
+    {
+        for(int j = 0; j < n; ++j)
+            rA[j] = A[myrow + j * lda];
+    }
+
+    for(int k = 0; k < n; ++k)
+    {
+        // search pivot index among the rows not selected yet
+        vals[tid] = active ? std::abs(rA[k]) : S(-1);
+        __syncthreads();
+
+        int pivot_index = 0;
+        for(int i = 1; i < nthds; ++i)
+        {
+            if(vals[i] > vals[pivot_index])
+                pivot_index = i;
+        }
+
+        // (no rows left)
+        if(vals[pivot_index] < 0)
+        {
+            if(tid == 0)
+            {
+                for(int i = k; i < n; ++i)
+                    sel[i] = -1;
+            }
+            return;
+        }
+        __syncthreads();
+
+        // share pivot row
+        if(tid == pivot_index)
+        {
+            active = false;
+            sel[k] = myrow;
+            for(int j = k; j < n; ++j)
+                prow[j] = rA[j];
+        }
+        __syncthreads();
+
+        // update the rows not selected yet
+        if(active && prow[k] != T(0))
+        {
+            T l = rA[k] / prow[k];
+            for(int j = k + 1; j < n; ++j)
+                rA[j] -= l * prow[j];
+        }
+        __syncthreads();
+    }
+}
+
+/** GETRF_TSLU_PIVOTS writes the interchanges that bring the selected rows
+    to the top of the panel, in order (as the pivots of LAPACK). **/
+__global__ void getrf_tslu_pivots(const rocblas_int n,
+                                  const rocblas_int* selA,
+                                  const rocblas_stride strideC,
+                                  rocblas_int* ipivA,
+                                  const rocblas_int shiftP,
+                                  const rocblas_stride strideP,
+                                  const rocblas_int batch_count)
 {
-    int id = hipBlockIdx_y;
-    rocblas_int* ipiv;
+    const int id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(id >= batch_count)
+        return;
 
-    if(info[id] == 0 && iinfo[id] > 0)
-        info[id] = iinfo[id] + j;
+    const rocblas_int* sel = selA + id * strideC;
+    rocblas_int* ipiv = ipivA + id * strideP + shiftP;
 
-    int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    // rows at the first n positions, and the rows that were moved to
+    // positions after them
+    rocblas_int rows[WAVESIZE];
+    rocblas_int extpos[WAVESIZE];
+    rocblas_int extrow[WAVESIZE];
+    int next = 0;
 
-    if(tid < n && pivot)
+    for(int k = 0; k < n; ++k)
+        rows[k] = k;
+
+    for(int k = 0; k < n; ++k)
     {
-        ipiv = ipivA + id * strideP + shiftP;
-        ipiv[tid] += j;
+        // current position of the selected row
+        rocblas_int r = sel[k];
+        rocblas_int p = -1;
+        int e = -1;
+        for(int i = k; i < n; ++i)
+        {
+            if(rows[i] == r)
+                p = i;
+        }
+        if(p < 0)
+        {
+            for(int i = 0; i < next; ++i)
+            {
+                if(extrow[i] == r)
+                {
+                    p = extpos[i];
+                    e = i;
+                }
+            }
+        }
+        if(p < 0)
+            p = r;
+        ipiv[k] = p + 1;
+
+        // swap rows k and p
+        if(p < n)
+            rows[p] = rows[k];
+        else if(e >= 0)
+            extrow[e] = rows[k];
+        else
+        {
+            extpos[next] = p;
+            extrow[next] = rows[k];
+            next++;
+        }
+        rows[k] = r;
     }
 }
 
+// TSLU is used (if it is enabled) for the panels of at most WAVESIZE columns
+// with more rows than a block of candidates
+template <typename T>
+bool getrf_use_tslu(const rocblas_int m, const rocblas_int jb)
+{
+    rocblas_int tslu = rocsolver_get_tuning<T>(rocsolver_tuning_getrf_tslu_switchsize, m);
+    return tslu > 0 && m >= tslu && m > GETF2_MAX_THDS && jb <= WAVESIZE;
+}
+
+// workspace to store the candidates of two levels of the tree
+inline size_t
+    getrf_tslu_size(const rocblas_int m, const rocblas_int jb, const rocblas_int batch_count)
+{
+    rocblas_int nleaves = (m - 1) / GETF2_MAX_THDS + 1;
+    return sizeof(rocblas_int) * 2 * nleaves * jb * batch_count;
+}
+
+/** GETRF_TSLU_PIVOTING selects the n pivots of the m-by-n panel A with
+    tournament pivoting, and writes them in ipiv (cand is the workspace). **/
+template <typename T, typename U>
+void getrf_tslu_pivoting(rocblas_handle handle,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         U A,
+                         const rocblas_int shiftA,
+                         const rocblas_int lda,
+                         const rocblas_stride strideA,
+                         rocblas_int* ipiv,
+                         const rocblas_int shiftP,
+                         const rocblas_stride strideP,
+                         const rocblas_int batch_count,
+                         rocblas_int* cand)
+{
+    using S = decltype(std::real(T{}));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // candidates of a level of the tree, for each problem
+    rocblas_int nleaves = (m - 1) / GETF2_MAX_THDS + 1;
+    rocblas_stride strideC = nleaves * n;
+    rocblas_int* cin = cand;
+    rocblas_int* cout = cand + strideC * batch_count;
+    size_t lmemsize = WAVESIZE * sizeof(T) + GETF2_MAX_THDS * sizeof(S);
+
+    // blocks of rows
+    ROCSOLVER_LAUNCH_KERNEL(getrf_tslu_select<T>, dim3(nleaves, batch_count, 1),
+                            dim3(GETF2_MAX_THDS, 1, 1), lmemsize, stream, n, A, shiftA, lda,
+                            strideA, (rocblas_int*)nullptr, m, cout, strideC);
+
+    // reduction tree, with groups of as many sets of candidates as fit in a
+    // workgroup
+    rocblas_int group = GETF2_MAX_THDS / n;
+    for(rocblas_int nsets = nleaves; nsets > 1; nsets = (nsets - 1) / group + 1)
+    {
+        std::swap(cin, cout);
+        rocblas_int nodes = (nsets - 1) / group + 1;
+        ROCSOLVER_LAUNCH_KERNEL(getrf_tslu_select<T>, dim3(nodes, batch_count, 1),
+                                dim3(group * n, 1, 1), lmemsize, stream, n, A, shiftA, lda,
+                                strideA, cin, nsets * n, cout, strideC);
+    }
+
+    rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+    ROCSOLVER_LAUNCH_KERNEL(getrf_tslu_pivots, dim3(blocks, 1, 1), dim3(BLOCKSIZE, 1, 1), 0, stream,
+                            n, cout, strideC, ipiv, shiftP, strideP, batch_count);
+}
+
+// the panels use their own part of the TRSM workspace, after the part used by
+// the trailing updates, so that they can be factorized concurrently
+// (look-ahead); this is the offset of the part of the panels
+inline size_t getrf_panel_offset(const size_t size)
+{
+    return (size + 255) / 256 * 256;
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename S>
 void rocsolver_getrf_getMemorySize(const rocblas_int m,
                                    const rocblas_int n,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work,
                                    size_t* size_work1,
                                    size_t* size_work2,
@@ -54,12 +274,9 @@ void rocsolver_getrf_getMemorySize(const rocblas_int m,
                                    size_t* size_pivotidx,
                                    size_t* size_iinfo)
 {
-    static constexpr bool ISBATCHED = BATCHED || STRIDED;
-
     // if quick return, no need of workspace
     if(m == 0 || n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work = 0;
         *size_work1 = 0;
         *size_work2 = 0;
@@ -71,31 +288,159 @@ void rocsolver_getrf_getMemorySize(const rocblas_int m,
         return;
     }
 
-    if(m < GETRF_GETF2_SWITCHSIZE || n < GETRF_GETF2_SWITCHSIZE)
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_getrf_switchsize, min(m, n));
+    rocblas_int jb = min(nb, min(m, n));
+    bool tslu = getrf_use_tslu<T>(m, jb);
+    if((m < nb || n < nb) && !tslu)
     {
         // requirements for one single GETF2
-        rocsolver_getf2_getMemorySize<ISBATCHED, T, S>(m, n, batch_count, size_scalars, size_work,
-                                                       size_pivotval, size_pivotidx);
-        *size_work1 = 0;
-        *size_work2 = 0;
-        *size_work3 = 0;
-        *size_work4 = 0;
-        *size_iinfo = 0;
+        rocsolver_getf2_getMemorySize<BATCHED, STRIDED, T, S>(
+            m, n, batch_count, size_work, size_work1, size_work2, size_work3, size_work4,
+            size_pivotval, size_pivotidx, size_iinfo);
     }
     else
     {
-        rocblas_int jb = GETRF_GETF2_SWITCHSIZE;
+        size_t w1, w2, w3, w4, iinfo;
 
         // requirements for calling GETF2 for the sub blocks
-        rocsolver_getf2_getMemorySize<ISBATCHED, T, S>(m, jb, batch_count, size_scalars, size_work,
-                                                       size_pivotval, size_pivotidx);
+        rocsolver_getf2_getMemorySize<BATCHED, STRIDED, T, S>(m, jb, batch_count, size_work, &w1,
+                                                              &w2, &w3, &w4, size_pivotval,
+                                                              size_pivotidx, &iinfo);
+
+        // to store the candidates of tournament pivoting
+        // (GETF2 is then called without pivoting, and does not use this workspace)
+        if(tslu)
+            *size_work = max(*size_work, getrf_tslu_size(m, jb, batch_count));
 
         // to store info about singularity of sub blocks
-        *size_iinfo = sizeof(rocblas_int) * batch_count;
+        // (and of the trailing submatrices in GETF2)
+        *size_iinfo = sizeof(rocblas_int) * batch_count + iinfo;
 
         // extra workspace (for calling TRSM)
         rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, jb, n - jb, batch_count, size_work1,
                                          size_work2, size_work3, size_work4);
+        *size_work1 = getrf_panel_offset(*size_work1) + w1;
+        *size_work2 = getrf_panel_offset(*size_work2) + w2;
+        *size_work3 = getrf_panel_offset(*size_work3) + w3;
+        *size_work4 = getrf_panel_offset(*size_work4) + w4;
+    }
+}
+
+// factorizes the panel of jb columns that starts at the diagonal element j
+// (the pivot indices and info are relative to the whole matrix; the workspaces
+// are those of the panels); tall panels can use tournament pivoting
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+void getrf_panel(rocblas_handle handle,
+                 const rocblas_int j,
+                 const rocblas_int jb,
+                 const rocblas_int m,
+                 U A,
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 rocblas_int* ipiv,
+                 const rocblas_int shiftP,
+                 const rocblas_stride strideP,
+                 rocblas_int* info,
+                 const rocblas_int batch_count,
+                 const rocblas_int pivot,
+                 T* scalars,
+                 rocblas_index_value_t<S>* work,
+                 void* work1,
+                 void* work2,
+                 void* work3,
+                 void* work4,
+                 T* pivotval,
+                 rocblas_int* pivotidx,
+                 rocblas_int* iinfo,
+                 bool optim_mem,
+                 bool tslu)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+
+    // Factor diagonal and subdiagonal blocks
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
+    if(tslu && pivot && m - j > GETF2_MAX_THDS)
+    {
+        // select the pivots with tournament pivoting, bring them to the top
+        // and factorize without pivoting
+        getrf_tslu_pivoting<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, ipiv,
+                               shiftP + j, strideP, batch_count, (rocblas_int*)work);
+        rocsolver_laswp_template<T>(handle, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, 1, jb,
+                                    ipiv, shiftP + j, strideP, 1, batch_count);
+        rocsolver_getf2_template<BATCHED, STRIDED, T>(
+            handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, ipiv, shiftP + j,
+            strideP, iinfo, batch_count, 0, scalars, work, work1, work2, work3, work4, pivotval,
+            pivotidx, iinfo + batch_count, optim_mem);
+    }
+    else
+        rocsolver_getf2_template<BATCHED, STRIDED, T>(
+            handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, ipiv, shiftP + j,
+            strideP, iinfo, batch_count, pivot, scalars, work, work1, work2, work3, work4, pivotval,
+            pivotidx, iinfo + batch_count, optim_mem);
+
+    // adjust pivot indices and check singularity
+    rocblas_int sizePivot = min(m - j, jb); // number of pivots in the block
+    rocblas_int blocksPivot = (sizePivot - 1) / BLOCKSIZE + 1;
+    dim3 gridPivot(blocksPivot, batch_count, 1);
+    ROCSOLVER_LAUNCH_KERNEL(getrf_check_singularity<U>, gridPivot, threads, 0, stream, sizePivot, j,
+                            ipiv, shiftP + j, strideP, iinfo, info, pivot);
+}
+
+// applies the factorization of the panel of jb columns that starts at the
+// diagonal element j to the columns [k, k + nk) of the trailing matrix
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void getrf_update(rocblas_handle handle,
+                  const rocblas_int j,
+                  const rocblas_int jb,
+                  const rocblas_int k,
+                  const rocblas_int nk,
+                  const rocblas_int m,
+                  U A,
+                  const rocblas_int shiftA,
+                  const rocblas_int lda,
+                  const rocblas_stride strideA,
+                  rocblas_int* ipiv,
+                  const rocblas_int shiftP,
+                  const rocblas_stride strideP,
+                  const rocblas_int batch_count,
+                  const rocblas_int pivot,
+                  void* work1,
+                  void* work2,
+                  void* work3,
+                  void* work4,
+                  bool optim_mem)
+{
+    // constants to use when calling rocablas functions
+    T one = 1; // constant 1 in host
+    T minone = -1; // constant -1 in host
+
+    if(pivot)
+    {
+        // apply interchanges to columns k : k+nk
+        rocsolver_laswp_template<T>(handle, nk, A, shiftA + idx2D(0, k, lda), lda, strideA, j + 1,
+                                    j + jb, ipiv, shiftP, strideP, 1, batch_count);
+    }
+
+    // compute block row of U
+    rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_lower,
+                                 rocblas_operation_none, rocblas_diagonal_unit, jb, nk, &one, A,
+                                 shiftA + idx2D(j, j, lda), lda, strideA, A,
+                                 shiftA + idx2D(j, k, lda), lda, strideA, batch_count, optim_mem,
+                                 work1, work2, work3, work4);
+
+    // update trailing submatrix
+    if(j + jb < m)
+    {
+        rocblasCall_gemm<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, m - j - jb, nk, jb, &minone, A,
+            shiftA + idx2D(j + jb, j, lda), lda, strideA, A, shiftA + idx2D(j, k, lda), lda,
+            strideA, &one, A, shiftA + idx2D(j + jb, k, lda), lda, strideA, batch_count, nullptr);
     }
 }
 
@@ -124,6 +469,8 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
                                         rocblas_int* iinfo,
                                         bool optim_mem)
 {
+    rocsolver_stage stage(handle, "getrf");
+
     // quick return
     if(batch_count == 0)
         return rocblas_status_success;
@@ -131,55 +478,63 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocksPivot;
     rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
-    dim3 gridPivot;
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BLOCKSIZE, 1, 1);
 
     // info=0 (starting with a nonsingular matrix)
-    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
 
     // quick return if no dimensions
     if(m == 0 || n == 0)
         return rocblas_status_success;
 
-    static constexpr bool ISBATCHED = BATCHED || STRIDED;
-
     // if the matrix is small, use the unblocked (level-2-blas) variant of the
     // algorithm
-    if(m < GETRF_GETF2_SWITCHSIZE || n < GETRF_GETF2_SWITCHSIZE)
-        return rocsolver_getf2_template<ISBATCHED, T>(handle, m, n, A, shiftA, lda, strideA, ipiv,
-                                                      shiftP, strideP, info, batch_count, pivot,
-                                                      scalars, work, pivotval, pivotidx);
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_getrf_switchsize, min(m, n));
+    rocblas_int dim = min(m, n); // total number of pivots
+    bool tslu = getrf_use_tslu<T>(m, min(nb, dim));
+    if((m < nb || n < nb) && !tslu)
+        return rocsolver_getf2_template<BATCHED, STRIDED, T>(
+            handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, pivot,
+            scalars, work, work1, work2, work3, work4, pivotval, pivotidx, iinfo, optim_mem);
+
+    // workspaces of the panels
+    size_t w1, w2, w3, w4;
+    rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, min(nb, dim), n - min(nb, dim),
+                                     batch_count, &w1, &w2, &w3, &w4);
+    void* pwork1 = (char*)work1 + getrf_panel_offset(w1);
+    void* pwork2 = (char*)work2 + getrf_panel_offset(w2);
+    void* pwork3 = (char*)work3 + getrf_panel_offset(w3);
+    void* pwork4 = (char*)work4 + getrf_panel_offset(w4);
 
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
 
-    // constants to use when calling rocablas functions
-    T one = 1; // constant 1 in host
-    T minone = -1; // constant -1 in host
+    rocblas_int jb, jn;
 
-    rocblas_int dim = min(m, n); // total number of pivots
-    rocblas_int jb, sizePivot;
+    // with large matrices, the next panel is updated first, and then factorized
+    // on a secondary stream while the rest of the trailing matrix is updated
+    // (look-ahead), so that the latency-bound panel factorization overlaps
+    // with the trailing GEMM
+    rocsolver_side_stream side;
+    bool lookahead = dim > nb
+        && dim >= rocsolver_get_tuning<T>(rocsolver_tuning_getrf_lookahead_switchsize, dim)
+        && rocsolver_acquire_side_stream(&side);
 
-    for(rocblas_int j = 0; j < dim; j += GETRF_GETF2_SWITCHSIZE)
+    for(rocblas_int j = 0; j < dim; j += nb)
     {
-        // Factor diagonal and subdiagonal blocks
-        jb = min(dim - j, GETRF_GETF2_SWITCHSIZE); // number of columns in the block
-        hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
-        rocsolver_getf2_template<ISBATCHED, T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda,
-                                               strideA, ipiv, shiftP + j, strideP, iinfo,
-                                               batch_count, pivot, scalars, work, pivotval, pivotidx);
-
-        // adjust pivot indices and check singularity
-        sizePivot = min(m - j, jb); // number of pivots in the block
-        blocksPivot = (sizePivot - 1) / BLOCKSIZE + 1;
-        gridPivot = dim3(blocksPivot, batch_count, 1);
-        hipLaunchKernelGGL(getrf_check_singularity<U>, gridPivot, threads, 0, stream, sizePivot, j,
-                           ipiv, shiftP + j, strideP, iinfo, info, pivot);
+        jb = min(dim - j, nb); // number of columns in the block
+
+        // (with look-ahead, the panels after the first one were factorized
+        // in the previous iteration)
+        if(!lookahead || j == 0)
+            getrf_panel<BATCHED, STRIDED, T>(handle, j, jb, m, A, shiftA, lda, strideA, ipiv,
+                                             shiftP, strideP, info, batch_count, pivot, scalars,
+                                             work, pwork1, pwork2, pwork3, pwork4, pivotval,
+                                             pivotidx, iinfo, optim_mem, tslu);
 
         // apply interchanges to columns 1 : j-1
         if(pivot)
@@ -188,33 +543,43 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
 
         if(j + jb < n)
         {
-            if(pivot)
+            // columns of the next panel, if it is factorized ahead
+            jn = 0;
+            if(lookahead && j + jb < dim)
             {
-                // apply interchanges to columns j+jb : n
-                rocsolver_laswp_template<T>(handle, (n - j - jb), A, shiftA + idx2D(0, j + jb, lda),
-                                            lda, strideA, j + 1, j + jb, ipiv, shiftP, strideP, 1,
-                                            batch_count);
+                jn = min(dim - j - jb, nb);
+                getrf_update<BATCHED, STRIDED, T>(handle, j, jb, j + jb, jn, m, A, shiftA, lda,
+                                                  strideA, ipiv, shiftP, strideP, batch_count,
+                                                  pivot, work1, work2, work3, work4, optim_mem);
+
+                // the panel and the rest of the trailing matrix are disjoint, and
+                // use different workspaces
+                hipEventRecord(side.events[0], stream);
+                hipStreamWaitEvent(side.stream, side.events[0], 0);
+                rocblas_set_stream(handle, side.stream);
+                getrf_panel<BATCHED, STRIDED, T>(handle, j + jb, jn, m, A, shiftA, lda, strideA,
+                                                 ipiv, shiftP, strideP, info, batch_count, pivot,
+                                                 scalars, work, pwork1, pwork2, pwork3, pwork4,
+                                                 pivotval, pivotidx, iinfo, optim_mem, tslu);
+                hipEventRecord(side.events[1], side.stream);
+                rocblas_set_stream(handle, stream);
             }
 
-            // compute block row of U
-            rocblasCall_trsm<BATCHED, T>(handle, rocblas_side_left, rocblas_fill_lower,
-                                         rocblas_operation_none, rocblas_diagonal_unit, jb,
-                                         (n - j - jb), &one, A, shiftA + idx2D(j, j, lda), lda,
-                                         strideA, A, shiftA + idx2D(j, j + jb, lda), lda, strideA,
-                                         batch_count, optim_mem, work1, work2, work3, work4);
+            if(j + jb + jn < n)
+                getrf_update<BATCHED, STRIDED, T>(handle, j, jb, j + jb + jn, n - j - jb - jn, m,
+                                                  A, shiftA, lda, strideA, ipiv, shiftP, strideP,
+                                                  batch_count, pivot, work1, work2, work3, work4,
+                                                  optim_mem);
 
-            // update trailing submatrix
-            if(j + jb < m)
-            {
-                rocblasCall_gemm<BATCHED, STRIDED, T>(
-                    handle, rocblas_operation_none, rocblas_operation_none, m - j - jb, n - j - jb,
-                    jb, &minone, A, shiftA + idx2D(j + jb, j, lda), lda, strideA, A,
-                    shiftA + idx2D(j, j + jb, lda), lda, strideA, &one, A,
-                    shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count, nullptr);
-            }
+            // the next iteration starts when the panel is factorized
+            if(jn > 0)
+                hipStreamWaitEvent(stream, side.events[1], 0);
         }
     }
 
+    if(lookahead)
+        rocsolver_release_side_stream(side);
+
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
 }
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_getri.hpp"
+#include "logging.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_getri_impl(rocblas_handle handle,
@@ -15,7 +16,7 @@ rocblas_status rocsolver_getri_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "getri", "-n", n, "A", A, "--lda", lda, "ipiv", ipiv, "info", info);
 
     // argument checking
     rocblas_status st = rocsolver_getri_argCheck(n, lda, A, ipiv, info);
@@ -32,48 +33,46 @@ rocblas_status rocsolver_getri_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of reusable workspace (for calling TRSM and TRTRI)
     size_t size_work1, size_work2, size_work3, size_work4;
     // size of temporary array required for copies
     size_t size_tmpcopy;
     // size of arrays of pointers (for batched cases)
     size_t size_workArr;
-    rocsolver_getri_getMemorySize<false, true, T>(n, batch_count, &size_scalars, &size_work1,
-                                                  &size_work2, &size_work3, &size_work4,
-                                                  &size_tmpcopy, &size_workArr);
+    rocsolver_getri_getMemorySize<false, true, T>(n, batch_count, &size_work1, &size_work2,
+                                                  &size_work3, &size_work4, &size_tmpcopy,
+                                                  &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
-                                                      size_work3, size_work4, size_tmpcopy,
-                                                      size_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+                                                      size_work4, size_tmpcopy, size_workArr);
 
     // always allocate all required memory for TRSM optimal performance
     bool optim_mem = true;
 
     // memory workspace allocation
-    void *scalars, *work1, *work2, *work3, *work4, *tmpcopy, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
-                              size_tmpcopy, size_workArr);
+    void *work1, *work2, *work3, *work4, *tmpcopy, *workArr;
+    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_tmpcopy,
+                              size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work1 = mem[1];
-    work2 = mem[2];
-    work3 = mem[3];
-    work4 = mem[4];
-    tmpcopy = mem[5];
-    workArr = mem[6];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    tmpcopy = mem[4];
+    workArr = mem[5];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // in-place execution
     return rocsolver_getri_template<false, false, T>(
         handle, n, (U) nullptr, 0, 0, 0, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,
-        batch_count, (T*)scalars, work1, work2, work3, work4, (T*)tmpcopy, (T**)workArr, optim_mem);
+        batch_count, scalars, work1, work2, work3, work4, (T*)tmpcopy, (T**)workArr, optim_mem);
 }
 
 /*
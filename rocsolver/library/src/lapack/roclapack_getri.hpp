@@ -147,8 +147,8 @@ rocblas_status getri_run_small(rocblas_handle handle,
                                const rocblas_int batch_count)
 {
 #define RUN_GETRI_SMALL(DIM)                                                                 \
-    hipLaunchKernelGGL((getri_kernel_small<DIM, T>), grid, block, 0, stream, A, shiftA, lda, \
-                       strideA, ipiv, shiftP, strideP, info)
+    ROCSOLVER_LAUNCH_KERNEL((getri_kernel_small<DIM, T>), grid, block, 0, stream, A, shiftA, \
+                            lda, strideA, ipiv, shiftP, strideP, info)
 
     dim3 grid(batch_count, 1, 1);
     dim3 block(WAVESIZE, 1, 1);
@@ -370,10 +370,11 @@ __global__ void getri_kernel(const rocblas_int n,
                              const rocblas_stride strideP,
                              rocblas_int* info,
                              V work,
-                             const rocblas_stride strideW)
+                             const rocblas_stride strideW,
+                             const rocblas_int nb)
 {
     // Do-everything getri kernel (excepting the call to trtri) for small- and
-    // mid-size matrices
+    // mid-size matrices (nb = 0 selects the unblocked version)
     int b = hipBlockIdx_x;
 
     T* a = load_ptr_batch<T>(A, b, shiftA, strideA);
@@ -385,7 +386,7 @@ __global__ void getri_kernel(const rocblas_int n,
 
     T minone = -1;
     T one = 1;
-    if(n <= GETRI_SWITCHSIZE_MID)
+    if(nb == 0)
     {
         // use unblocked version
         for(rocblas_int j = n - 2; j >= 0; --j)
@@ -398,7 +399,7 @@ __global__ void getri_kernel(const rocblas_int n,
     else
     {
         // use blocked version
-        rocblas_int jb, nb = GETRI_BLOCKSIZE;
+        rocblas_int jb;
         rocblas_int nn = ((n - 1) / nb) * nb + 1;
         for(rocblas_int j = nn - 1; j >= 0; j -= nb)
         {
@@ -467,7 +468,6 @@ __global__ void getri_kernel_large2(const rocblas_int n,
 template <bool BATCHED, bool INPLACE, typename T>
 void rocsolver_getri_getMemorySize(const rocblas_int n,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work1,
                                    size_t* size_work2,
                                    size_t* size_work3,
@@ -478,7 +478,6 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
     // if quick return, no need of workspace
     if(n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work1 = 0;
         *size_work2 = 0;
         *size_work3 = 0;
@@ -492,7 +491,6 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
     // if very small size, no workspace needed
     if(n <= WAVESIZE)
     {
-        *size_scalars = 0;
         *size_work1 = 0;
         *size_work2 = 0;
         *size_work3 = 0;
@@ -503,9 +501,6 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
     }
 #endif
 
-    // size of scalars for calling rocblas
-    *size_scalars = sizeof(T) * 3;
-
     // size of array of pointers (batched cases)
     if(BATCHED)
         *size_workArr = sizeof(T*) * batch_count;
@@ -513,9 +508,13 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
         *size_workArr = 0;
 
     size_t w1a, w1b, w2a, w2b, t1, t2;
+    rocblas_int nlarge = rocsolver_get_tuning<T>(rocsolver_tuning_getri_switchsize_large, n);
+    rocblas_int nmid
+        = min(nlarge, rocsolver_get_tuning<T>(rocsolver_tuning_getri_switchsize_mid, n));
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_getri_blocksize, n);
 
     // requirements for calling TRSM
-    if(n <= GETRI_SWITCHSIZE_LARGE)
+    if(n <= nlarge)
     {
         w1a = 0;
         w2a = 0;
@@ -523,8 +522,8 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
         *size_work4 = 0;
     }
     else
-        rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_right, n, GETRI_BLOCKSIZE, batch_count, &w1a,
-                                         &w2a, size_work3, size_work4);
+        rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_right, n, nb, batch_count, &w1a, &w2a,
+                                         size_work3, size_work4);
 
     // requirements for calling TRTRI
     rocblasCall_trtri_mem<BATCHED, T>(n, batch_count, &w1b, &w2b);
@@ -534,7 +533,7 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
 
     // size of temporary array required for copies
     t1 = (INPLACE ? n * n : 0) * sizeof(T) * batch_count;
-    t2 = (n <= GETRI_SWITCHSIZE_MID ? n : n * GETRI_BLOCKSIZE) * sizeof(T) * batch_count;
+    t2 = (n <= nmid ? n : n * nb) * sizeof(T) * batch_count;
     *size_tmpcopy = max(t1, t2);
 }
 
@@ -613,6 +612,8 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
                                         T** workArr,
                                         bool optim_mem)
 {
+    rocsolver_stage stage(handle, "getri");
+
     // quick return if zero instances in batch
     if(batch_count == 0)
         return rocblas_status_success;
@@ -624,8 +625,8 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
     if(n == 0)
     {
         rocblas_int blocks = (batch_count - 1) / 32 + 1;
-        hipLaunchKernelGGL(reset_info, dim3(blocks, 1, 1), dim3(32, 1, 1), 0, stream, info,
-                           batch_count, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(32, 1, 1), 0, stream, info,
+                                batch_count, 0);
         return rocblas_status_success;
     }
 
@@ -637,9 +638,10 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
     if(n <= WAVESIZE)
     {
         if(A1 != nullptr)
-            hipLaunchKernelGGL((getri_trtri_update<true, false, T>),
-                               dim3(batch_count, blocks, blocks), dim3(1, 32, 32), 0, stream, n, A,
-                               shiftA, lda, strideA, A1, shiftA1, lda1, strideA1, nullptr);
+            ROCSOLVER_LAUNCH_KERNEL((getri_trtri_update<true, false, T>),
+                                    dim3(batch_count, blocks, blocks), dim3(1, 32, 32), 0, stream,
+                                    n, A, shiftA, lda, strideA, A1, shiftA1, lda1, strideA1,
+                                    nullptr);
 
         return getri_run_small<T>(handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,
                                   batch_count);
@@ -652,8 +654,8 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
     if(A1 == nullptr) // in-place trtri
     {
         // check for singularities
-        hipLaunchKernelGGL(getri_check_singularity<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1),
-                           0, stream, n, A, shiftA, lda, strideA, info);
+        ROCSOLVER_LAUNCH_KERNEL(getri_check_singularity<T>, dim3(batch_count, 1, 1),
+                                dim3(1, threads, 1), 0, stream, n, A, shiftA, lda, strideA, info);
 
         // compute inv(U)
         rocblasCall_trtri<BATCHED, STRIDED, T>(handle, rocblas_fill_upper, rocblas_diagonal_non_unit,
@@ -661,15 +663,16 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
                                                batch_count, (T*)work1, (T**)work2, workArr);
 
         // copy inv(U) to A
-        hipLaunchKernelGGL((getri_trtri_update<false, true, T>), dim3(batch_count, blocks, blocks),
-                           dim3(1, 32, 32), 0, stream, n, A, shiftA, lda, strideA, tmpcopy, 0, ldw,
-                           strideW, info);
+        ROCSOLVER_LAUNCH_KERNEL((getri_trtri_update<false, true, T>),
+                                dim3(batch_count, blocks, blocks), dim3(1, 32, 32), 0, stream, n, A,
+                                shiftA, lda, strideA, tmpcopy, 0, ldw, strideW, info);
     }
     else // out-of-place trtri
     {
         // check for singularities
-        hipLaunchKernelGGL(getri_check_singularity<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1),
-                           0, stream, n, A1, shiftA1, lda1, strideA1, info);
+        ROCSOLVER_LAUNCH_KERNEL(getri_check_singularity<T>, dim3(batch_count, 1, 1),
+                                dim3(1, threads, 1), 0, stream, n, A1, shiftA1, lda1, strideA1,
+                                info);
 
         // compute inv(U)
         rocblasCall_trtri<BATCHED, STRIDED, T>(handle, rocblas_fill_upper, rocblas_diagonal_non_unit,
@@ -677,20 +680,27 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
                                                strideA, batch_count, (T*)work1, (T**)work2, workArr);
 
         // restore lower triangular part of A
-        hipLaunchKernelGGL((getri_trtri_update<false, false, T>), dim3(batch_count, blocks, blocks),
-                           dim3(1, 32, 32), 0, stream, n, A, shiftA, lda, strideA, A1, shiftA1,
-                           lda1, strideA1, info);
+        ROCSOLVER_LAUNCH_KERNEL((getri_trtri_update<false, false, T>),
+                                dim3(batch_count, blocks, blocks), dim3(1, 32, 32), 0, stream, n, A,
+                                shiftA, lda, strideA, A1, shiftA1, lda1, strideA1, info);
     }
 
     // at this point: if A is singular, then it contains the original triangular
     // factors L and U (i.e. it is unmodified); otherwise, it contains L and
     // inv(U)
 
-    strideW = (n <= GETRI_SWITCHSIZE_MID ? n : n * GETRI_BLOCKSIZE);
-    if(n <= GETRI_SWITCHSIZE_LARGE)
+    // (the unblocked algorithm is only available in getri_kernel, hence nmid <= nlarge)
+    rocblas_int nlarge = rocsolver_get_tuning<T>(rocsolver_tuning_getri_switchsize_large, n);
+    rocblas_int nmid
+        = min(nlarge, rocsolver_get_tuning<T>(rocsolver_tuning_getri_switchsize_mid, n));
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_getri_blocksize, n);
+
+    strideW = (n <= nmid ? n : n * nb);
+    if(n <= nlarge)
     {
-        hipLaunchKernelGGL(getri_kernel<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1), 0, stream,
-                           n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, tmpcopy, strideW);
+        ROCSOLVER_LAUNCH_KERNEL(getri_kernel<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1), 0,
+                                stream, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,
+                                tmpcopy, strideW, (n <= nmid ? 0 : nb));
     }
     else
     {
@@ -701,15 +711,16 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
 
         T minone = -1;
         T one = 1;
-        rocblas_int jb, nb = GETRI_BLOCKSIZE;
+        rocblas_int jb;
 
         rocblas_int nn = ((n - 1) / nb) * nb + 1;
         for(rocblas_int j = nn - 1; j >= 0; j -= nb)
         {
             jb = min(n - j, nb);
 
-            hipLaunchKernelGGL(getri_kernel_large1<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1),
-                               0, stream, n, j, jb, A, shiftA, lda, strideA, info, tmpcopy, strideW);
+            ROCSOLVER_LAUNCH_KERNEL(getri_kernel_large1<T>, dim3(batch_count, 1, 1),
+                                    dim3(1, threads, 1), 0, stream, n, j, jb, A, shiftA, lda,
+                                    strideA, info, tmpcopy, strideW);
 
             if(j + jb < n)
                 rocblasCall_gemm<BATCHED, STRIDED>(
@@ -724,8 +735,9 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
                                          work4, workArr);
         }
 
-        hipLaunchKernelGGL(getri_kernel_large2<T>, dim3(batch_count, 1, 1), dim3(1, threads, 1), 0,
-                           stream, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info);
+        ROCSOLVER_LAUNCH_KERNEL(getri_kernel_large2<T>, dim3(batch_count, 1, 1),
+                                dim3(1, threads, 1), 0, stream, n, A, shiftA, lda, strideA, ipiv,
+                                shiftP, strideP, info);
 
         rocblas_set_pointer_mode(handle, old_mode);
     }
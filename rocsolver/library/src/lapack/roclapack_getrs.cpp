@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_getrs.hpp"
+#include "logging.hpp"
 
 template <typename T>
 rocblas_status rocsolver_getrs_impl(rocblas_handle handle,
@@ -18,7 +19,8 @@ rocblas_status rocsolver_getrs_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "getrs", "--transposeA", trans, "-m", n, "-n", nrhs, "A", A,
+                     "--lda", lda, "ipiv", ipiv, "B", B, "--ldb", ldb);
 
     // argument checking
     rocblas_status st = rocsolver_getrs_argCheck(trans, n, nrhs, lda, ldb, A, B, ipiv);
@@ -14,6 +14,268 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
+#ifdef OPTIMAL
+/*************************************************************************
+    getrs_small_trsv solves a triangular system for a block of
+    GETRS_NRHS_BLOCKSIZE right-hand sides. The thread of row myrow keeps the
+    row of the triangular matrix in rA and the row of the right-hand sides in
+    rB; common is the shared memory of the group.
+*************************************************************************/
+template <rocblas_int DIM, bool LOWER, bool UNIT, typename T>
+__device__ void getrs_small_trsv(const int myrow, const T* rA, T* rB, T* common)
+{
+    using S = decltype(std::real(T{}));
+
+#pragma unroll DIM
+    for(int kk = 0; kk < DIM; ++kk)
+    {
+        const int k = LOWER ? kk : DIM - 1 - kk;
+
+        // compute and share the solution in row k
+        if(myrow == k)
+        {
+            if(!UNIT)
+            {
+                T d = S(1) / rA[k];
+                for(int c = 0; c < GETRS_NRHS_BLOCKSIZE; ++c)
+                    rB[c] *= d;
+            }
+            for(int c = 0; c < GETRS_NRHS_BLOCKSIZE; ++c)
+                common[c] = rB[c];
+        }
+        __syncthreads();
+
+        // update the remaining rows
+        if(LOWER ? myrow > k : myrow < k)
+        {
+            for(int c = 0; c < GETRS_NRHS_BLOCKSIZE; ++c)
+                rB[c] -= rA[k] * common[c];
+        }
+        __syncthreads();
+    }
+}
+
+/*************************************************************************
+    getrs_small_kernel solves the systems with n <= WAVESIZE: each thread
+    keeps a row of the factors (or of their transpose) in registers, and the
+    right-hand sides are solved in blocks of GETRS_NRHS_BLOCKSIZE columns,
+    which are spread over the workgroups in the y dimension of the grid.
+    The interchanges are applied by reading (or writing) the rows of B at
+    their permuted positions.
+*************************************************************************/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(WAVESIZE) getrs_small_kernel(const rocblas_operation trans,
+                                                               const rocblas_int nrhs,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               const rocblas_int* ipivA,
+                                                               const rocblas_stride strideP,
+                                                               U BB,
+                                                               const rocblas_int shiftB,
+                                                               const rocblas_int ldb,
+                                                               const rocblas_stride strideB,
+                                                               const rocblas_int batch_count)
+{
+    const int inrow = hipThreadIdx_x; // row of B read by this thread
+    const int ty = hipThreadIdx_y;
+    const int id = hipBlockIdx_x * hipBlockDim_y + ty;
+
+    if(id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, id, shiftB, strideB);
+    const rocblas_int* ipiv = ipivA + id * strideP;
+
+    // shared memory (for communication between threads in group)
+    extern __shared__ double lmem[];
+    T* common = (T*)lmem;
+    common += ty * GETRS_NRHS_BLOCKSIZE;
+
+    // local variables
+    const bool notrans = (trans == rocblas_operation_none);
+    T rA[DIM]; // to store this-row values of the factors
+    T rB[GETRS_NRHS_BLOCKSIZE]; // to store this-row values of the right-hand sides
+
+    // position of row inrow of B after the interchanges
+    // (in reverse order for the transposed systems)
+    int myrow = inrow;
+#pragma unroll DIM
+    for(int kk = 0; kk < DIM; ++kk)
+    {
+        const int k = notrans ? kk : DIM - 1 - kk;
+        const int p = ipiv[k] - 1;
+        if(myrow == k)
+            myrow = p;
+        else if(myrow == p)
+            myrow = k;
+    }
+
+    // read the row of L*U that corresponds to row inrow of P'*B, or the
+    // row inrow of (L*U)' (the system is solved before the interchanges)
+    const int row = notrans ? myrow : inrow;
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+    {
+        if(notrans)
+            rA[j] = A[myrow + j * lda];
+        else if(trans == rocblas_operation_transpose)
+            rA[j] = A[j + inrow * lda];
+        else
+            rA[j] = conj(A[j + inrow * lda]);
+    }
+
+    // for each block of right-hand sides of this workgroup
+    for(int c0 = hipBlockIdx_y * GETRS_NRHS_BLOCKSIZE; c0 < nrhs;
+        c0 += hipGridDim_y * GETRS_NRHS_BLOCKSIZE)
+    {
+        int nc = min(GETRS_NRHS_BLOCKSIZE, nrhs - c0);
+
+#pragma unroll GETRS_NRHS_BLOCKSIZE
+        for(int c = 0; c < GETRS_NRHS_BLOCKSIZE; ++c)
+            rB[c] = (c < nc) ? B[inrow + (c0 + c) * ldb] : T(0);
+
+        if(notrans)
+        {
+            // solve L*Y = P'*B, and then U*X = Y
+            getrs_small_trsv<DIM, true, true>(row, rA, rB, common);
+            getrs_small_trsv<DIM, false, false>(row, rA, rB, common);
+        }
+        else
+        {
+            // solve U'*Y = B, and then L'*Z = Y; X = P*Z
+            getrs_small_trsv<DIM, true, false>(row, rA, rB, common);
+            getrs_small_trsv<DIM, false, true>(row, rA, rB, common);
+        }
+
+        // write solution to global memory
+#pragma unroll GETRS_NRHS_BLOCKSIZE
+        for(int c = 0; c < GETRS_NRHS_BLOCKSIZE; ++c)
+        {
+            if(c < nc)
+                B[myrow + (c0 + c) * ldb] = rB[c];
+        }
+    }
+}
+
+/*************************************************************
+    Launcher of getrs_small kernels
+*************************************************************/
+template <typename T, typename U>
+rocblas_status getrs_small(rocblas_handle handle,
+                           const rocblas_operation trans,
+                           const rocblas_int n,
+                           const rocblas_int nrhs,
+                           U A,
+                           const rocblas_int shiftA,
+                           const rocblas_int lda,
+                           const rocblas_stride strideA,
+                           const rocblas_int* ipiv,
+                           const rocblas_stride strideP,
+                           U B,
+                           const rocblas_int shiftB,
+                           const rocblas_int ldb,
+                           const rocblas_stride strideB,
+                           const rocblas_int batch_count)
+{
+#define RUN_GETRS_SMALL(DIM)                                                                       \
+    ROCSOLVER_LAUNCH_KERNEL((getrs_small_kernel<DIM, T>), grid, block, lmemsize, stream, trans,    \
+                            nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, \
+                            batch_count)
+
+    // determine sizes
+    // (as many problems as fit in a wavefront are solved by each workgroup, and
+    // the blocks of right-hand sides are solved by different workgroups)
+    rocblas_int ngrp = (batch_count > 1) ? max(WAVESIZE / n, 1) : 1;
+    rocblas_int blocks = (batch_count - 1) / ngrp + 1;
+    rocblas_int rhsblocks = min((nrhs - 1) / GETRS_NRHS_BLOCKSIZE + 1, GETRS_NRHS_MAX_BLOCKS);
+    rocblas_int nthds = n;
+
+    // prepare kernel launch
+    dim3 grid(blocks, rhsblocks, 1);
+    dim3 block(nthds, ngrp, 1);
+    size_t lmemsize = GETRS_NRHS_BLOCKSIZE * ngrp * sizeof(T);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make the size n known at compile time
+    // kernel launch
+    switch(n)
+    {
+    case 1: RUN_GETRS_SMALL(1); break;
+    case 2: RUN_GETRS_SMALL(2); break;
+    case 3: RUN_GETRS_SMALL(3); break;
+    case 4: RUN_GETRS_SMALL(4); break;
+    case 5: RUN_GETRS_SMALL(5); break;
+    case 6: RUN_GETRS_SMALL(6); break;
+    case 7: RUN_GETRS_SMALL(7); break;
+    case 8: RUN_GETRS_SMALL(8); break;
+    case 9: RUN_GETRS_SMALL(9); break;
+    case 10: RUN_GETRS_SMALL(10); break;
+    case 11: RUN_GETRS_SMALL(11); break;
+    case 12: RUN_GETRS_SMALL(12); break;
+    case 13: RUN_GETRS_SMALL(13); break;
+    case 14: RUN_GETRS_SMALL(14); break;
+    case 15: RUN_GETRS_SMALL(15); break;
+    case 16: RUN_GETRS_SMALL(16); break;
+    case 17: RUN_GETRS_SMALL(17); break;
+    case 18: RUN_GETRS_SMALL(18); break;
+    case 19: RUN_GETRS_SMALL(19); break;
+    case 20: RUN_GETRS_SMALL(20); break;
+    case 21: RUN_GETRS_SMALL(21); break;
+    case 22: RUN_GETRS_SMALL(22); break;
+    case 23: RUN_GETRS_SMALL(23); break;
+    case 24: RUN_GETRS_SMALL(24); break;
+    case 25: RUN_GETRS_SMALL(25); break;
+    case 26: RUN_GETRS_SMALL(26); break;
+    case 27: RUN_GETRS_SMALL(27); break;
+    case 28: RUN_GETRS_SMALL(28); break;
+    case 29: RUN_GETRS_SMALL(29); break;
+    case 30: RUN_GETRS_SMALL(30); break;
+    case 31: RUN_GETRS_SMALL(31); break;
+    case 32: RUN_GETRS_SMALL(32); break;
+    case 33: RUN_GETRS_SMALL(33); break;
+    case 34: RUN_GETRS_SMALL(34); break;
+    case 35: RUN_GETRS_SMALL(35); break;
+    case 36: RUN_GETRS_SMALL(36); break;
+    case 37: RUN_GETRS_SMALL(37); break;
+    case 38: RUN_GETRS_SMALL(38); break;
+    case 39: RUN_GETRS_SMALL(39); break;
+    case 40: RUN_GETRS_SMALL(40); break;
+    case 41: RUN_GETRS_SMALL(41); break;
+    case 42: RUN_GETRS_SMALL(42); break;
+    case 43: RUN_GETRS_SMALL(43); break;
+    case 44: RUN_GETRS_SMALL(44); break;
+    case 45: RUN_GETRS_SMALL(45); break;
+    case 46: RUN_GETRS_SMALL(46); break;
+    case 47: RUN_GETRS_SMALL(47); break;
+    case 48: RUN_GETRS_SMALL(48); break;
+    case 49: RUN_GETRS_SMALL(49); break;
+    case 50: RUN_GETRS_SMALL(50); break;
+    case 51: RUN_GETRS_SMALL(51); break;
+    case 52: RUN_GETRS_SMALL(52); break;
+    case 53: RUN_GETRS_SMALL(53); break;
+    case 54: RUN_GETRS_SMALL(54); break;
+    case 55: RUN_GETRS_SMALL(55); break;
+    case 56: RUN_GETRS_SMALL(56); break;
+    case 57: RUN_GETRS_SMALL(57); break;
+    case 58: RUN_GETRS_SMALL(58); break;
+    case 59: RUN_GETRS_SMALL(59); break;
+    case 60: RUN_GETRS_SMALL(60); break;
+    case 61: RUN_GETRS_SMALL(61); break;
+    case 62: RUN_GETRS_SMALL(62); break;
+    case 63: RUN_GETRS_SMALL(63); break;
+    case 64: RUN_GETRS_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+#endif // OPTIMAL
+
 template <typename T>
 rocblas_status rocsolver_getrs_argCheck(const rocblas_operation trans,
                                         const rocblas_int n,
@@ -53,7 +315,12 @@ void rocsolver_getrs_getMemorySize(const rocblas_int n,
                                    size_t* size_work4)
 {
     // if quick return, no workspace is needed
-    if(n == 0 || nrhs == 0 || batch_count == 0)
+    // (and neither is it for the optimized kernel of small sizes)
+    bool small = false;
+#ifdef OPTIMAL
+    small = (n <= WAVESIZE);
+#endif
+    if(n == 0 || nrhs == 0 || batch_count == 0 || small)
     {
         *size_work1 = 0;
         *size_work2 = 0;
@@ -89,12 +356,21 @@ rocblas_status rocsolver_getrs_template(rocblas_handle handle,
                                         void* work4,
                                         bool optim_mem)
 {
+    rocsolver_stage stage(handle, "getrs");
+
     // quick return
     if(n == 0 || nrhs == 0 || batch_count == 0)
     {
         return rocblas_status_success;
     }
 
+#ifdef OPTIMAL
+    // use the optimized kernel for small sizes
+    if(n <= WAVESIZE)
+        return getrs_small<T>(handle, trans, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B,
+                              shiftB, ldb, strideB, batch_count);
+#endif
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
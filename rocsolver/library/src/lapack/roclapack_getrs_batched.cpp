@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_getrs.hpp"
+#include "logging.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_getrs_batched_impl(rocblas_handle handle,
@@ -20,7 +21,9 @@ rocblas_status rocsolver_getrs_batched_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "getrs_batched", "--transposeA", trans, "-m", n, "-n", nrhs, "A", A,
+                     "--lda", lda, "ipiv", ipiv, "--bsp", strideP, "B", B, "--ldb", ldb,
+                     "--batch", batch_count);
 
     // argument checking
     rocblas_status st = rocsolver_getrs_argCheck(trans, n, nrhs, lda, ldb, A, B, ipiv, batch_count);
@@ -14,6 +14,231 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 
+#ifdef OPTIMAL
+/////////////////////////////////////////////////////////////////////////////////////////
+// SERIES OF OPTIMIZED KERNELS FOR CHOLESKY FACTORIZATION OF SMALL SIZE MATRICES       //
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/************************************************************************
+    potf2_small_kernel takes care of matrices with
+    n <= POTF2_OPTIM_MAX_SIZE. Each thread keeps one row of the lower
+    triangular part (or one column of the upper triangular part) in registers
+************************************************************************/
+template <rocblas_int DIM, typename T, typename U>
+__global__ void __launch_bounds__(WAVESIZE) potf2_small_kernel(const rocblas_fill uplo,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               rocblas_int* infoA,
+                                                               const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    const int myrow = hipThreadIdx_x;
+    const int ty = hipThreadIdx_y;
+    const int id = hipBlockIdx_x * hipBlockDim_y + ty;
+
+    if(id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    rocblas_int* info = infoA + id;
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // shared memory (for communication between threads in group)
+    // common[0:DIM-1] holds the current column of the factor and common[DIM]
+    // the current diagonal element
+    extern __shared__ double lmem[];
+    T* common = (T*)lmem;
+    common += ty * (DIM + 1);
+
+    // local variables
+    S diag, pivot_value;
+    int myinfo = 0; // to build info
+    T rA[DIM]; // to store this-row values
+
+// read corresponding row from global memory into local array
+// (if upper, the conjugate of the corresponding column is read, i.e. the
+// lower triangular part of the same hermitian matrix)
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+    {
+        if(j <= myrow)
+            rA[j] = upper ? conj(A[j + myrow * lda]) : A[myrow + j * lda];
+        else
+            rA[j] = 0;
+    }
+
+// for each column (main loop)
+#pragma unroll DIM
+    for(int k = 0; k < DIM; ++k)
+    {
+        // share diagonal element
+        if(myrow == k)
+            common[DIM] = rA[k];
+        __syncthreads();
+
+        // check for non-positive-definiteness and scale value for current column
+        diag = std::real(common[DIM]);
+        if(diag > 0)
+        {
+            diag = sqrt(diag);
+            pivot_value = S(1) / diag;
+        }
+        else
+        {
+            if(myinfo == 0)
+                myinfo = k + 1; // use fortran 1-based index
+            pivot_value = 0;
+        }
+
+        // scale current column and share it
+        if(myrow == k)
+            rA[k] = diag;
+        else if(myrow > k)
+        {
+            rA[k] *= pivot_value;
+            common[myrow] = rA[k];
+        }
+        __syncthreads();
+
+        // update trailing matrix
+        if(myrow > k)
+        {
+            for(int j = k + 1; j < DIM; ++j)
+                rA[j] -= rA[k] * conj(common[j]);
+        }
+    }
+
+    // write results to global memory
+    if(myrow == 0)
+        *info = myinfo;
+#pragma unroll DIM
+    for(int j = 0; j < DIM; ++j)
+    {
+        if(j <= myrow)
+        {
+            if(upper)
+                A[j + myrow * lda] = conj(rA[j]);
+            else
+                A[myrow + j * lda] = rA[j];
+        }
+    }
+}
+
+/*************************************************************
+    Launcher of potf2_small kernels
+*************************************************************/
+template <typename T, typename U>
+rocblas_status potf2_small(rocblas_handle handle,
+                           const rocblas_fill uplo,
+                           const rocblas_int n,
+                           U A,
+                           const rocblas_int shiftA,
+                           const rocblas_int lda,
+                           const rocblas_stride strideA,
+                           rocblas_int* info,
+                           const rocblas_int batch_count)
+{
+#define RUN_POTF2_SMALL(DIM)                                                                   \
+    ROCSOLVER_LAUNCH_KERNEL((potf2_small_kernel<DIM, T>), grid, block, lmemsize, stream, uplo, \
+                            A, shiftA, lda, strideA, info, batch_count)
+
+    // determine sizes
+    std::vector<int> opval{POTF2_OPTIM_NGRP};
+    rocblas_int ngrp = (batch_count < 2 || n > 32) ? 1 : opval[n - 1];
+    rocblas_int blocks = (batch_count - 1) / ngrp + 1;
+    rocblas_int nthds = n;
+
+    // prepare kernel launch
+    dim3 grid(blocks, 1, 1);
+    dim3 block(nthds, ngrp, 1);
+    size_t lmemsize = (n + 1) * ngrp * sizeof(T);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make number of columns n known at compile time
+    // this should allow loop unrolling.
+    // kernel launch
+    switch(n)
+    {
+    case 1: RUN_POTF2_SMALL(1); break;
+    case 2: RUN_POTF2_SMALL(2); break;
+    case 3: RUN_POTF2_SMALL(3); break;
+    case 4: RUN_POTF2_SMALL(4); break;
+    case 5: RUN_POTF2_SMALL(5); break;
+    case 6: RUN_POTF2_SMALL(6); break;
+    case 7: RUN_POTF2_SMALL(7); break;
+    case 8: RUN_POTF2_SMALL(8); break;
+    case 9: RUN_POTF2_SMALL(9); break;
+    case 10: RUN_POTF2_SMALL(10); break;
+    case 11: RUN_POTF2_SMALL(11); break;
+    case 12: RUN_POTF2_SMALL(12); break;
+    case 13: RUN_POTF2_SMALL(13); break;
+    case 14: RUN_POTF2_SMALL(14); break;
+    case 15: RUN_POTF2_SMALL(15); break;
+    case 16: RUN_POTF2_SMALL(16); break;
+    case 17: RUN_POTF2_SMALL(17); break;
+    case 18: RUN_POTF2_SMALL(18); break;
+    case 19: RUN_POTF2_SMALL(19); break;
+    case 20: RUN_POTF2_SMALL(20); break;
+    case 21: RUN_POTF2_SMALL(21); break;
+    case 22: RUN_POTF2_SMALL(22); break;
+    case 23: RUN_POTF2_SMALL(23); break;
+    case 24: RUN_POTF2_SMALL(24); break;
+    case 25: RUN_POTF2_SMALL(25); break;
+    case 26: RUN_POTF2_SMALL(26); break;
+    case 27: RUN_POTF2_SMALL(27); break;
+    case 28: RUN_POTF2_SMALL(28); break;
+    case 29: RUN_POTF2_SMALL(29); break;
+    case 30: RUN_POTF2_SMALL(30); break;
+    case 31: RUN_POTF2_SMALL(31); break;
+    case 32: RUN_POTF2_SMALL(32); break;
+    case 33: RUN_POTF2_SMALL(33); break;
+    case 34: RUN_POTF2_SMALL(34); break;
+    case 35: RUN_POTF2_SMALL(35); break;
+    case 36: RUN_POTF2_SMALL(36); break;
+    case 37: RUN_POTF2_SMALL(37); break;
+    case 38: RUN_POTF2_SMALL(38); break;
+    case 39: RUN_POTF2_SMALL(39); break;
+    case 40: RUN_POTF2_SMALL(40); break;
+    case 41: RUN_POTF2_SMALL(41); break;
+    case 42: RUN_POTF2_SMALL(42); break;
+    case 43: RUN_POTF2_SMALL(43); break;
+    case 44: RUN_POTF2_SMALL(44); break;
+    case 45: RUN_POTF2_SMALL(45); break;
+    case 46: RUN_POTF2_SMALL(46); break;
+    case 47: RUN_POTF2_SMALL(47); break;
+    case 48: RUN_POTF2_SMALL(48); break;
+    case 49: RUN_POTF2_SMALL(49); break;
+    case 50: RUN_POTF2_SMALL(50); break;
+    case 51: RUN_POTF2_SMALL(51); break;
+    case 52: RUN_POTF2_SMALL(52); break;
+    case 53: RUN_POTF2_SMALL(53); break;
+    case 54: RUN_POTF2_SMALL(54); break;
+    case 55: RUN_POTF2_SMALL(55); break;
+    case 56: RUN_POTF2_SMALL(56); break;
+    case 57: RUN_POTF2_SMALL(57); break;
+    case 58: RUN_POTF2_SMALL(58); break;
+    case 59: RUN_POTF2_SMALL(59); break;
+    case 60: RUN_POTF2_SMALL(60); break;
+    case 61: RUN_POTF2_SMALL(61); break;
+    case 62: RUN_POTF2_SMALL(62); break;
+    case 63: RUN_POTF2_SMALL(63); break;
+    case 64: RUN_POTF2_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//                      END OF OPTIMIZED KERNELS                                        //
+//////////////////////////////////////////////////////////////////////////////////////////
+#endif // OPTIMAL
+
 template <typename T, typename U, std::enable_if_t<!is_complex<T>, int> = 0>
 __global__ void sqrtDiagOnward(U A,
                                const rocblas_int shiftA,
@@ -79,21 +304,26 @@ __global__ void sqrtDiagOnward(U A,
 template <typename T>
 void rocsolver_potf2_getMemorySize(const rocblas_int n,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work,
                                    size_t* size_pivots)
 {
     // if quick return no need of workspace
     if(n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work = 0;
         *size_pivots = 0;
         return;
     }
 
-    // size of scalars (constants)
-    *size_scalars = sizeof(T) * 3;
+#ifdef OPTIMAL
+    // if using optimized algorithm for small sizes, no workspace needed
+    if(n <= POTF2_OPTIM_MAX_SIZE)
+    {
+        *size_work = 0;
+        *size_pivots = 0;
+        return;
+    }
+#endif
 
     // size of workspace
     *size_work = sizeof(T) * ((n - 1) / ROCBLAS_DOT_NB + 2) * batch_count;
@@ -141,6 +371,8 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
                                         T* work,
                                         T* pivots)
 {
+    rocsolver_stage stage(handle, "potf2");
+
     // quick return if zero instances in batch
     if(batch_count == 0)
         return rocblas_status_success;
@@ -153,12 +385,18 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
     dim3 threads(BLOCKSIZE, 1, 1);
 
     // info=0 (starting with a positive definite matrix)
-    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
 
     // quick return if no dimensions
     if(n == 0)
         return rocblas_status_success;
 
+#ifdef OPTIMAL
+    // Use optimized Cholesky factorization for the right sizes
+    if(n <= POTF2_OPTIM_MAX_SIZE)
+        return potf2_small<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count);
+#endif
+
     // everything must be executed with scalars on the device
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
@@ -174,8 +412,8 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
                                         shiftA + idx2D(0, j, lda), 1, strideA, batch_count, pivots,
                                         work);
 
-            hipLaunchKernelGGL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, A, shiftA,
-                               strideA, idx2D(j, j, lda), j, pivots, info);
+            ROCSOLVER_LAUNCH_KERNEL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, A,
+                                    shiftA, strideA, idx2D(j, j, lda), j, pivots, info);
 
             // Compute elements J+1:N of row J
             if(j < n - 1)
@@ -210,8 +448,8 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
                                         shiftA + idx2D(j, 0, lda), lda, strideA, batch_count,
                                         pivots, work);
 
-            hipLaunchKernelGGL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, A, shiftA,
-                               strideA, idx2D(j, j, lda), j, pivots, info);
+            ROCSOLVER_LAUNCH_KERNEL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, A,
+                                    shiftA, strideA, idx2D(j, j, lda), j, pivots, info);
 
             // Compute elements J+1:N of row J
             if(j < n - 1)
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_potf2.hpp"
+#include "logging.hpp"
 
 template <typename T, typename U>
 rocblas_status rocsolver_potf2_batched_impl(rocblas_handle handle,
@@ -16,7 +17,8 @@ rocblas_status rocsolver_potf2_batched_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "potf2_batched", "--uplo", uplo, "-n", n, "A", A, "--lda", lda,
+                     "info", info, "--batch", batch_count);
 
     // argument checking
     rocblas_status st = rocsolver_potf2_potrf_argCheck(uplo, n, lda, A, info, batch_count);
@@ -30,33 +32,32 @@ rocblas_status rocsolver_potf2_batched_impl(rocblas_handle handle,
     rocblas_stride strideA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of reusable workspace
     size_t size_work;
     // size to store pivots in intermediate computations
     size_t size_pivots;
-    rocsolver_potf2_getMemorySize<T>(n, batch_count, &size_scalars, &size_work, &size_pivots);
+    rocsolver_potf2_getMemorySize<T>(n, batch_count, &size_work, &size_pivots);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_pivots);
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_pivots);
 
     // memory workspace allocation
-    void *scalars, *work, *pivots;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_pivots);
+    void *work, *pivots;
+    rocblas_device_malloc mem(handle, size_work, size_pivots);
 
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work = mem[1];
-    pivots = mem[2];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work = mem[0];
+    pivots = mem[1];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_potf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count,
-                                       (T*)scalars, (T*)work, (T*)pivots);
+                                       scalars, (T*)work, (T*)pivots);
 }
 
 /*
@@ -27,7 +27,6 @@ template <bool BATCHED, typename T>
 void rocsolver_potrf_getMemorySize(const rocblas_int n,
                                    const rocblas_fill uplo,
                                    const rocblas_int batch_count,
-                                   size_t* size_scalars,
                                    size_t* size_work1,
                                    size_t* size_work2,
                                    size_t* size_work3,
@@ -38,7 +37,6 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n,
     // if quick return no need of workspace
     if(n == 0 || batch_count == 0)
     {
-        *size_scalars = 0;
         *size_work1 = 0;
         *size_work2 = 0;
         *size_work3 = 0;
@@ -48,10 +46,11 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n,
         return;
     }
 
-    if(n < POTRF_POTF2_SWITCHSIZE)
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_potrf_switchsize, n);
+    if(n < nb)
     {
         // requirements for calling a single POTF2
-        rocsolver_potf2_getMemorySize<T>(n, batch_count, size_scalars, size_work1, size_pivots);
+        rocsolver_potf2_getMemorySize<T>(n, batch_count, size_work1, size_pivots);
         *size_work2 = 0;
         *size_work3 = 0;
         *size_work4 = 0;
@@ -59,14 +58,14 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n,
     }
     else
     {
-        rocblas_int jb = POTRF_POTF2_SWITCHSIZE;
+        rocblas_int jb = nb;
         size_t s1, s2;
 
         // size to store info about positiveness of each subblock
         *size_iinfo = sizeof(rocblas_int) * batch_count;
 
         // requirements for calling POTF2 for the subblocks
-        rocsolver_potf2_getMemorySize<T>(jb, batch_count, size_scalars, &s1, size_pivots);
+        rocsolver_potf2_getMemorySize<T>(jb, batch_count, &s1, size_pivots);
 
         // extra requirements for calling TRSM
         if(uplo == rocblas_fill_upper)
@@ -99,6 +98,8 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
                                         rocblas_int* iinfo,
                                         bool optim_mem)
 {
+    rocsolver_stage stage(handle, "potrf");
+
     // quick return
     if(batch_count == 0)
         return rocblas_status_success;
@@ -111,7 +112,7 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     dim3 threads(BLOCKSIZE, 1, 1);
 
     // info=0 (starting with a positive definite matrix)
-    hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
 
     // quick return
     if(n == 0)
@@ -124,7 +125,8 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
 
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the
     // algorithm
-    if(n < POTRF_POTF2_SWITCHSIZE)
+    rocblas_int nb = rocsolver_get_tuning<T>(rocsolver_tuning_potrf_switchsize, n);
+    if(n < nb)
         return rocsolver_potf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, info,
                                            batch_count, scalars, (T*)work1, pivots);
 
@@ -138,17 +140,18 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     if(uplo == rocblas_fill_upper)
     {
         // Compute the Cholesky factorization A = U'*U.
-        for(rocblas_int j = 0; j < n; j += POTRF_POTF2_SWITCHSIZE)
+        for(rocblas_int j = 0; j < n; j += nb)
         {
             // Factor diagonal and subdiagonal blocks
-            jb = min(n - j, POTRF_POTF2_SWITCHSIZE); // number of columns in the block
-            hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
+            jb = min(n - j, nb); // number of columns in the block
+            ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count,
+                                    0);
             rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
                                         strideA, iinfo, batch_count, scalars, (T*)work1, pivots);
 
             // test for non-positive-definiteness.
-            hipLaunchKernelGGL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
-                               batch_count);
+            ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
+                                    batch_count);
 
             if(j + jb < n)
             {
@@ -169,17 +172,18 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     else
     {
         // Compute the Cholesky factorization A = L*L'.
-        for(rocblas_int j = 0; j < n; j += POTRF_POTF2_SWITCHSIZE)
+        for(rocblas_int j = 0; j < n; j += nb)
         {
             // Factor diagonal and subdiagonal blocks
-            jb = min(n - j, POTRF_POTF2_SWITCHSIZE); // number of columns in the block
-            hipLaunchKernelGGL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
+            jb = min(n - j, nb); // number of columns in the block
+            ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count,
+                                    0);
             rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
                                         strideA, iinfo, batch_count, scalars, (T*)work1, pivots);
 
             // test for non-positive-definiteness.
-            hipLaunchKernelGGL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
-                               batch_count);
+            ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
+                                    batch_count);
 
             if(j + jb < n)
             {
@@ -3,6 +3,7 @@
  * ************************************************************************ */
 
 #include "roclapack_potrf.hpp"
+#include "logging.hpp"
 
 template <typename S, typename T, typename U>
 rocblas_status rocsolver_potrf_strided_batched_impl(rocblas_handle handle,
@@ -17,7 +18,8 @@ rocblas_status rocsolver_potrf_strided_batched_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // logging is missing ???
+    rocsolver_log<T>(handle, "potrf_strided_batched", "--uplo", uplo, "-n", n, "A", A, "--lda", lda,
+                     "--bsa", strideA, "info", info, "--batch", batch_count);
 
     // argument checking
     rocblas_status st = rocsolver_potf2_potrf_argCheck(uplo, n, lda, A, info, batch_count);
@@ -28,48 +30,45 @@ rocblas_status rocsolver_potrf_strided_batched_impl(rocblas_handle handle,
     rocblas_int shiftA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
-    size_t size_scalars;
     // size of reusable workspace (and for calling TRSM)
     size_t size_work1, size_work2, size_work3, size_work4;
     // extra requirements for calling POTF2
     size_t size_pivots;
     // size to store info about positiveness of each subblock
     size_t size_iinfo;
-    rocsolver_potrf_getMemorySize<false, T>(n, uplo, batch_count, &size_scalars, &size_work1,
-                                            &size_work2, &size_work3, &size_work4, &size_pivots,
-                                            &size_iinfo);
+    rocsolver_potrf_getMemorySize<false, T>(n, uplo, batch_count, &size_work1, &size_work2,
+                                            &size_work3, &size_work4, &size_pivots, &size_iinfo);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
-                                                      size_work3, size_work4, size_pivots,
-                                                      size_iinfo);
+        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+                                                      size_work4, size_pivots, size_iinfo);
 
     // always allocate all required memory for TRSM optimal performance
     bool optim_mem = true;
 
     // memory workspace allocation
-    void *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
-                              size_pivots, size_iinfo);
+    void *work1, *work2, *work3, *work4, *pivots, *iinfo;
+    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_pivots,
+                              size_iinfo);
 
     if(!mem)
         return rocblas_status_memory_error;
 
-    scalars = mem[0];
-    work1 = mem[1];
-    work2 = mem[2];
-    work3 = mem[3];
-    work4 = mem[4];
-    pivots = mem[5];
-    iinfo = mem[6];
-    T sca[] = {-1, 0, 1};
-    RETURN_IF_HIP_ERROR(hipMemcpy((T*)scalars, sca, size_scalars, hipMemcpyHostToDevice));
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    pivots = mem[4];
+    iinfo = mem[5];
+    // constants {-1, 0, 1} to use in rocblas calls
+    T* scalars = rocsolver_get_constants<T>();
+    if(!scalars)
+        return rocblas_status_internal_error;
 
     // execution
     return rocsolver_potrf_template<false, S, T>(handle, uplo, n, A, shiftA, lda, strideA, info,
-                                                 batch_count, (T*)scalars, work1, work2, work3,
-                                                 work4, (T*)pivots, (rocblas_int*)iinfo, optim_mem);
+                                                 batch_count, scalars, work1, work2, work3, work4,
+                                                 (T*)pivots, (rocblas_int*)iinfo, optim_mem);
 }
 
 /*
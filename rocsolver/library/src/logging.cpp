@@ -0,0 +1,393 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "logging.hpp"
+#include "rocsolver.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+rocsolver_ostream open_log(const char* var)
+{
+    const char* path = std::getenv(var);
+    return path ? rocsolver_ostream(path) : rocsolver_ostream(STDERR_FILENO);
+}
+
+class logger
+{
+    std::mutex mtx;
+    std::map<std::string, rocblas_int> profile;
+
+    // (mutex must be held)
+    void write_profile()
+    {
+        if(profile.empty())
+            return;
+
+        auto os = profile_os.dup();
+        for(const auto& p : profile)
+            os << "- {" << p.first << ", call_count: " << p.second << "}\n";
+        os << std::flush;
+    }
+
+public:
+    int mode = rocblas_layer_mode_none;
+    bool chrome_trace = false;
+    rocsolver_ostream trace_os, bench_os, profile_os, stages_os;
+
+    logger()
+    {
+        const char* layer = std::getenv("ROCSOLVER_LAYER");
+        if(layer)
+            mode = std::strtol(layer, nullptr, 0);
+
+        if(mode & rocblas_layer_mode_log_trace)
+            trace_os = open_log("ROCSOLVER_LOG_TRACE_PATH");
+        if(mode & rocblas_layer_mode_log_bench)
+            bench_os = open_log("ROCSOLVER_LOG_BENCH_PATH");
+        if(mode & rocblas_layer_mode_log_profile)
+            profile_os = open_log("ROCSOLVER_LOG_PROFILE_PATH");
+        if(mode & rocsolver_layer_mode_log_stages)
+        {
+            const char* format = std::getenv("ROCSOLVER_LOG_STAGES_FORMAT");
+            chrome_trace = format && !std::strcmp(format, "chrome");
+            stages_os = open_log("ROCSOLVER_LOG_STAGES_PATH");
+
+            // the events of a Chrome trace are the elements of a JSON array
+            // (the closing bracket is optional)
+            if(chrome_trace)
+                stages_os << "[" << std::endl;
+        }
+    }
+
+    // the calls counted since the last handle was destroyed with
+    // rocsolver_destroy_handle are written at exit
+    ~logger()
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        write_profile();
+    }
+
+    // (the calls of all the handles are counted together, as the handles destroyed
+    // with rocblas_destroy_handle are not seen, and their addresses can be reused)
+    void count(const std::string& call)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        profile[call]++;
+    }
+
+    void flush()
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        write_profile();
+        profile.clear();
+    }
+};
+
+logger& get_logger()
+{
+    static logger log;
+    return log;
+}
+
+/*************************************************************
+    Stages and counters
+*************************************************************/
+
+struct stage_node
+{
+    std::string name;
+    hipStream_t stream;
+    hipEvent_t start, stop;
+    stage_node* parent;
+    std::vector<std::unique_ptr<stage_node>> children;
+
+    ~stage_node()
+    {
+        hipEventDestroy(start);
+        hipEventDestroy(stop);
+    }
+};
+
+// the call being made by each thread
+// (the counters of the last call that it completed are kept with it, so that
+// they are stored and read without locks)
+struct stage_call
+{
+    rocblas_handle handle = nullptr;
+    int depth = 0;
+    rocsolver_call_counters counters = {};
+    size_t memory_size = 0;
+    rocblas_handle last_handle = nullptr;
+    rocsolver_call_counters last_counters = {};
+
+    // (stages mode)
+    std::string func, args;
+    std::unique_ptr<stage_node> root;
+    stage_node* current = nullptr;
+    int tid = 0;
+};
+
+std::atomic<int> stage_threads(0);
+thread_local stage_call this_call;
+
+// rocBLAS allocates device memory when the memory of the handle has to grow
+void count_allocations(stage_call& call)
+{
+    size_t size = 0;
+    rocblas_get_device_memory_size(call.handle, &size);
+    if(size > call.memory_size)
+    {
+        call.counters.allocations++;
+        call.memory_size = size;
+    }
+}
+
+float elapsed_us(hipEvent_t start, hipEvent_t stop)
+{
+    float ms = 0;
+    hipEventElapsedTime(&ms, start, stop);
+    return 1000 * ms;
+}
+
+// the timestamps of the Chrome trace are taken from the first recorded event
+hipEvent_t trace_origin()
+{
+    static hipEvent_t origin = [] {
+        hipEvent_t e;
+        hipEventCreate(&e);
+        hipEventRecord(e, 0);
+        return e;
+    }();
+    return origin;
+}
+
+// writes the node and its children as complete ("X") events
+void write_chrome_events(std::ostringstream& os, const stage_node* node, const stage_call& call)
+{
+    os << "{\"name\": \"" << node->name << "\", \"cat\": \"rocsolver\", \"ph\": \"X\", \"ts\": "
+       << elapsed_us(trace_origin(), node->start)
+       << ", \"dur\": " << elapsed_us(node->start, node->stop) << ", \"pid\": 0, \"tid\": "
+       << call.tid;
+    if(node == call.root.get())
+        os << ", \"args\": {\"call\": \"" << call.func << "\", \"arguments\": \"" << call.args
+           << "\"}";
+    os << "},\n";
+
+    for(const auto& child : node->children)
+        write_chrome_events(os, child.get(), call);
+}
+
+// writes the stages with the same name, at the same depth and with the same
+// parent stage name, as a single stage with the sum of their durations
+void write_json_stages(std::ostringstream& os, const std::vector<const stage_node*>& nodes)
+{
+    float time = 0;
+    std::vector<std::string> names;
+    std::map<std::string, std::vector<const stage_node*>> children;
+    for(const stage_node* node : nodes)
+    {
+        time += elapsed_us(node->start, node->stop);
+        for(const auto& child : node->children)
+        {
+            auto& group = children[child->name];
+            if(group.empty())
+                names.push_back(child->name);
+            group.push_back(child.get());
+        }
+    }
+
+    os << "{\"name\": \"" << nodes[0]->name << "\", \"calls\": " << nodes.size()
+       << ", \"time_us\": " << time;
+    if(!names.empty())
+    {
+        os << ", \"stages\": [";
+        for(size_t i = 0; i < names.size(); ++i)
+        {
+            if(i > 0)
+                os << ", ";
+            write_json_stages(os, children[names[i]]);
+        }
+        os << "]";
+    }
+    os << "}";
+}
+}
+
+int rocsolver_log_mode()
+{
+    return get_logger().mode;
+}
+
+void rocsolver_log_write(const int mode, const std::string& line)
+{
+    logger& log = get_logger();
+    rocsolver_ostream* os = &log.stages_os;
+    if(mode == rocblas_layer_mode_log_trace)
+        os = &log.trace_os;
+    else if(mode == rocblas_layer_mode_log_bench)
+        os = &log.bench_os;
+    else if(mode == rocblas_layer_mode_log_profile)
+        os = &log.profile_os;
+
+    // every thread writes through its own duplicate of the stream
+    auto out = os->dup();
+    out << line << std::endl;
+}
+
+void rocsolver_log_profile(const std::string& call)
+{
+    get_logger().count(call);
+}
+
+void rocsolver_log_release(const rocblas_handle handle)
+{
+    if(get_logger().mode & rocblas_layer_mode_log_profile)
+        get_logger().flush();
+
+    stage_call& call = this_call;
+    if(call.last_handle == handle)
+    {
+        call.last_handle = nullptr;
+        call.last_counters = {};
+    }
+}
+
+void rocsolver_log_stages_call(const std::string& func, const std::string& args)
+{
+    this_call.func = func;
+    this_call.args = args;
+}
+
+void rocsolver_call_begin(const rocblas_handle handle)
+{
+    stage_call& call = this_call;
+    if(call.depth > 0)
+        return;
+
+    call.handle = handle;
+    call.counters = {};
+    rocblas_get_device_memory_size(handle, &call.memory_size);
+}
+
+void rocsolver_count_kernel_launch()
+{
+    this_call.counters.kernel_launches++;
+}
+
+void rocsolver_count_memcpy()
+{
+    this_call.counters.memcpys++;
+}
+
+void rocsolver_stage_begin(const rocblas_handle handle, const char* name)
+{
+    stage_call& call = this_call;
+    if(call.depth++ == 0)
+    {
+        // the workspace of the call has been allocated before its outermost stage
+        call.handle = handle;
+        count_allocations(call);
+    }
+    if(!std::strncmp(name, "rocblas_", 8))
+        call.counters.rocblas_calls++;
+
+    if(!(rocsolver_log_mode() & rocsolver_layer_mode_log_stages))
+        return;
+
+    auto node = std::make_unique<stage_node>();
+    node->name = name;
+    node->parent = call.current;
+    rocblas_get_stream(handle, &node->stream);
+    hipEventCreate(&node->start);
+    hipEventCreate(&node->stop);
+
+    if(!call.current && get_logger().chrome_trace)
+        trace_origin();
+    hipEventRecord(node->start, node->stream);
+
+    stage_node* current = node.get();
+    if(call.current)
+        call.current->children.push_back(std::move(node));
+    else
+        call.root = std::move(node);
+    call.current = current;
+}
+
+void rocsolver_stage_end()
+{
+    stage_call& call = this_call;
+    bool timed = rocsolver_log_mode() & rocsolver_layer_mode_log_stages;
+    stage_node* node = call.current;
+    if(timed)
+    {
+        hipEventRecord(node->stop, node->stream);
+        call.current = node->parent;
+    }
+
+    if(--call.depth > 0)
+        return;
+
+    // the outermost stage has ended; keep the counters of the call
+    count_allocations(call);
+    call.last_handle = call.handle;
+    call.last_counters = call.counters;
+    if(!timed)
+        return;
+
+    // wait for the call to finish and write its stages
+    hipEventSynchronize(node->stop);
+    if(call.tid == 0)
+        call.tid = ++stage_threads;
+
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3);
+    if(get_logger().chrome_trace)
+    {
+        write_chrome_events(os, node, call);
+        std::string events = os.str();
+        events.pop_back();
+        rocsolver_log_write(rocsolver_layer_mode_log_stages, events);
+    }
+    else
+    {
+        os << "{\"call\": \"" << call.func << "\", \"arguments\": \"" << call.args
+           << "\", \"time_us\": " << elapsed_us(node->start, node->stop) << ", \"stages\": [";
+        write_json_stages(os, {node});
+        os << "]}";
+        rocsolver_log_write(rocsolver_layer_mode_log_stages, os.str());
+    }
+
+    call.root.reset();
+    call.func.clear();
+    call.args.clear();
+}
+
+/*************************************************************
+    Call counters API
+*************************************************************/
+
+extern "C" {
+
+rocblas_status rocsolver_get_call_counters(rocblas_handle handle,
+                                           rocsolver_call_counters* counters)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!counters)
+        return rocblas_status_invalid_pointer;
+
+    const stage_call& call = this_call;
+    *counters = (call.last_handle == handle) ? call.last_counters : rocsolver_call_counters{};
+    return rocblas_status_success;
+}
+}
@@ -0,0 +1,59 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "side_stream.hpp"
+#include <hip/hip_runtime.h>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+// the pool only grows up to the number of calls that use a secondary stream
+// concurrently on each device, and is not tied to the lifetime of the handles
+// (the streams are not destroyed at exit, when the runtime may already be gone)
+std::mutex mtx;
+std::map<int, std::vector<rocsolver_side_stream>> side_streams;
+}
+
+bool rocsolver_acquire_side_stream(rocsolver_side_stream* side)
+{
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        std::vector<rocsolver_side_stream>& pool = side_streams[device];
+        if(!pool.empty())
+        {
+            *side = pool.back();
+            pool.pop_back();
+            return true;
+        }
+    }
+
+    // (the stream does not synchronize with the null stream, so that it
+    // can run concurrently with a handle that uses it)
+    *side = {device, nullptr, {}};
+    bool created = hipStreamCreateWithFlags(&side->stream, hipStreamNonBlocking) == hipSuccess;
+    for(hipEvent_t& event : side->events)
+        created = created && hipEventCreateWithFlags(&event, hipEventDisableTiming) == hipSuccess;
+    if(!created)
+    {
+        for(hipEvent_t event : side->events)
+            if(event)
+                hipEventDestroy(event);
+        if(side->stream)
+            hipStreamDestroy(side->stream);
+        return false;
+    }
+    return true;
+}
+
+void rocsolver_release_side_stream(const rocsolver_side_stream& side)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    side_streams[side.device].push_back(side);
+}
@@ -0,0 +1,443 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "tuning.hpp"
+#include "ideal_sizes.hpp"
+#include "rocsolver.h"
+#include <cstdlib>
+#include <fstream>
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+ * Tuning table
+ *
+ * Each entry of the table has the form
+ *
+ *     arch  precision  parameter  min_size  max_size  value
+ *
+ * where arch is the name of the architecture (e.g. gfx908), precision is one
+ * of s, d, c or z, parameter is the name of a rocsolver_tuning_param without
+ * the rocsolver_tuning_ prefix (e.g. getrf_switchsize), and the entry applies
+ * to the problem sizes in [min_size, max_size]. A '*' in place of arch,
+ * precision or max_size matches any value. Everything after a '#' is a comment.
+ *
+ * When more than one entry matches, the one with the most specific arch and
+ * precision is used, and among those, the last one that was added.
+ ******************************************************************************/
+
+namespace
+{
+struct tuning_entry
+{
+    std::string arch; // empty means any architecture
+    rocblas_datatype precision; // rocblas_datatype(-1) means any precision
+    rocsolver_tuning_param param;
+    rocblas_int min_size;
+    rocblas_int max_size; // negative means no upper bound
+    rocblas_int value;
+};
+
+struct tuning_name
+{
+    rocsolver_tuning_param param;
+    const char* name;
+};
+
+constexpr rocblas_datatype any_precision = rocblas_datatype(-1);
+
+constexpr tuning_name tuning_names[] = {
+    {rocsolver_tuning_getrf_switchsize, "getrf_switchsize"},
+    {rocsolver_tuning_getf2_optim_ngrp, "getf2_optim_ngrp"},
+    {rocsolver_tuning_potrf_switchsize, "potrf_switchsize"},
+    {rocsolver_tuning_geqxf_switchsize, "geqxf_switchsize"},
+    {rocsolver_tuning_geqxf_blocksize, "geqxf_blocksize"},
+    {rocsolver_tuning_gexqf_switchsize, "gexqf_switchsize"},
+    {rocsolver_tuning_gexqf_blocksize, "gexqf_blocksize"},
+    {rocsolver_tuning_orgxx_switchsize, "orgxx_switchsize"},
+    {rocsolver_tuning_orgxx_blocksize, "orgxx_blocksize"},
+    {rocsolver_tuning_getri_switchsize_mid, "getri_switchsize_mid"},
+    {rocsolver_tuning_getri_switchsize_large, "getri_switchsize_large"},
+    {rocsolver_tuning_getri_blocksize, "getri_blocksize"},
+    {rocsolver_tuning_ormxx_blocksize, "ormxx_blocksize"},
+    {rocsolver_tuning_gebrd_switchsize, "gebrd_switchsize"},
+    {rocsolver_tuning_getrf_lookahead_switchsize, "getrf_lookahead_switchsize"},
+    {rocsolver_tuning_getrf_tslu_switchsize, "getrf_tslu_switchsize"},
+    {rocsolver_tuning_gesvd_bdsdc_switchsize, "gesvd_bdsdc_switchsize"},
+};
+
+bool valid_param(const rocsolver_tuning_param param)
+{
+    for(const auto& t : tuning_names)
+        if(t.param == param)
+            return true;
+    return false;
+}
+
+bool valid_precision(const rocblas_datatype precision)
+{
+    return precision == rocblas_datatype_f32_r || precision == rocblas_datatype_f64_r
+        || precision == rocblas_datatype_f32_c || precision == rocblas_datatype_f64_c;
+}
+
+// compiled defaults
+rocblas_int default_value(const rocsolver_tuning_param param, const rocblas_int size)
+{
+    switch(param)
+    {
+    case rocsolver_tuning_getrf_switchsize: return GETRF_GETF2_SWITCHSIZE;
+    case rocsolver_tuning_getf2_optim_ngrp:
+    {
+        constexpr rocblas_int opval[] = {GETF2_OPTIM_NGRP};
+        constexpr rocblas_int nval = sizeof(opval) / sizeof(rocblas_int);
+        return (size >= 1 && size <= nval) ? opval[size - 1] : 1;
+    }
+    case rocsolver_tuning_potrf_switchsize: return POTRF_POTF2_SWITCHSIZE;
+    case rocsolver_tuning_geqxf_switchsize: return GEQxF_GEQx2_SWITCHSIZE;
+    case rocsolver_tuning_geqxf_blocksize: return GEQxF_GEQx2_BLOCKSIZE;
+    case rocsolver_tuning_gexqf_switchsize: return GExQF_GExQ2_SWITCHSIZE;
+    case rocsolver_tuning_gexqf_blocksize: return GExQF_GExQ2_BLOCKSIZE;
+    case rocsolver_tuning_orgxx_switchsize: return ORGxx_UNGxx_SWITCHSIZE;
+    case rocsolver_tuning_orgxx_blocksize: return ORGxx_UNGxx_BLOCKSIZE;
+    case rocsolver_tuning_getri_switchsize_mid: return GETRI_SWITCHSIZE_MID;
+    case rocsolver_tuning_getri_switchsize_large: return GETRI_SWITCHSIZE_LARGE;
+    case rocsolver_tuning_getri_blocksize: return GETRI_BLOCKSIZE;
+    case rocsolver_tuning_ormxx_blocksize: return ORMxx_ORMxx_BLOCKSIZE;
+    case rocsolver_tuning_gebrd_switchsize: return GEBRD_GEBD2_SWITCHSIZE;
+    case rocsolver_tuning_getrf_lookahead_switchsize: return GETRF_LOOKAHEAD_SWITCHSIZE;
+    case rocsolver_tuning_getrf_tslu_switchsize: return GETRF_TSLU_SWITCHSIZE;
+    case rocsolver_tuning_gesvd_bdsdc_switchsize: return GESVD_BDSDC_SWITCHSIZE;
+    }
+    return 1;
+}
+
+bool parse_int(const std::string& str, rocblas_int& val)
+{
+    char* end;
+    long v = std::strtol(str.c_str(), &end, 10);
+    if(str.empty() || *end != '\0' || v < 0 || v > std::numeric_limits<rocblas_int>::max())
+        return false;
+    val = rocblas_int(v);
+    return true;
+}
+
+// parses one line of a tuning table; returns false if the line is malformed
+// (empty lines and comments produce no entry)
+bool parse_line(std::string line, std::vector<tuning_entry>& entries)
+{
+    line = line.substr(0, line.find('#'));
+    std::istringstream in(line);
+    std::vector<std::string> tok;
+    std::string s;
+    while(in >> s)
+        tok.push_back(s);
+
+    if(tok.empty())
+        return true;
+    if(tok.size() != 6)
+        return false;
+
+    tuning_entry e;
+    e.arch = (tok[0] == "*") ? "" : tok[0];
+
+    if(tok[1] == "*")
+        e.precision = any_precision;
+    else if(tok[1] == "s")
+        e.precision = rocblas_datatype_f32_r;
+    else if(tok[1] == "d")
+        e.precision = rocblas_datatype_f64_r;
+    else if(tok[1] == "c")
+        e.precision = rocblas_datatype_f32_c;
+    else if(tok[1] == "z")
+        e.precision = rocblas_datatype_f64_c;
+    else
+        return false;
+
+    bool found = false;
+    for(const auto& t : tuning_names)
+    {
+        if(tok[2] == t.name)
+        {
+            e.param = t.param;
+            found = true;
+        }
+    }
+    if(!found)
+        return false;
+
+    if(!parse_int(tok[3], e.min_size))
+        return false;
+    if(tok[4] == "*")
+        e.max_size = -1;
+    else if(!parse_int(tok[4], e.max_size) || e.max_size < e.min_size)
+        return false;
+    if(!parse_int(tok[5], e.value) || e.value < 1)
+        return false;
+
+    entries.push_back(e);
+    return true;
+}
+
+// parses a whole table; returns false (and no entries) if any line is malformed
+bool parse_table(std::istream& in, const char separator, std::vector<tuning_entry>& entries)
+{
+    std::vector<tuning_entry> parsed;
+    std::string line;
+    while(std::getline(in, line, separator))
+    {
+        if(!parse_line(line, parsed))
+            return false;
+    }
+
+    entries.insert(entries.end(), parsed.begin(), parsed.end());
+    return true;
+}
+
+bool load_file(const char* path, std::vector<tuning_entry>& entries)
+{
+    std::ifstream in(path);
+    if(!in)
+        return false;
+    return parse_table(in, '\n', entries);
+}
+
+// The entries are kept in an immutable snapshot that the writers replace atomically,
+// so that reading a parameter (on every call of the library) takes no lock
+class tuning_table
+{
+    std::mutex mtx; // serializes the writers
+    std::once_flag init_flag;
+    std::shared_ptr<const std::vector<tuning_entry>> entries
+        = std::make_shared<const std::vector<tuning_entry>>();
+    std::vector<std::string> archs; // architecture of each device
+    bool same_arch = true; // all the devices have the same architecture
+
+    void init()
+    {
+        std::call_once(init_flag, [this] {
+            // the architectures of the devices are queried once
+            int count = 0;
+            if(hipGetDeviceCount(&count) != hipSuccess)
+                count = 0;
+            for(int device = 0; device < count; ++device)
+            {
+                hipDeviceProp_t prop;
+                std::string arch;
+                if(hipGetDeviceProperties(&prop, device) == hipSuccess)
+                {
+                    // (without the target features, e.g. gfx90a from gfx90a:sramecc+:xnack-)
+                    arch = prop.gcnArchName;
+                    arch = arch.substr(0, arch.find(':'));
+                }
+                same_arch = same_arch && (archs.empty() || arch == archs[0]);
+                archs.push_back(arch);
+            }
+
+            // malformed or missing sources are ignored and the compiled defaults are kept
+            std::vector<tuning_entry> table;
+            const char* path = std::getenv("ROCSOLVER_TUNING_FILE");
+            if(path)
+                load_file(path, table);
+
+            const char* str = std::getenv("ROCSOLVER_TUNING");
+            if(str)
+            {
+                std::istringstream in(str);
+                parse_table(in, ';', table);
+            }
+
+            publish(std::move(table));
+        });
+    }
+
+    void publish(std::vector<tuning_entry>&& table)
+    {
+        std::atomic_store(&entries,
+                          std::make_shared<const std::vector<tuning_entry>>(std::move(table)));
+    }
+
+    const std::string& current_arch() const
+    {
+        static const std::string none;
+        if(archs.empty())
+            return none;
+        if(same_arch)
+            return archs[0];
+
+        int device;
+        if(hipGetDevice(&device) != hipSuccess || device < 0 || device >= (int)archs.size())
+            return none;
+        return archs[device];
+    }
+
+public:
+    void initialize()
+    {
+        init();
+    }
+
+    rocblas_int get(const rocsolver_tuning_param param,
+                    const rocblas_datatype precision,
+                    const rocblas_int size)
+    {
+        init();
+        std::shared_ptr<const std::vector<tuning_entry>> table = std::atomic_load(&entries);
+
+        // (the architecture is only looked up if an entry needs it)
+        const std::string* arch = nullptr;
+        rocblas_int value = default_value(param, size);
+        int best = -1;
+        for(const auto& e : *table)
+        {
+            if(e.param != param || size < e.min_size || (e.max_size >= 0 && size > e.max_size))
+                continue;
+            if(e.precision != any_precision && e.precision != precision)
+                continue;
+            if(!e.arch.empty())
+            {
+                if(!arch)
+                    arch = &current_arch();
+                if(e.arch != *arch)
+                    continue;
+            }
+
+            int score = (e.arch.empty() ? 0 : 2) + (e.precision == any_precision ? 0 : 1);
+            if(score >= best)
+            {
+                best = score;
+                value = e.value;
+            }
+        }
+
+        return value;
+    }
+
+    void set(const rocsolver_tuning_param param,
+             const rocblas_datatype precision,
+             const rocblas_int min_size,
+             const rocblas_int max_size,
+             const rocblas_int value)
+    {
+        init();
+        std::lock_guard<std::mutex> lock(mtx);
+        std::vector<tuning_entry> table = *std::atomic_load(&entries);
+        table.push_back({current_arch(), precision, param, min_size, max_size, value});
+        publish(std::move(table));
+    }
+
+    bool load(const char* path)
+    {
+        init();
+        std::lock_guard<std::mutex> lock(mtx);
+        std::vector<tuning_entry> table = *std::atomic_load(&entries);
+        if(!load_file(path, table))
+            return false;
+        publish(std::move(table));
+        return true;
+    }
+
+    void reset()
+    {
+        init();
+        std::lock_guard<std::mutex> lock(mtx);
+        publish(std::vector<tuning_entry>());
+    }
+};
+
+tuning_table& get_table()
+{
+    static tuning_table table;
+    return table;
+}
+}
+
+void rocsolver_init_tuning()
+{
+    get_table().initialize();
+}
+
+rocblas_int rocsolver_get_tuning(const rocsolver_tuning_param param,
+                                 const rocblas_datatype precision,
+                                 const rocblas_int size)
+{
+    return get_table().get(param, precision, size);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_get_tuning_parameter(rocblas_handle handle,
+                                              const rocsolver_tuning_param param,
+                                              const rocblas_datatype precision,
+                                              const rocblas_int size,
+                                              rocblas_int* value)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    if(!valid_param(param) || !valid_precision(precision))
+        return rocblas_status_invalid_value;
+    if(size < 0)
+        return rocblas_status_invalid_size;
+    if(!value)
+        return rocblas_status_invalid_pointer;
+
+    *value = rocsolver_get_tuning(param, precision, size);
+    return rocblas_status_success;
+}
+
+rocblas_status rocsolver_set_tuning_parameter(rocblas_handle handle,
+                                              const rocsolver_tuning_param param,
+                                              const rocblas_datatype precision,
+                                              const rocblas_int min_size,
+                                              const rocblas_int max_size,
+                                              const rocblas_int value)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    if(!valid_param(param) || !valid_precision(precision) || value < 1)
+        return rocblas_status_invalid_value;
+    if(min_size < 0 || (max_size >= 0 && max_size < min_size))
+        return rocblas_status_invalid_size;
+
+    get_table().set(param, precision, min_size, max_size, value);
+    return rocblas_status_success;
+}
+
+rocblas_status rocsolver_load_tuning_file(rocblas_handle handle, const char* path)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    if(!path)
+        return rocblas_status_invalid_pointer;
+
+    if(!get_table().load(path))
+        return rocblas_status_invalid_value;
+    return rocblas_status_success;
+}
+
+rocblas_status rocsolver_reset_tuning(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    get_table().reset();
+    return rocblas_status_success;
+}
+}